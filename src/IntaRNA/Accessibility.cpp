@@ -236,4 +236,65 @@ decomposeByMaxED( IndexRangeList & ranges, const E_type maxED, const size_t minR
 
 ////////////////////////////////////////////////////////////////////
 
+size_t
+Accessibility::
+decomposeByMaxSiteED( IndexRangeList & ranges, const E_type maxED, const size_t siteLength ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (siteLength == 0) throw std::runtime_error("Accessibility::decomposeByMaxSiteED() : siteLength == 0");
+#endif
+	// check if there is an upper bound given; if not stop working
+	if (maxED >= ED_UPPER_BOUND) {
+		return 0;
+	}
+
+	// the range list to fill
+	IndexRangeList out;
+	// number of positions of the input and the resulting ranges
+	size_t total = 0, kept = 0;
+
+	// decompose each range individually
+	for (auto range = ranges.begin(); range != ranges.end(); range++) {
+
+		// the currently open range covered by accessible sites
+		size_t openFrom = range->to+1, openTo = range->to+1;
+		// screen all sites within the range
+		for (size_t i = range->from; i+siteLength-1 <= range->to; i++) {
+			const E_type siteED = getED(i,i+siteLength-1);
+			// check if site is accessible enough
+			if (E_isINF(siteED) || (siteED > maxED && !E_equal(siteED,maxED))) {
+				continue;
+			}
+			// check if overlapping or adjacent to the open range
+			if (openFrom <= range->to && i <= openTo+1) {
+				// extend open range
+				openTo = i+siteLength-1;
+			} else {
+				// store open range
+				if (openFrom <= range->to) {
+					out.push_back(IndexRange(openFrom,openTo));
+					kept += openTo-openFrom+1;
+				}
+				// open new range
+				openFrom = i;
+				openTo = i+siteLength-1;
+			}
+		}
+		// store last open range
+		if (openFrom <= range->to) {
+			out.push_back(IndexRange(openFrom,openTo));
+			kept += openTo-openFrom+1;
+		}
+		// account all positions of the range
+		total += range->to-range->from+1;
+	}
+
+	// replace input ranges with final decomposed list
+	ranges = out;
+
+	return total - kept;
+}
+
+////////////////////////////////////////////////////////////////////
+
 } // namespace
@@ -153,6 +153,26 @@ public:
 	void
 	decomposeByMaxED( IndexRangeList & ranges, const E_type maxED, const size_t minRangeLength ) const;
 
+
+	/**
+	 * Decomposes a given range list into the maximal subranges that are
+	 * covered by sites of a given length with an ED value below or equal to
+	 * a given threshold. Since the ED of a site is a lower bound for the ED
+	 * of any enclosing site, each interaction site with an ED below or equal
+	 * to the threshold and a length of at least siteLength is located within
+	 * one of the resulting subranges.
+	 *
+	 * @param ranges INOUT the list of ranges to decompose
+	 * @param maxED the maximal ED threshold (inclusive)
+	 * @param siteLength the length of the sites to be screened (e.g. the
+	 *            number of seed base pairs); has to be > 0
+	 *
+	 * @return the number of positions of the input ranges that are not
+	 *         covered by the resulting ranges
+	 */
+	size_t
+	decomposeByMaxSiteED( IndexRangeList & ranges, const E_type maxED, const size_t siteLength ) const;
+
 protected:
 
 	//! the RNA sequence the accessibilities correspond to
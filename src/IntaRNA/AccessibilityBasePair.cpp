@@ -10,13 +10,15 @@ namespace IntaRNA {
 
 AccessibilityBasePair::AccessibilityBasePair(const RnaSequence& seq,
     const size_t maxLength, const AccessibilityConstraint * const accConstr_,
-    const E_type bpEnergy, const Z_type _RT, const size_t minLoopLen) :
+    const E_type bpEnergy, const Z_type _RT, const size_t minLoopLen,
+    const size_t maxBpSpan_) :
       Accessibility(seq, maxLength, accConstr_),
       logPu(seq.size(), seq.size()),
       basePairEnergy(bpEnergy),
       RT(_RT),
       basePairWeight( _RT == 0.0 ? 0.0 : Z_exp(E_2_Z(-bpEnergy) / _RT) ),
-      minLoopLength(minLoopLen)
+      minLoopLength(minLoopLen),
+      maxBpSpan(maxBpSpan_)
 {
 #if INTARNA_MULITHREADING
 	#pragma omp critical(intarna_omp_logOutput)
@@ -32,30 +34,122 @@ AccessibilityBasePair::AccessibilityBasePair(const RnaSequence& seq,
 	if (RT == 0.0) {
 		throw std::runtime_error("AccessibilityBasePair: RT == 0.0");
 	}
-  const size_t N = seq.size();
-  // create temporary matrices for ED computation
-  NussinovHandler::Z2dMatrix Q(N, N);
-  NussinovHandler::Z2dMatrix Qb(N, N);
-  NussinovHandler::Z2dMatrix Pbp(N, N);
-  NussinovHandler::Z2dMatrix Pu(N, N);
-
-  logPu.resize(N, N);
-
-  // init temporary matrices
-  for (size_t i = 0u; i < N; ++i) {
-    for (size_t j = i; j < N; ++j) {
-      Q(i, j) = -1.0;
-      Qb(i, j) = -1.0;
-      Pbp(i, j) = -1.0;
-      Pu(i, j) = -1.0;
-    }
-  }
-  // compute ED values
-  for (size_t i = 0u; i < N; ++i) {
-    for (size_t j = i; j < N; ++j) {
-      logPu(i, j) = Z_2_E( -RT * Z_log(Z_type(NussinovHandler::getPu(i, j, seq, basePairWeight, minLoopLength, Q, Qb, Pbp, Pu))) );
-    }
-  }
+
+	// compute ED values
+	fillLogPu();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+void
+AccessibilityBasePair::
+fillLogPu()
+{
+	const size_t N = seq.size();
+	logPu.resize(N, N);
+	if (N == 0) {
+		return;
+	}
+
+	// maximal base pair span and resulting band width of all matrices
+	const size_t L = (maxBpSpan == 0) ? N-1 : std::min( maxBpSpan, N-1 );
+	const size_t W = L+1;
+
+	// partition functions Q(i,j) of [i,j] (row- and column-wise copy)
+	ZBand Qr(N, W, true), Qc(N, W, false);
+	// Qb(i,j) of base pairs (i,j), later replaced by the outside weights
+	// R(i,j) = basePairWeight * Pu(i,j) for all valid base pairs (i,j)
+	ZBand QbR(N, W, false);
+	// B(i,q) = sum_{p<i} R(p,q) * Q(p+1,i-1)
+	ZBand B(N, W, true);
+
+	size_t i, j, k, p, q, d;
+
+	// fill Q and Qb in increasing span order;
+	// the summation order equals the one of NussinovHandler::getQ()
+	for (d=0; d<W; d++) {
+	for (i=0; i+d<N; i++) {
+		j = i+d;
+		// base pair (i,j)
+		if (i+minLoopLength < j && RnaSequence::areComplementary(seq, seq, i, j)) {
+			QbR(i,j) = ((i+1 < j-1) ? Qr(i+1,j-1) : 1.0) * basePairWeight;
+		}
+		if (d == 0) {
+			Qr(i,j) = Qc(i,j) = 1.0;
+			continue;
+		}
+		// Q(i,j) = Q(i,j-1) + sum_k Q(i,k-1) * Qb(k,j)
+		Z_type curQ = Qr(i,j-1);
+		const Z_type * const Qi = Qr.getLine(i);
+		const Z_type * const Qbj = QbR.getLine(j);
+		for (k = std::max(i, (j > L ? j-L : 0)); k + minLoopLength < j; k++) {
+			curQ += (k > i ? Qi[k-1-i] : 1.0) * Qbj[j-k];
+		}
+		Qr(i,j) = Qc(i,j) = curQ;
+	}
+	}
+
+	// exterior partition functions Q(0,j) (Q5[j+1]) and Q(i,N-1) (Q3[i])
+	std::vector<Z_type> Q5(N+1, 1.0), Q3(N+1, 1.0);
+	for (j=0; j<N; j++) {
+		if (j < W) {
+			Q5[j+1] = Qr(0,j);
+		} else {
+			Q5[j+1] = Q5[j];
+			for (k = j-L; k + minLoopLength < j; k++) {
+				Q5[j+1] += Q5[k] * QbR(k,j);
+			}
+		}
+	}
+	for (i=N; i-- > 0; ) {
+		if (N-1-i < W) {
+			Q3[i] = Qr(i,N-1);
+		} else {
+			Q3[i] = Q3[i+1];
+			for (q = i+minLoopLength+1; q <= i+L; q++) {
+				Q3[i] += QbR(i,q) * Q3[q+1];
+			}
+		}
+	}
+	const Z_type Z = Q5[N];
+
+	// compute unpaired probabilities in decreasing span order
+	for (d=N; d-- > 0; ) {
+	for (i=0; i+d<N; i++) {
+		j = i+d;
+		// exterior case
+		Z_type curPu = Q5[i] * Q3[j+1] / Z;
+		// cases enclosed by a base pair (only within band)
+		if (d < W) {
+			// B(i,j) = sum_{p<i} R(p,j) * Q(p+1,i-1)
+			if (d > 0 && i > 0) {
+				Z_type curB = 0.0;
+				const Z_type * const Rj = QbR.getLine(j);
+				const Z_type * const Qi = Qc.getLine(i-1);
+				for (p = (j > L ? j-L : 0); p < i; p++) {
+					curB += Rj[j-p] * (p+1 < i ? Qi[i-2-p] : 1.0);
+				}
+				B(i,j) = curB;
+			}
+			// Pu(i,j) += sum_{q>j} B(i,q) * Q(j+1,q-1)
+			const Z_type * const Bi = B.getLine(i);
+			const size_t qMax = std::min( N-1, i+W-1 );
+			if (j < qMax) {
+				const Z_type * const Qj = Qr.getLine(j+1);
+				curPu += Bi[j+1-i];
+				for (q = j+2; q <= qMax; q++) {
+					curPu += Bi[q-i] * Qj[q-2-j];
+				}
+			}
+			// replace Qb(i,j) by the outside weight of base pair (i,j)
+			Z_type & Rij = QbR(i,j);
+			if (Rij > 0.0) {
+				Rij = basePairWeight * curPu;
+			}
+		}
+		logPu.set(i, j, Z_2_E( -RT * Z_log(curPu) ) );
+	}
+	}
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -74,7 +168,7 @@ AccessibilityBasePair::getED( const size_t from, const size_t to ) const
     throw std::runtime_error( "AccessibilityBasePair::getED("+toString(from)+","+toString(to)
                              +") : Arguments must satisfy 0 <= from <= to < seq.length" );
   }
-  return logPu(from, to);
+  return logPu.get(from, to);
 };
 
 }  // namespace IntaRNA
@@ -7,6 +7,9 @@
 #include "IntaRNA/Accessibility.h"
 #include "IntaRNA/AccessibilityConstraint.h"
 #include "IntaRNA/NussinovHandler.h"
+#include "IntaRNA/EdBandMatrix.h"
+
+#include <vector>
 
 
 namespace IntaRNA {
@@ -35,6 +38,8 @@ public:
    * @param basePairEnergy The energy value of the base pairs
    * @param RT The temperature energy constant
    * @param minLoopLength the minimum loop length
+   * @param maxBpSpan the maximal span (j-i) of base pairs (i,j) to be
+   *          considered within the structure ensemble; 0 = unrestricted
    */
   AccessibilityBasePair(
       const RnaSequence& seq,
@@ -42,7 +47,8 @@ public:
       const AccessibilityConstraint * const accConstr,
       const E_type basePairEnergy = Ekcal_2_E(-1.0),
       const Z_type RT = 1,
-      const size_t minLoopLength = 3);
+      const size_t minLoopLength = 3,
+      const size_t maxBpSpan = 0);
 
   /***
    * Destructor of AccessibilityBasePair
@@ -63,6 +69,57 @@ public:
 
 protected:
 
+	/**
+	 * Banded upper triangular matrix of Z values, i.e. all (i,j) with
+	 * i <= j and (j-i) < width, that is stored contiguously either row-wise
+	 * or column-wise.
+	 */
+	class ZBand {
+	public:
+		/**
+		 * Creates a band matrix initialized with 0
+		 * @param size the number of rows/columns
+		 * @param width the number of entries per row/column (truncated to size)
+		 * @param byRow whether to store row-wise (true) or column-wise (false)
+		 */
+		ZBand( const size_t size, const size_t width, const bool byRow );
+
+		/**
+		 * Access to the entry (i,j)
+		 * @param i the row
+		 * @param j the column with i <= j < i+width
+		 * @return the according entry
+		 */
+		Z_type &
+		operator()( const size_t i, const size_t j );
+
+		/**
+		 * Contiguous access to a row or column
+		 * @param x the row (byRow) or column of interest
+		 * @return pointer to entry (x,x), where the entry at position k
+		 *         encodes (x,x+k) if byRow and (x-k,x) otherwise
+		 */
+		Z_type *
+		getLine( const size_t x );
+
+	protected:
+		//! the number of entries per row/column
+		const size_t width;
+		//! whether or not the storage is row-wise
+		const bool byRow;
+		//! the start of each line within values
+		std::vector<size_t> lineStart;
+		//! the stored values
+		std::vector<Z_type> values;
+	};
+
+	/**
+	 * Computes the unpaired probabilities of all subsequences via iterative
+	 * banded Nussinov-like recursions and stores their ED values in logPu.
+	 */
+	void
+	fillLogPu();
+
 	//! energy of an individual base pair
 	const E_type basePairEnergy;
 	//! temperature constant for normalization
@@ -71,14 +128,60 @@ protected:
   const Z_type basePairWeight;
   //! minimum length of loops
   const size_t minLoopLength;
+  //! maximal span of base pairs (0 = unrestricted)
+  const size_t maxBpSpan;
 
   /***
    * Results of getED lookup table
    */
-  NussinovHandler::E2dMatrix logPu;
+  EdBandMatrix logPu;
 
 };
 
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+inline
+AccessibilityBasePair::ZBand::
+ZBand( const size_t size, const size_t width_, const bool byRow )
+	: width( std::min(width_, size) )
+	, byRow( byRow )
+	, lineStart( size+1, 0 )
+	, values()
+{
+	for (size_t x=0; x<size; x++) {
+		lineStart[x+1] = lineStart[x] + std::min( width, byRow ? size-x : x+1 );
+	}
+	values.resize( lineStart[size], Z_type(0) );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+inline
+Z_type &
+AccessibilityBasePair::ZBand::
+operator()( const size_t i, const size_t j )
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (i > j || j-i >= width || j+1 >= lineStart.size()) {
+		throw std::runtime_error("AccessibilityBasePair::ZBand("+toString(i)+","+toString(j)+") out of band (width "+toString(width)+")");
+	}
+#endif
+	return values[ lineStart[ byRow ? i : j ] + (j-i) ];
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+inline
+Z_type *
+AccessibilityBasePair::ZBand::
+getLine( const size_t x )
+{
+	return &(values[ lineStart[x] ]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
 }  // namespace IntaRNA
 
 #endif /* INTARNA_ACCESSIBILITYBASEPAIR_H_ */
@@ -0,0 +1,119 @@
+#ifndef INTARNA_ACCESSIBILITYFROMINDEX_H_
+#define INTARNA_ACCESSIBILITYFROMINDEX_H_
+
+#include "IntaRNA/Accessibility.h"
+#include "IntaRNA/AccessibilityIndex.h"
+
+
+namespace IntaRNA {
+
+/**
+ * Implements the Accessibility interface by accessing the precomputed ED
+ * values of a record of a memory mapped AccessibilityIndex.
+ *
+ */
+class AccessibilityFromIndex: public Accessibility {
+
+public:
+
+	/**
+	 * Construction
+	 * @param sequence the sequence the accessibility data belongs to
+	 *          (has to be the sequence of the index record)
+	 * @param maxLength the maximal length of accessible regions to be
+	 *          considered. 0 defaults to the maximal length stored in the
+	 *          index, otherwise it is set to min(maxLength, stored length).
+	 * @param index the index holding the ED values (has to live as long as
+	 *          this object)
+	 * @param record the index of the record within the index
+	 */
+	AccessibilityFromIndex( const RnaSequence& sequence
+							, const size_t maxLength
+							, const AccessibilityIndex & index
+							, const size_t record
+						);
+
+	/**
+	 * destruction
+	 */
+	virtual ~AccessibilityFromIndex();
+
+	/**
+	 * Returns the ED value stored in the index.
+	 *
+	 * @param from the start index of the regions (from <= to)
+	 * @param to the end index of the regions (to <= seq.length())
+	 *
+	 * @return the stored ED value if (j-1+1) <= maxLength or ED_UPPER_BOUND
+	 *         otherwise
+	 */
+	virtual
+	E_type
+	getED( const size_t from, const size_t to ) const;
+
+protected:
+
+	//! the index holding the ED values
+	const AccessibilityIndex & index;
+
+	//! the record of the sequence within the index
+	const size_t record;
+
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline
+AccessibilityFromIndex::AccessibilityFromIndex(const RnaSequence& seq
+				, const size_t maxLength
+				, const AccessibilityIndex & index
+				, const size_t record )
+ :
+	Accessibility(seq
+			, (maxLength == 0 ? index.getMaxLength(record) : std::min(maxLength,index.getMaxLength(record)))
+			, NULL)
+	, index(index)
+	, record(record)
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (index.getSequence(record) != seq.asString())
+		throw std::runtime_error("AccessibilityFromIndex() : sequence differs from index record "+toString(record));
+#endif
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_logOutput)
+#endif
+	{ VLOG(2) <<"accessibility from index..."; }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline
+AccessibilityFromIndex::~AccessibilityFromIndex()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+AccessibilityFromIndex::
+getED( const size_t from, const size_t to ) const
+{
+	// input check
+	checkIndices(from,to);
+
+	if ((to-from+1) <= getMaxLength()) {
+		return index.getED( record, from, to );
+	} else {
+		// region length exceeds maximally allowed length -> no value
+		return ED_UPPER_BOUND;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_ACCESSIBILITYFROMINDEX_H_ */
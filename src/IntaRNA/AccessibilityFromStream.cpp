@@ -102,14 +102,14 @@ parseRNAplfold_text( std::istream & inStream, const Z_type RT, const bool parseP
 	}
 
 	// resize data structure to fill
-	edValues.resize( getSequence().size(), getSequence().size(), 0, 1+getMaxLength() );
+	edValues.resize( getSequence().size(), 1+getMaxLength() );
 
 	// TODO rewrite to support "nan" and "inf" parsing via boost::spirit::qi
 	// http://stackoverflow.com/questions/11420263/is-it-possible-to-read-infinity-or-nan-values-using-input-streams
 
 	// end of ED window (= first column in file)
 	size_t j = 0, lastJ = 0;
-	while ( ! inStream.fail() && j < edValues.size2() ) {
+	while ( ! inStream.fail() && j < edValues.size() ) {
 		// read first column = end of window = j
 		if ( inStream >> j ) {
 			// check if lines are consecutive
@@ -145,9 +145,9 @@ parseRNAplfold_text( std::istream & inStream, const Z_type RT, const bool parseP
 						throw std::runtime_error("AccessibilityFromStream::parseRNAplfold_Text(Pu) : in line i="+toString(j)
 								+" : the "+toString(j+1-i)+". value = "+toString(curVal)+" is no probability in [0,1]");
 					}
-					edValues( i-1, j-1 ) = curVal > 0
+					edValues.set( i-1, j-1, curVal > 0
 											? std::min<E_type>(ED_UPPER_BOUND, Z_2_E( - RT * Z_log( Z_type(curVal) ) ))
-											: ED_UPPER_BOUND;
+											: ED_UPPER_BOUND );
 				}
 				// or ED values (in kcal/mol)
 				else {
@@ -155,7 +155,7 @@ parseRNAplfold_text( std::istream & inStream, const Z_type RT, const bool parseP
 						throw std::runtime_error("AccessibilityFromStream::parseRNAplfold_Text(ED) : in line i="+toString(j)
 								+" : the "+toString(j+1-i)+". value = "+toString(curVal)+" is no ED value >= 0");
 					}
-					edValues( i-1, j-1 ) = std::min<E_type>(ED_UPPER_BOUND, Ekcal_2_E(curVal));
+					edValues.set( i-1, j-1, std::min<E_type>(ED_UPPER_BOUND, Ekcal_2_E(curVal)) );
 				}
 			} else {
 				throw std::runtime_error("AccessibilityFromStream::parseRNAplfold_text() : in line i="+toString(j)
@@ -173,9 +173,9 @@ parseRNAplfold_text( std::istream & inStream, const Z_type RT, const bool parseP
 	}
 
 	// check if all needed data was parsed
-	if (lastJ < edValues.size2()) {
+	if (lastJ < edValues.size()) {
 		throw std::runtime_error("AccessibilityFromStream::parseRNAplfold_text() : could only parse "
-				+toString(lastJ)+" lines, but "+toString(edValues.size2())
+				+toString(lastJ)+" lines, but "+toString(edValues.size())
 				+" expected (length of sequence "+getSequence().getId()+")");
 	}
 
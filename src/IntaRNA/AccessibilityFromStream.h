@@ -4,9 +4,9 @@
 
 #include "IntaRNA/Accessibility.h"
 
-#include <iostream>
+#include "IntaRNA/EdBandMatrix.h"
 
-#include <boost/numeric/ublas/banded.hpp>
+#include <iostream>
 
 namespace IntaRNA {
 
@@ -85,7 +85,7 @@ public:
 protected:
 
 	//! type for the ED value matrix (upper triangular matrix banded by maxLength)
-	typedef boost::numeric::ublas::banded_matrix<E_type> EdMatrix;
+	typedef EdBandMatrix EdMatrix;
 
 	//! the ED values for the given sequence
 	EdMatrix edValues;
@@ -146,7 +146,7 @@ getED( const size_t from, const size_t to ) const
 			return ED_UPPER_BOUND;
 		}
 		// return according ED value from the precomputed matrix
-		return edValues (from,to);
+		return edValues.get(from,to);
 	} else {
 		// region length exceeds maximally allowed length -> no value
 		return ED_UPPER_BOUND;
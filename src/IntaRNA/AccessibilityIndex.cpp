@@ -0,0 +1,136 @@
+#include "IntaRNA/AccessibilityIndex.h"
+
+#include <fstream>
+#include <cstring>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////
+
+const std::string AccessibilityIndex::magic = "IntaRNA-AccIdx1";
+
+// magic (padded to 16 bytes) + size of the energy data type
+const size_t AccessibilityIndex::headerBytes = 16 + sizeof(boost::uint64_t);
+
+////////////////////////////////////////////////////////////////////
+
+AccessibilityIndex::
+AccessibilityIndex( const std::string & fileName )
+ :	file()
+	, region()
+	, records()
+{
+	if (!isIndexFile(fileName)) {
+		throw std::runtime_error("AccessibilityIndex("+fileName+") : file is no accessibility index");
+	}
+
+	// map whole file read-only
+	file = boost::interprocess::file_mapping( fileName.c_str(), boost::interprocess::read_only );
+	region = boost::interprocess::mapped_region( file, boost::interprocess::read_only );
+
+	const char * data = static_cast<const char*>(region.get_address());
+	const size_t dataBytes = region.get_size();
+	if (dataBytes < headerBytes) {
+		throw std::runtime_error("AccessibilityIndex("+fileName+") : truncated file header");
+	}
+
+	// check energy data type compatibility
+	if (*(reinterpret_cast<const boost::uint64_t*>(data+16)) != sizeof(E_type)) {
+		throw std::runtime_error("AccessibilityIndex("+fileName+") : index was built with a different energy data type");
+	}
+
+	// collect record locations
+	size_t pos = headerBytes;
+	while (pos + sizeof(RecordHeader) <= dataBytes) {
+		Record r;
+		r.header = reinterpret_cast<const RecordHeader*>(data+pos);
+		// check sanity of record
+		if (r.header->recordBytes < sizeof(RecordHeader) || pos + r.header->recordBytes > dataBytes) {
+			throw std::runtime_error("AccessibilityIndex("+fileName+") : corrupted record "+toString(records.size()+1));
+		}
+		r.id = data + pos + sizeof(RecordHeader);
+		r.seq = r.id + r.header->idLength;
+		const size_t seqEnd = sizeof(RecordHeader) + r.header->idLength + r.header->seqLength;
+		r.ed = reinterpret_cast<const E_type*>(data + pos + seqEnd + getPadding(seqEnd));
+		records.push_back(r);
+		// go to next record
+		pos += r.header->recordBytes;
+	}
+}
+
+////////////////////////////////////////////////////////////////////
+
+AccessibilityIndex::
+~AccessibilityIndex()
+{
+}
+
+////////////////////////////////////////////////////////////////////
+
+bool
+AccessibilityIndex::
+isIndexFile( const std::string & fileName )
+{
+	std::ifstream in( fileName.c_str(), std::ios::binary );
+	if (!in.good()) {
+		return false;
+	}
+	char buffer[16];
+	in.read( buffer, 16 );
+	return in.good() && std::memcmp( buffer, magic.c_str(), magic.size()+1 ) == 0;
+}
+
+////////////////////////////////////////////////////////////////////
+
+void
+AccessibilityIndex::
+writeHeader( std::ostream & out )
+{
+	char buffer[16];
+	std::fill( buffer, buffer+16, 0 );
+	std::copy( magic.begin(), magic.end(), buffer );
+	out.write( buffer, 16 );
+	const boost::uint64_t edBytes = sizeof(E_type);
+	out.write( reinterpret_cast<const char*>(&edBytes), sizeof(edBytes) );
+}
+
+////////////////////////////////////////////////////////////////////
+
+void
+AccessibilityIndex::
+writeRecord( std::ostream & out, const Accessibility & acc )
+{
+	const std::string & id = acc.getSequence().getId();
+	const std::string & seq = acc.getSequence().asString();
+	const size_t maxLength = std::min( acc.getMaxLength(), seq.size() );
+
+	// setup record header
+	RecordHeader header;
+	header.idLength = id.size();
+	header.seqLength = seq.size();
+	header.maxLength = maxLength;
+	const size_t seqEnd = sizeof(RecordHeader) + id.size() + seq.size();
+	const size_t edBytes = seq.size() * maxLength * sizeof(E_type);
+	header.recordBytes = seqEnd + getPadding(seqEnd) + edBytes + getPadding(edBytes);
+
+	// write header, id and sequence
+	const char padding[8] = {0,0,0,0,0,0,0,0};
+	out.write( reinterpret_cast<const char*>(&header), sizeof(RecordHeader) );
+	out.write( id.c_str(), id.size() );
+	out.write( seq.c_str(), seq.size() );
+	out.write( padding, getPadding(seqEnd) );
+
+	// write ED values row-wise
+	std::vector<E_type> row( maxLength );
+	for (size_t i=0; i<seq.size(); i++) {
+		for (size_t l=0; l<maxLength; l++) {
+			row[l] = (i+l < seq.size()) ? acc.getED( i, i+l ) : Accessibility::ED_UPPER_BOUND;
+		}
+		out.write( reinterpret_cast<const char*>(&(row[0])), maxLength*sizeof(E_type) );
+	}
+	out.write( padding, getPadding(edBytes) );
+}
+
+////////////////////////////////////////////////////////////////////
+
+} // namespace
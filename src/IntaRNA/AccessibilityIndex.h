@@ -0,0 +1,249 @@
+#ifndef INTARNA_ACCESSIBILITYINDEX_H_
+#define INTARNA_ACCESSIBILITYINDEX_H_
+
+#include "IntaRNA/general.h"
+#include "IntaRNA/Accessibility.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace IntaRNA {
+
+/**
+ * Binary index of precomputed sequences and accessibility (ED) values that
+ * is accessed via memory mapping, i.e. without parsing or recomputation.
+ *
+ * The index file is a header followed by one record per sequence. Each
+ * record stores the sequence identifier, the sequence and all ED values
+ * for subsequences up to the maximal length the accessibility was
+ * computed for (row-wise, i.e. ED(i,j) at position i*maxLength+(j-i)).
+ * All data is stored in native byte order, such that an index can only be
+ * used on the same architecture and with the same energy data type it was
+ * built with.
+ *
+ */
+class AccessibilityIndex
+{
+public:
+
+	/**
+	 * Memory mapping of an index file.
+	 *
+	 * @param fileName the name of the index file to map
+	 *
+	 * @throws std::runtime_error if the file is no valid index
+	 */
+	AccessibilityIndex( const std::string & fileName );
+
+	//! destruction
+	virtual ~AccessibilityIndex();
+
+	/**
+	 * Checks whether or not a given file is an accessibility index, i.e.
+	 * whether or not it starts with the index file header.
+	 *
+	 * @param fileName the file to check
+	 *
+	 * @return true if the file exists and is an index; false otherwise
+	 */
+	static
+	bool
+	isIndexFile( const std::string & fileName );
+
+	/**
+	 * Writes the index file header to the given stream. Has to be called
+	 * before the first record is written.
+	 *
+	 * @param out the stream to write to (has to be opened in binary mode)
+	 */
+	static
+	void
+	writeHeader( std::ostream & out );
+
+	/**
+	 * Writes the sequence and the ED values of the given accessibility
+	 * object as next record to the given stream.
+	 *
+	 * @param out the stream to write to (has to be opened in binary mode)
+	 * @param acc the accessibility data to store
+	 */
+	static
+	void
+	writeRecord( std::ostream & out, const Accessibility & acc );
+
+	/**
+	 * Number of records within the index
+	 * @return the number of stored sequences
+	 */
+	size_t
+	size() const;
+
+	/**
+	 * Access to the identifier of a record
+	 * @param record the index of the record (< size())
+	 * @return the identifier of the stored sequence
+	 */
+	std::string
+	getId( const size_t record ) const;
+
+	/**
+	 * Access to the sequence of a record
+	 * @param record the index of the record (< size())
+	 * @return the stored sequence
+	 */
+	std::string
+	getSequence( const size_t record ) const;
+
+	/**
+	 * Access to the maximal subsequence length ED values are stored for
+	 * @param record the index of the record (< size())
+	 * @return the maximal length of subsequences with stored ED values
+	 */
+	size_t
+	getMaxLength( const size_t record ) const;
+
+	/**
+	 * Access to the ED value of a subsequence of a record
+	 * @param record the index of the record (< size())
+	 * @param from the start of the subsequence
+	 * @param to the end of the subsequence (from <= to < sequence length)
+	 * @return the stored ED value or ED_UPPER_BOUND if (to-from+1)
+	 *         exceeds getMaxLength(record)
+	 */
+	E_type
+	getED( const size_t record, const size_t from, const size_t to ) const;
+
+protected:
+
+	//! fixed size record header preceding id, sequence and ED data
+	struct RecordHeader {
+		//! overall number of bytes of the record (including this header)
+		boost::uint64_t recordBytes;
+		//! length of the identifier
+		boost::uint64_t idLength;
+		//! length of the sequence
+		boost::uint64_t seqLength;
+		//! maximal length of subsequences with stored ED values
+		boost::uint64_t maxLength;
+	};
+
+	//! location of a record's data within the mapped file
+	struct Record {
+		//! the identifier (not null terminated)
+		const char * id;
+		//! the sequence (not null terminated)
+		const char * seq;
+		//! the ED values
+		const E_type * ed;
+		//! the record header
+		const RecordHeader * header;
+	};
+
+	//! the magic string at the beginning of each index file
+	static const std::string magic;
+
+	//! the number of bytes of the file header
+	static const size_t headerBytes;
+
+	//! the mapped index file
+	boost::interprocess::file_mapping file;
+
+	//! the mapped region covering the whole file
+	boost::interprocess::mapped_region region;
+
+	//! the records of the index
+	std::vector< Record > records;
+
+	/**
+	 * Computes the number of bytes needed to pad a given size to the
+	 * next multiple of 8.
+	 * @param bytes the size to pad
+	 * @return the number of padding bytes
+	 */
+	static
+	size_t
+	getPadding( const size_t bytes );
+
+};
+
+////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+AccessibilityIndex::
+size() const
+{
+	return records.size();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+std::string
+AccessibilityIndex::
+getId( const size_t record ) const
+{
+	return std::string( records.at(record).id, records.at(record).header->idLength );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+std::string
+AccessibilityIndex::
+getSequence( const size_t record ) const
+{
+	return std::string( records.at(record).seq, records.at(record).header->seqLength );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+AccessibilityIndex::
+getMaxLength( const size_t record ) const
+{
+	return records.at(record).header->maxLength;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+AccessibilityIndex::
+getED( const size_t record, const size_t from, const size_t to ) const
+{
+	const Record & r = records[record];
+#if INTARNA_IN_DEBUG_MODE
+	if (from > to || to >= r.header->seqLength)
+		throw std::runtime_error("AccessibilityIndex::getED("+toString(from)+","+toString(to)+") out of bounds");
+#endif
+	// check if stored
+	if (to-from >= r.header->maxLength) {
+		return Accessibility::ED_UPPER_BOUND;
+	}
+	return r.ed[ from*r.header->maxLength + (to-from) ];
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+AccessibilityIndex::
+getPadding( const size_t bytes )
+{
+	return (8 - (bytes % 8)) % 8;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_ACCESSIBILITYINDEX_H_ */
@@ -50,25 +50,103 @@ AccessibilityVrna::AccessibilityVrna(
 		)
  :
 	Accessibility( seq, maxLength, accConstraint ),
-	edValues( getSequence().size(), getSequence().size(), 0, getMaxLength() )
+	edValues( getSequence().size(), getMaxLength() ),
+	plFoldW( plFoldW==0 ? seq.size() : std::min(plFoldW,seq.size()) ),
+	pfScale( pfScale )
 {
 	// if sequence shows minimal length
 	if (seq.size() > 4) {
 		// window-based accessibility computation
 		fillByRNAplfold(vrnaHandler
-				, (plFoldW==0? getSequence().size() : std::min(plFoldW,getSequence().size()))
+				, this->plFoldW
 				, getAccConstraint().getMaxBpSpan()
 				, pfScale
 				);
 	} else {
 		// init ED values for short sequences
-		for (auto row = edValues.begin1(); row != edValues.end1(); row++) {
-			for (auto ed = row.begin(); ed != row.end(); ed++) {
-				*ed = 0;
-			}
-		}
+		// = default value 0 of the lazily allocated ED matrix
+	}
+
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+AccessibilityVrna::AccessibilityVrna(
+			const RnaSequence& seq
+			, const AccessibilityVrna & origin
+			, const IndexRange & changed
+			, const AccessibilityConstraint * const accConstraint
+			, const VrnaHandler & vrnaHandler
+		)
+ :
+	Accessibility( seq, origin.getMaxLength(), accConstraint ),
+	edValues( origin.edValues ),
+	plFoldW( origin.plFoldW ),
+	pfScale( origin.pfScale )
+{
+	if (seq.size() != origin.getSequence().size()) {
+		throw std::runtime_error("AccessibilityVrna() : sequence length "+toString(seq.size())+" differs from origin length "+toString(origin.getSequence().size()));
+	}
+	if (!changed.isAscending() || changed.to >= seq.size()) {
+		throw std::runtime_error("AccessibilityVrna() : changed region "+toString(changed)+" exceeds sequence length "+toString(seq.size()));
+	}
+
+	// short sequences : default value 0 copied from origin
+	if (seq.size() <= 4) {
+		return;
+	}
+
+	const size_t n = seq.size();
+	const size_t W = plFoldW;
+
+	// all windows overlapping the regions affected by the change
+	// (i.e. regions sharing a window with the changed region) are within [from,to]
+	const size_t from = (changed.from+2 > 2*W) ? changed.from+2-2*W : 0;
+	const size_t to = std::min( n-1, changed.to+2*W-2 );
+
+	// check whether or not constraints differ outside of the changed region
+	const AccessibilityConstraint & originConstraint = origin.getAccConstraint();
+	bool sameConstraint = getAccConstraint().getShapeFile().empty()
+						&& originConstraint.getShapeFile().empty()
+						&& getAccConstraint().getMaxBpSpan() == originConstraint.getMaxBpSpan();
+	for (size_t i=0; sameConstraint && i<n; i++) {
+		sameConstraint = (i >= changed.from && i <= changed.to)
+				|| (getAccConstraint().isMarkedBlocked(i) == originConstraint.isMarkedBlocked(i)
+					&& getAccConstraint().isMarkedAccessible(i) == originConstraint.isMarkedAccessible(i)
+					&& getAccConstraint().isMarkedPaired(i) == originConstraint.isMarkedPaired(i));
 	}
 
+	// check if full recomputation is needed
+	if (!sameConstraint || (from == 0 && to == n-1)) {
+		edValues.resize( n, getMaxLength() );
+		fillByRNAplfold( vrnaHandler, plFoldW, getAccConstraint().getMaxBpSpan(), pfScale );
+		return;
+	}
+
+	// compute ED values for the sequence neighborhood of the changed region
+	const RnaSequence local( seq.getId(), seq.asString().substr( from, to-from+1 ) );
+	std::string localDotBracket( local.size(), AccessibilityConstraint::dotBracket_unconstrained );
+	for (size_t i=from; i<=to; i++) {
+		if (getAccConstraint().isMarkedBlocked(i)) {
+			localDotBracket[i-from] = AccessibilityConstraint::dotBracket_blocked;
+		} else if (getAccConstraint().isMarkedAccessible(i)) {
+			localDotBracket[i-from] = AccessibilityConstraint::dotBracket_accessible;
+		} else if (getAccConstraint().isMarkedPaired(i)) {
+			localDotBracket[i-from] = AccessibilityConstraint::dotBracket_paired;
+		}
+	}
+	const AccessibilityConstraint localConstraint( local, localDotBracket, getAccConstraint().getMaxBpSpan(), "", "", "" );
+	const AccessibilityVrna localAcc( local, getMaxLength(), &localConstraint, vrnaHandler, plFoldW, pfScale );
+
+	// overwrite the ED values of all regions [i,j] that share a window with
+	// a changed position, i.e. max(j,p)-min(i,p) < W for the changed
+	// position p closest to i
+	for (size_t i = (changed.from+1 > W ? changed.from+1-W : 0); i < std::min( n, changed.to+W ); i++) {
+		const size_t p = std::min( std::max( i, changed.from ), changed.to );
+		for (size_t j = i; j < n && j-i < getMaxLength() && std::max(j,p)-std::min(i,p) < W; j++) {
+			edValues.set( i, j, localAcc.edValues.get( i-from, j-from ) );
+		}
+	}
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -111,10 +189,10 @@ callbackForStorage(FLT_OR_DBL   *pr,
 			// check if zero before computing its log-value
 			if (rightEndBlocked || accConstr.isMarkedBlocked(i-1) || (prob_unpaired == 0.0) ) {
 				// ED value = ED_UPPER_BOUND
-				edValues(i-1,j-1) = ED_UPPER_BOUND;
+				edValues.set( i-1, j-1, ED_UPPER_BOUND );
 			} else {
 				// compute ED value = E(unstructured in [i,j]) - E_all
-				edValues(i-1,j-1) = std::max<E_type>( 0., Z_2_E( -RT*Z_type(std::log(prob_unpaired) )));
+				edValues.set( i-1, j-1, std::max<E_type>( 0., Z_2_E( -RT*Z_type(std::log(prob_unpaired) ))) );
 			}
 	    }
 
@@ -466,7 +544,7 @@ fillByRNAplfold( const VrnaHandler &vrnaHandler
 //			// check if region ends are blocked
 //			if (leftSideBlocked || getAccConstraint().isMarkedBlocked(j-1)) {
 //				// region ends blocked --> set to upper bound
-//				edValues(i-1,j-1) = ED_UPPER_BOUND;
+//				edValues.set( i-1, j-1, ED_UPPER_BOUND );
 //			} else {
 //				// compute overall unpaired probability
 //				double prob_unpaired =
@@ -477,10 +555,10 @@ fillByRNAplfold( const VrnaHandler &vrnaHandler
 //				// check if zero before computing its log-value
 //				if ( prob_unpaired == 0.0 ) {
 //					// ED value = ED_UPPER_BOUND
-//					edValues(i-1,j-1) = ED_UPPER_BOUND;
+//					edValues.set( i-1, j-1, ED_UPPER_BOUND );
 //				} else {
 //					// compute ED value = E(unstructured in [i,j]) - E_all
-//					edValues(i-1,j-1) = std::max<E_type>( 0., Z_2_E( -RT*Z_type(std::log(prob_unpaired) )));
+//					edValues.set( i-1, j-1, std::max<E_type>( 0., Z_2_E( -RT*Z_type(std::log(prob_unpaired) ))) );
 //				}
 //			}
 //		}
@@ -4,8 +4,8 @@
 
 #include "IntaRNA/Accessibility.h"
 #include "IntaRNA/VrnaHandler.h"
-
-#include <boost/numeric/ublas/banded.hpp>
+#include "IntaRNA/EdBandMatrix.h"
+#include "IntaRNA/IndexRange.h"
 
 #include <iostream>
 
@@ -50,6 +50,36 @@ public:
 			, const double pfScale = VrnaHandler::getPfScaleDefault()
 			);
 
+	/**
+	 * Construction based on the accessibility data of a sequence that differs
+	 * only within a given region, either by point mutations or by additional
+	 * accessibility constraints. Within a sliding window computation, such
+	 * changes only alter the ED values of regions that share a window with
+	 * the changed region. Thus, only these values are recomputed (using the
+	 * sequence neighborhood of the changed region) while all other values are
+	 * copied from the origin. If this is not applicable (SHAPE data present,
+	 * constraints differ outside of the changed region or window covering the
+	 * whole sequence), all values are recomputed.
+	 *
+	 * @param sequence the sequence the accessibility data belongs to
+	 *        (same length as the origin's sequence)
+	 * @param origin the accessibility data to derive the values from
+	 * @param changed the region in which sequence and accConstraint differ
+	 *        from the origin
+	 * @param accConstraint if not NULL, accessibility constraint that enforces some regions
+	 *        to be unstructured both in sequence and interaction
+	 * @param vrnaHandler the VRNA parameter handler to be used
+	 *
+	 * @throw std::runtime_error if the sequence lengths differ or the changed
+	 *        region exceeds the sequence
+	 */
+	AccessibilityVrna( const RnaSequence& sequence
+			, const AccessibilityVrna & origin
+			, const IndexRange & changed
+			, const AccessibilityConstraint * const accConstraint
+			, const VrnaHandler & vrnaHandler
+			);
+
 	/**
 	 * destruction
 	 */
@@ -86,11 +116,18 @@ public:
 protected:
 
 	//! type for the ED value matrix (upper triangular matrix banded by maxLength)
-	typedef boost::numeric::ublas::banded_matrix<E_type> EdMatrix;
+	typedef EdBandMatrix EdMatrix;
 
 	//! the ED values for the given sequence
 	EdMatrix edValues;
 
+	//! the sliding window size used for the plFold computations
+	//! (truncated to the sequence length)
+	const size_t plFoldW;
+
+	//! the pf_scale used for the partition function computations
+	const double pfScale;
+
 
 	/**
 	 * Use RNAplfold-like style to fill ED-values
@@ -156,7 +193,7 @@ getED( const size_t from, const size_t to ) const
 			return ED_UPPER_BOUND;
 		}
 		// return according ED value from the precomputed matrix
-		return edValues (from,to);
+		return edValues.get(from,to);
 	} else {
 		// region length exceeds maximally allowed length -> no value
 		return ED_UPPER_BOUND;
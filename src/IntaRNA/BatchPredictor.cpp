@@ -0,0 +1,648 @@
+#include "IntaRNA/BatchPredictor.h"
+
+#include "IntaRNA/AccessibilityBasePair.h"
+#include "IntaRNA/AccessibilityConstraint.h"
+#include "IntaRNA/AccessibilityDisabled.h"
+#include "IntaRNA/AccessibilityVrna.h"
+#include "IntaRNA/InteractionEnergyBasePair.h"
+#include "IntaRNA/InteractionEnergyVrna.h"
+#include "IntaRNA/OutputHandlerInteractionList.h"
+#include "IntaRNA/PredictorMfe2d.h"
+#include "IntaRNA/PredictorMfe2dHeuristic.h"
+#include "IntaRNA/PredictorMfe2dHeuristicSeed.h"
+#include "IntaRNA/PredictorMfe2dHeuristicSeedExtension.h"
+#include "IntaRNA/PredictorMfe2dSeed.h"
+#include "IntaRNA/PredictorMfe2dSeedExtension.h"
+#include "IntaRNA/PredictorMfe2dSeedExtensionRIblast.h"
+#include "IntaRNA/PredictorMfeSeedOnly.h"
+#include "IntaRNA/SeedHandlerMfe.h"
+#include "IntaRNA/SeedHandlerNoBulge.h"
+
+#include <exception>
+#include <sstream>
+
+#if INTARNA_MULITHREADING
+	#include <omp.h>
+#endif
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////
+
+BatchPredictor::Parameters::
+Parameters()
+ :	energy('V')
+	, energyAdd(0)
+	, energyNoDangles(false)
+	, model('X')
+	, mode('H')
+	, noSeed(false)
+	, seedBP(7)
+	, seedMaxUP(0)
+	, seedMaxE(0)
+	, seedMaxEhybrid(999)
+	, seedNoGU(false)
+	, seedNoGUend(false)
+	, tAcc('C')
+	, tAccW(150)
+	, tAccL(100)
+	, tIntLenMax(0)
+	, tIntLoopMax(10)
+	, qAcc('C')
+	, qAccW(150)
+	, qAccL(100)
+	, qIntLenMax(0)
+	, qIntLoopMax(10)
+	, outNumber(1)
+	, outOverlap('B')
+	, outMaxE(0)
+	, outDeltaE(100)
+	, outBestSeedOnly(false)
+	, outNoLP(false)
+	, outNoGUend(false)
+	, threads(1)
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+
+BatchPredictor::Pair::
+Pair( const RnaSequence & target
+	, const RnaSequence & query
+	, const std::string & targetAccConstraint
+	, const std::string & queryAccConstraint )
+ :	target(target)
+	, query(query)
+	, targetAccConstraint(targetAccConstraint)
+	, queryAccConstraint(queryAccConstraint)
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+
+BatchPredictor::Mutation::
+Mutation( const bool inTarget
+		, const size_t position
+		, const char nucleotide )
+ :	inTarget(inTarget)
+	, position(position)
+	, nucleotide(nucleotide)
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+
+BatchPredictor::
+BatchPredictor( const Parameters & parameters
+			, VrnaHandler & vrnaHandler )
+ :	parameters(parameters)
+	, vrnaHandler(vrnaHandler)
+	, targetCache()
+	, queryCache()
+{
+	// check parameters
+	if (std::string("BV").find(parameters.energy) == std::string::npos) {
+		throw std::runtime_error("BatchPredictor() : energy '"+toString(parameters.energy)+"' is not supported");
+	}
+	if (std::string("CN").find(parameters.tAcc) == std::string::npos) {
+		throw std::runtime_error("BatchPredictor() : tAcc '"+toString(parameters.tAcc)+"' is not supported");
+	}
+	if (std::string("CN").find(parameters.qAcc) == std::string::npos) {
+		throw std::runtime_error("BatchPredictor() : qAcc '"+toString(parameters.qAcc)+"' is not supported");
+	}
+	if (std::string("NTQB").find(parameters.outOverlap) == std::string::npos) {
+		throw std::runtime_error("BatchPredictor() : outOverlap '"+toString(parameters.outOverlap)+"' is not supported");
+	}
+	// check prediction model and mode
+	const std::string modes = parameters.model == 'S' ? (parameters.noSeed ? "HM" : "HMS")
+							: (parameters.model == 'X' && !parameters.noSeed ? "HMRS" : "");
+	if (modes.find(parameters.mode) == std::string::npos) {
+		throw std::runtime_error("BatchPredictor() : mode '"+toString(parameters.mode)+"' is not supported for model '"+toString(parameters.model)+"'"+(parameters.noSeed?" without seed":""));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+BatchPredictor::
+~BatchPredictor()
+{
+	clearCache();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+BatchPredictor::
+clearCache()
+{
+	AccessibilityCache * caches[] = { &targetCache, &queryCache };
+	for (AccessibilityCache * cache : caches) {
+		for (auto entry = cache->begin(); entry != cache->end(); entry++) {
+			INTARNA_CLEANUP( entry->second.accRev );
+			INTARNA_CLEANUP( entry->second.acc );
+			INTARNA_CLEANUP( entry->second.seq );
+		}
+		cache->clear();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+Accessibility *
+BatchPredictor::
+newAccessibility( const RnaSequence & seq
+				, const std::string & accConstraint
+				, const bool isTarget ) const
+{
+	const char acc = isTarget ? parameters.tAcc : parameters.qAcc;
+	const size_t accW = isTarget ? parameters.tAccW : parameters.qAccW;
+	const size_t accL = isTarget ? parameters.tAccL : parameters.qAccL;
+	const size_t intLenMax = isTarget ? parameters.tIntLenMax : parameters.qIntLenMax;
+
+	// create constraint object
+	AccessibilityConstraint accConstr(seq.size(),0,"","","");
+	try {
+		accConstr = AccessibilityConstraint( seq, accConstraint, accL, "", "", "" );
+	} catch (std::exception & ex) {
+		throw std::runtime_error(toString(isTarget?"target":"query")+" accessibility constraint : "+ex.what());
+	}
+
+	// no accessibility
+	if (acc == 'N') {
+		return new AccessibilityDisabled( seq, intLenMax, &accConstr );
+	}
+
+	// compute accessibility
+	const size_t maxLength = std::min( intLenMax == 0 ? seq.size() : intLenMax
+									, accW == 0 ? seq.size() : accW );
+	switch( parameters.energy ) {
+	case 'B' :
+		return new AccessibilityBasePair( seq, maxLength, &accConstr );
+	case 'V' :
+		return new AccessibilityVrna( seq, maxLength, &accConstr, vrnaHandler, accW );
+	default :
+		INTARNA_NOT_IMPLEMENTED("BatchPredictor::newAccessibility : energy = '"+toString(parameters.energy)+"' is not supported");
+	}
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+Accessibility *
+BatchPredictor::
+newAccessibility( const RnaSequence & mutant
+				, const Accessibility & wildtype
+				, const size_t mutationPos
+				, const std::string & accConstraint
+				, const bool isTarget ) const
+{
+	// VRNA-based accessibility : recompute the neighborhood of the mutation only
+	if ((isTarget ? parameters.tAcc : parameters.qAcc) == 'C' && parameters.energy == 'V') {
+		const AccessibilityVrna * wildtypeVrna = dynamic_cast< const AccessibilityVrna * >( &wildtype );
+		if (wildtypeVrna != NULL) {
+			return new AccessibilityVrna( mutant, *wildtypeVrna, IndexRange( mutationPos, mutationPos ), &(wildtype.getAccConstraint()), vrnaHandler );
+		}
+	}
+	// otherwise full computation
+	return newAccessibility( mutant, accConstraint, isTarget );
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+BatchPredictor::
+fillCache( const std::vector< Pair > & pairs )
+{
+	// collect sequences with missing accessibility data
+	// (key, pair index, whether or not target)
+	std::vector< std::pair< std::string, std::pair< size_t, bool > > > missing;
+	for (size_t p=0; p<pairs.size(); p++) {
+		const std::string tKey = getCacheKey( pairs[p].target, pairs[p].targetAccConstraint );
+		if (targetCache.find( tKey ) == targetCache.end()) {
+			targetCache[tKey] = CacheEntry{ NULL, NULL, NULL };
+			missing.push_back( std::make_pair( tKey, std::make_pair( p, true ) ) );
+		}
+		const std::string qKey = getCacheKey( pairs[p].query, pairs[p].queryAccConstraint );
+		if (queryCache.find( qKey ) == queryCache.end()) {
+			queryCache[qKey] = CacheEntry{ NULL, NULL, NULL };
+			missing.push_back( std::make_pair( qKey, std::make_pair( p, false ) ) );
+		}
+	}
+
+	// computed accessibility data for each missing entry
+	std::vector< CacheEntry > computed( missing.size(), CacheEntry{ NULL, NULL, NULL } );
+
+#if INTARNA_MULITHREADING
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	#pragma omp parallel for schedule(dynamic) num_threads( std::max<size_t>(1,parameters.threads) ) shared(missing,computed,pairs,threadAborted,exceptionPtrDuringOmp)
+#endif
+	for (size_t m=0; m<missing.size(); m++) {
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+#endif
+				const Pair & pair = pairs.at( missing[m].second.first );
+				const bool isTarget = missing[m].second.second;
+				CacheEntry & entry = computed[m];
+				entry.seq = new RnaSequence( isTarget ? pair.target : pair.query );
+				entry.acc = newAccessibility( *(entry.seq)
+											, isTarget ? pair.targetAccConstraint : pair.queryAccConstraint
+											, isTarget );
+				INTARNA_CHECK_NOT_NULL(entry.acc,"accessibility initialization failed");
+				if (!isTarget) {
+					// reverse indexing of query sequence for the computation
+					entry.accRev = new ReverseAccessibility( *(entry.acc) );
+				}
+#if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
+#endif
+	}
+
+	// store computed data (or remove placeholders in error case)
+	for (size_t m=0; m<missing.size(); m++) {
+		AccessibilityCache & cache = missing[m].second.second ? targetCache : queryCache;
+		if (computed[m].acc != NULL && (missing[m].second.second || computed[m].accRev != NULL)) {
+			cache[missing[m].first] = computed[m];
+		} else {
+			INTARNA_CLEANUP( computed[m].acc );
+			INTARNA_CLEANUP( computed[m].seq );
+			cache.erase( missing[m].first );
+		}
+	}
+
+#if INTARNA_MULITHREADING
+	// forward exceptions
+	if (threadAborted) {
+		std::rethrow_exception( exceptionPtrDuringOmp );
+	}
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+
+size_t
+BatchPredictor::
+predict( const std::vector< Pair > & pairs, const Callback & callback )
+{
+	// compute all missing accessibilities
+	fillCache( pairs );
+
+	size_t reported = 0;
+
+#if INTARNA_MULITHREADING
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	std::stringstream exceptionInfoDuringOmp;
+	#pragma omp parallel for schedule(dynamic) num_threads( std::max<size_t>(1,parameters.threads) ) shared(pairs,callback,reported,threadAborted,exceptionPtrDuringOmp,exceptionInfoDuringOmp)
+#endif
+	for (size_t p=0; p<pairs.size(); p++) {
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+#endif
+				// cache is not altered in parallel
+				const CacheEntry & target = targetCache.at( getCacheKey( pairs[p].target, pairs[p].targetAccConstraint ) );
+				const CacheEntry & query = queryCache.at( getCacheKey( pairs[p].query, pairs[p].queryAccConstraint ) );
+
+				const size_t pairReported = predict( p, *(target.acc), *(query.accRev), callback );
+
+#if INTARNA_MULITHREADING
+				#pragma omp atomic update
+#endif
+				reported += pairReported;
+
+#if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (std::exception & e) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::make_exception_ptr(e);
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #pair "<<p <<" : "<<e.what();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #pair "<<p;
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
+#endif
+	}
+
+#if INTARNA_MULITHREADING
+	// forward exceptions
+	if (threadAborted) {
+		LOG(ERROR) <<"BatchPredictor::predict() :"<<exceptionInfoDuringOmp.str();
+		std::rethrow_exception( exceptionPtrDuringOmp );
+	}
+#endif
+
+	return reported;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+size_t
+BatchPredictor::
+predictMutants( const Pair & wildtype
+			, const std::vector< Mutation > & mutations
+			, const Callback & callback )
+{
+	// check mutations
+	for (const Mutation & mutation : mutations) {
+		const RnaSequence & seq = mutation.inTarget ? wildtype.target : wildtype.query;
+		if (mutation.position >= seq.size()) {
+			throw std::runtime_error("BatchPredictor::predictMutants() : mutation position "+toString(mutation.position)+" exceeds the length of "+seq.getId());
+		}
+		if (RnaSequence::SequenceAlphabet.find( RnaSequence::getUpperCase( std::string(1,mutation.nucleotide) ) ) == std::string::npos) {
+			throw std::runtime_error("BatchPredictor::predictMutants() : mutation nucleotide '"+toString(mutation.nucleotide)+"' is not supported");
+		}
+	}
+
+	// compute wildtype accessibilities
+	fillCache( std::vector< Pair >( 1, wildtype ) );
+	// cache is not altered in parallel
+	const CacheEntry & target = targetCache.at( getCacheKey( wildtype.target, wildtype.targetAccConstraint ) );
+	const CacheEntry & query = queryCache.at( getCacheKey( wildtype.query, wildtype.queryAccConstraint ) );
+
+	size_t reported = 0;
+
+#if INTARNA_MULITHREADING
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	std::stringstream exceptionInfoDuringOmp;
+	#pragma omp parallel for schedule(dynamic) num_threads( std::max<size_t>(1,parameters.threads) ) shared(wildtype,mutations,callback,reported,threadAborted,exceptionPtrDuringOmp,exceptionInfoDuringOmp)
+#endif
+	for (size_t m=0; m<mutations.size(); m++) {
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+#endif
+				const Mutation & mutation = mutations.at(m);
+				const RnaSequence & wildtypeSeq = mutation.inTarget ? wildtype.target : wildtype.query;
+
+				// create mutated sequence
+				std::string mutantString = wildtypeSeq.asString();
+				mutantString[mutation.position] = mutation.nucleotide;
+				const RnaSequence mutant( wildtypeSeq.getId(), mutantString, wildtypeSeq.getInOutIndex(0), wildtypeSeq.getSeqNumber() );
+
+				// derive mutant accessibility from the wildtype
+				Accessibility * mutantAcc = newAccessibility( mutant
+											, *(mutation.inTarget ? target.acc : query.acc)
+											, mutation.position
+											, mutation.inTarget ? wildtype.targetAccConstraint : wildtype.queryAccConstraint
+											, mutation.inTarget );
+				INTARNA_CHECK_NOT_NULL(mutantAcc,"accessibility initialization failed");
+
+				size_t mutantReported = 0;
+				if (mutation.inTarget) {
+					mutantReported = predict( m, *mutantAcc, *(query.accRev), callback );
+				} else {
+					// reverse indexing of query sequence for the computation
+					const ReverseAccessibility mutantAccRev( *mutantAcc );
+					mutantReported = predict( m, *(target.acc), mutantAccRev, callback );
+				}
+				INTARNA_CLEANUP( mutantAcc );
+
+#if INTARNA_MULITHREADING
+				#pragma omp atomic update
+#endif
+				reported += mutantReported;
+
+#if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (std::exception & e) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::make_exception_ptr(e);
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #mutation "<<m <<" : "<<e.what();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #mutation "<<m;
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
+#endif
+	}
+
+#if INTARNA_MULITHREADING
+	// forward exceptions
+	if (threadAborted) {
+		LOG(ERROR) <<"BatchPredictor::predictMutants() :"<<exceptionInfoDuringOmp.str();
+		std::rethrow_exception( exceptionPtrDuringOmp );
+	}
+#endif
+
+	return reported;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector< BatchPredictor::Mutation >
+BatchPredictor::
+getPointMutations( const Pair & wildtype
+				, const bool mutateTarget
+				, const bool mutateQuery )
+{
+	const std::string nucleotides = "ACGU";
+	std::vector< Mutation > mutations;
+	for (size_t s=0; s<2; s++) {
+		const bool inTarget = (s==0);
+		if (inTarget ? !mutateTarget : !mutateQuery) {
+			continue;
+		}
+		const std::string & seq = (inTarget ? wildtype.target : wildtype.query).asString();
+		for (size_t i=0; i<seq.size(); i++) {
+			for (const char & nucleotide : nucleotides) {
+				if (seq.at(i) != nucleotide) {
+					mutations.push_back( Mutation( inTarget, i, nucleotide ) );
+				}
+			}
+		}
+	}
+	return mutations;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+size_t
+BatchPredictor::
+predict( const size_t pairIndex
+		, const Accessibility & targetAcc
+		, const ReverseAccessibility & queryAcc
+		, const Callback & callback ) const
+{
+	// check whether to compute ES values (for multi-site predictions)
+	const bool initES = false;
+
+	// get energy computation handler for both sequences
+	InteractionEnergy * energy = NULL;
+	switch( parameters.energy ) {
+	case 'B' : energy = new InteractionEnergyBasePair( targetAcc, queryAcc
+						, parameters.tIntLoopMax, parameters.qIntLoopMax
+						, initES, Z_type(1.0), Ekcal_2_E(-1), 3
+						, Ekcal_2_E(parameters.energyAdd), !parameters.energyNoDangles, !parameters.outNoGUend );
+				break;
+	case 'V' : energy = new InteractionEnergyVrna( targetAcc, queryAcc, vrnaHandler
+						, parameters.tIntLoopMax, parameters.qIntLoopMax
+						, initES, Ekcal_2_E(parameters.energyAdd), !parameters.energyNoDangles, !parameters.outNoGUend );
+				break;
+	default :
+		INTARNA_NOT_IMPLEMENTED("BatchPredictor::predict : energy = '"+toString(parameters.energy)+"' is not supported");
+	}
+	INTARNA_CHECK_NOT_NULL(energy,"energy initialization failed");
+
+	// setup output constraint
+	OutputConstraint::ReportOverlap overlap = OutputConstraint::ReportOverlap::OVERLAP_BOTH;
+	switch(parameters.outOverlap) {
+	case 'N' : overlap = OutputConstraint::ReportOverlap::OVERLAP_NONE; break;
+	case 'T' : overlap = OutputConstraint::ReportOverlap::OVERLAP_SEQ1; break;
+	case 'Q' : overlap = OutputConstraint::ReportOverlap::OVERLAP_SEQ2; break;
+	default : overlap = OutputConstraint::ReportOverlap::OVERLAP_BOTH; break;
+	}
+	const OutputConstraint outConstraint( parameters.outNumber
+			, overlap
+			, Ekcal_2_E(parameters.outMaxE)
+			, Ekcal_2_E(parameters.outDeltaE)
+			, parameters.outBestSeedOnly
+			, parameters.outNoLP
+			, parameters.outNoGUend );
+
+	// collect k-best interactions
+	OutputHandlerInteractionList output( outConstraint, parameters.outNumber );
+
+	// setup seed constraint (has to exist until predictor is deleted)
+	const SeedConstraint seedConstraint( parameters.seedBP
+							, parameters.seedMaxUP
+							, parameters.seedMaxUP
+							, parameters.seedMaxUP
+							, Ekcal_2_E(parameters.seedMaxE)
+							, Accessibility::ED_UPPER_BOUND
+							, Ekcal_2_E(parameters.seedMaxEhybrid)
+							, IndexRangeList()
+							, IndexRangeList()
+							, ""
+							, parameters.seedNoGU
+							, parameters.seedNoGUend
+							, parameters.outNoLP );
+	SeedHandler * seedHandler = NULL;
+	if (!parameters.noSeed) {
+		if (parameters.seedMaxUP > 0) {
+			seedHandler = new SeedHandlerMfe( *energy, seedConstraint );
+		} else {
+			seedHandler = new SeedHandlerNoBulge( *energy, seedConstraint );
+		}
+	}
+
+	// get interaction prediction handler
+	Predictor * predictor = NULL;
+	switch( parameters.model ) {
+	case 'S' :
+		switch( parameters.mode ) {
+		case 'H' : predictor = seedHandler == NULL
+							? (Predictor*)new PredictorMfe2dHeuristic( *energy, output, NULL )
+							: (Predictor*)new PredictorMfe2dHeuristicSeed( *energy, output, NULL, seedHandler );
+					break;
+		case 'M' : predictor = seedHandler == NULL
+							? (Predictor*)new PredictorMfe2d( *energy, output, NULL )
+							: (Predictor*)new PredictorMfe2dSeed( *energy, output, NULL, seedHandler );
+					break;
+		case 'S' : predictor = new PredictorMfeSeedOnly( *energy, output, NULL, seedHandler ); break;
+		}
+		break;
+	case 'X' :
+		switch( parameters.mode ) {
+		case 'H' : predictor = new PredictorMfe2dHeuristicSeedExtension( *energy, output, NULL, seedHandler ); break;
+		case 'M' : predictor = new PredictorMfe2dSeedExtension( *energy, output, NULL, seedHandler ); break;
+		case 'R' : predictor = new PredictorMfe2dSeedExtensionRIblast( *energy, output, NULL, seedHandler ); break;
+		case 'S' : predictor = new PredictorMfeSeedOnly( *energy, output, NULL, seedHandler ); break;
+		}
+		break;
+	}
+	if (predictor == NULL) {
+		INTARNA_CLEANUP(seedHandler);
+		INTARNA_CLEANUP(energy);
+		INTARNA_NOT_IMPLEMENTED("BatchPredictor::predict : mode "+toString(parameters.mode)+" not available for model "+toString(parameters.model));
+	}
+
+	// run prediction for the full sequences
+	predictor->predict( IndexRange( 0, targetAcc.getSequence().size()-1 )
+					, queryAcc.getReversedIndexRange( IndexRange( 0, queryAcc.getSequence().size()-1 ) ) );
+	INTARNA_CLEANUP(predictor);
+
+	// forward reported interactions
+	size_t reported = 0;
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_batchPredictorCallback)
+#endif
+	{
+		for (const Interaction * interaction : output) {
+			callback( pairIndex, *interaction, *energy );
+			reported++;
+		}
+	}
+
+	INTARNA_CLEANUP(energy);
+
+	return reported;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+} // namespace
@@ -0,0 +1,405 @@
+#ifndef INTARNA_BATCHPREDICTOR_H_
+#define INTARNA_BATCHPREDICTOR_H_
+
+#include "IntaRNA/general.h"
+#include "IntaRNA/Accessibility.h"
+#include "IntaRNA/Interaction.h"
+#include "IntaRNA/InteractionEnergy.h"
+#include "IntaRNA/ReverseAccessibility.h"
+#include "IntaRNA/RnaSequence.h"
+#include "IntaRNA/VrnaHandler.h"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace IntaRNA {
+
+/**
+ * In-process batch prediction of RNA-RNA interactions for embedding IntaRNA
+ * as a library, i.e. without calling the IntaRNA binary and parsing its
+ * output.
+ *
+ * The prediction parameters are set up once. Afterwards, batches of
+ * target-query pairs can be submitted via predict() and all reported
+ * interactions are forwarded to a callback function.
+ *
+ * Accessibility data is cached per (id, sequence, constraint) and shared
+ * among all pairs and batches until clearCache() is called. Pairs of a batch
+ * are processed in parallel using the OpenMP thread pool of the process.
+ *
+ * Usage:
+ *
+ *   VrnaHandler vrnaHandler;
+ *   BatchPredictor::Parameters param;
+ *   param.outNumber = 2;
+ *   BatchPredictor batch( param, vrnaHandler );
+ *   std::vector< BatchPredictor::Pair > pairs;
+ *   pairs.push_back( BatchPredictor::Pair( RnaSequence("t","..."), RnaSequence("q","...") ) );
+ *   batch.predict( pairs, [&]( const size_t pairIndex, const Interaction & i, const InteractionEnergy & energy ) {
+ *       std::cout <<pairIndex <<" " <<E_2_Ekcal(i.energy) <<std::endl;
+ *   });
+ *
+ */
+class BatchPredictor
+{
+public:
+
+	/**
+	 * Prediction parameters. Defaults as well as semantics correspond to the
+	 * respective IntaRNA call arguments.
+	 */
+	struct Parameters {
+
+		//! energy model : 'V' (VRNA-based) or 'B' (base pair based)
+		char energy;
+		//! constant energy contribution added to each interaction (kcal/mol)
+		Z_type energyAdd;
+		//! whether or not dangling end contributions are ignored
+		bool energyNoDangles;
+
+		//! prediction model : 'X' (seed extension) or 'S' (single-site mfe)
+		char model;
+		//! prediction mode : 'H' (heuristic), 'M' (exact) or 'S' (seed-only)
+		char mode;
+
+		//! whether or not to predict interactions without seed constraint
+		//! (model 'S' only)
+		bool noSeed;
+		//! number of base pairs within a seed
+		size_t seedBP;
+		//! maximal number of unpaired bases within a seed
+		size_t seedMaxUP;
+		//! maximal overall energy of a seed (kcal/mol)
+		Z_type seedMaxE;
+		//! maximal hybridization energy of a seed (kcal/mol)
+		Z_type seedMaxEhybrid;
+		//! whether or not GU base pairs are forbidden within seeds
+		bool seedNoGU;
+		//! whether or not GU base pairs are forbidden at seed ends
+		bool seedNoGUend;
+
+		//! target accessibility : 'C' (computed) or 'N' (not considered)
+		char tAcc;
+		//! sliding window size for target accessibility computation (0 = full length)
+		size_t tAccW;
+		//! maximal base pair span for target accessibility computation (0 = full length)
+		size_t tAccL;
+		//! maximal length of interacting target subsequences (0 = full length)
+		size_t tIntLenMax;
+		//! maximal number of unpaired target bases in interior loops
+		size_t tIntLoopMax;
+
+		//! query accessibility : 'C' (computed) or 'N' (not considered)
+		char qAcc;
+		//! sliding window size for query accessibility computation (0 = full length)
+		size_t qAccW;
+		//! maximal base pair span for query accessibility computation (0 = full length)
+		size_t qAccL;
+		//! maximal length of interacting query subsequences (0 = full length)
+		size_t qIntLenMax;
+		//! maximal number of unpaired query bases in interior loops
+		size_t qIntLoopMax;
+
+		//! maximal number of interactions reported per pair
+		size_t outNumber;
+		//! allowed overlap of reported interactions : 'N', 'T', 'Q' or 'B'
+		char outOverlap;
+		//! maximal energy of reported interactions (kcal/mol)
+		Z_type outMaxE;
+		//! maximal energy difference to the mfe of reported interactions (kcal/mol)
+		Z_type outDeltaE;
+		//! whether or not only the best seed is reported per interaction
+		bool outBestSeedOnly;
+		//! whether or not lonely base pairs are forbidden
+		bool outNoLP;
+		//! whether or not GU base pairs are forbidden at helix ends
+		bool outNoGUend;
+
+		//! number of threads to be used for the processing of a batch
+		size_t threads;
+
+		//! construction with IntaRNA defaults
+		Parameters();
+	};
+
+	/**
+	 * A target-query pair to predict interactions for.
+	 */
+	struct Pair {
+		//! the target sequence
+		RnaSequence target;
+		//! the query sequence
+		RnaSequence query;
+		//! accessibility constraint for the target (VRNA-like dot-bracket encoding)
+		std::string targetAccConstraint;
+		//! accessibility constraint for the query (VRNA-like dot-bracket encoding)
+		std::string queryAccConstraint;
+
+		/**
+		 * construction
+		 * @param target the target sequence
+		 * @param query the query sequence
+		 * @param targetAccConstraint accessibility constraint for the target
+		 * @param queryAccConstraint accessibility constraint for the query
+		 */
+		Pair( const RnaSequence & target
+			, const RnaSequence & query
+			, const std::string & targetAccConstraint = ""
+			, const std::string & queryAccConstraint = "" );
+	};
+
+	/**
+	 * A point mutation of the target or query sequence of a pair.
+	 */
+	struct Mutation {
+		//! whether the target (true) or the query (false) is mutated
+		bool inTarget;
+		//! the index of the mutated sequence position
+		size_t position;
+		//! the nucleotide at the mutated position
+		char nucleotide;
+
+		/**
+		 * construction
+		 * @param inTarget whether the target (true) or the query (false) is mutated
+		 * @param position the index of the mutated sequence position
+		 * @param nucleotide the nucleotide at the mutated position
+		 */
+		Mutation( const bool inTarget
+				, const size_t position
+				, const char nucleotide );
+	};
+
+	/**
+	 * Callback for reported interactions. For each pair, the reported
+	 * interactions are forwarded sorted by energy. The energy handler is
+	 * only valid within the call and can be used to compute further
+	 * details of the interaction. Calls are serialized but the order of
+	 * pairs is arbitrary if multiple threads are used.
+	 *
+	 * @param pairIndex the index of the pair within the batch
+	 * @param interaction the reported interaction
+	 * @param energy the energy handler used for the prediction
+	 */
+	typedef std::function< void ( const size_t pairIndex
+								, const Interaction & interaction
+								, const InteractionEnergy & energy ) > Callback;
+
+	/**
+	 * Sets up the batch prediction.
+	 *
+	 * @param parameters the prediction parameters
+	 * @param vrnaHandler the VRNA parameter handler to be used (the object
+	 *        has to exist as long as this object)
+	 *
+	 * @throws std::runtime_error if the parameters are not supported
+	 */
+	BatchPredictor( const Parameters & parameters
+				, VrnaHandler & vrnaHandler );
+
+	//! destruction and cache cleanup
+	virtual ~BatchPredictor();
+
+	/**
+	 * Predicts the interactions for all given pairs and forwards the
+	 * reported interactions to the callback.
+	 *
+	 * @param pairs the target-query pairs to process
+	 * @param callback the function to forward all reported interactions to
+	 * @return the number of reported interactions
+	 *
+	 * @throws std::runtime_error if a prediction failed
+	 */
+	size_t
+	predict( const std::vector< Pair > & pairs, const Callback & callback );
+
+	/**
+	 * Predicts the interactions for point mutants of a wildtype pair, e.g.
+	 * for the screening of compensatory mutations, and forwards the reported
+	 * interactions to the callback. The pairIndex of the callback is the
+	 * index of the respective mutation.
+	 *
+	 * The accessibility data of the wildtype is cached. For each mutant, only
+	 * the accessibility of the mutated sequence is derived from the wildtype,
+	 * i.e. for VRNA-based sliding window computations only the ED values of
+	 * regions within the window neighborhood of the mutation are recomputed.
+	 * Mutants are processed in parallel.
+	 *
+	 * @param wildtype the pair to be mutated
+	 * @param mutations the point mutations to be evaluated individually
+	 * @param callback the function to forward all reported interactions to
+	 * @return the number of reported interactions
+	 *
+	 * @throws std::runtime_error if a mutation is invalid or a prediction failed
+	 */
+	size_t
+	predictMutants( const Pair & wildtype
+				, const std::vector< Mutation > & mutations
+				, const Callback & callback );
+
+	/**
+	 * Provides all single point mutations of a pair, i.e. for each position
+	 * of the selected sequences all three alternative nucleotides.
+	 *
+	 * @param wildtype the pair to be mutated
+	 * @param mutateTarget whether or not to mutate the target
+	 * @param mutateQuery whether or not to mutate the query
+	 * @return the list of point mutations
+	 */
+	static
+	std::vector< Mutation >
+	getPointMutations( const Pair & wildtype
+					, const bool mutateTarget
+					, const bool mutateQuery );
+
+	/**
+	 * Access to the prediction parameters.
+	 * @return the prediction parameters
+	 */
+	const Parameters &
+	getParameters() const;
+
+	/**
+	 * Number of sequences with cached accessibility data.
+	 * @return the number of cached accessibility objects
+	 */
+	size_t
+	getCacheSize() const;
+
+	/**
+	 * Removes all cached accessibility data.
+	 */
+	void
+	clearCache();
+
+protected:
+
+	/**
+	 * Cached accessibility data of a sequence
+	 */
+	struct CacheEntry {
+		//! the sequence referenced by acc
+		RnaSequence * seq;
+		//! the accessibility data
+		Accessibility * acc;
+		//! the reversed accessibility data (query only, otherwise NULL)
+		ReverseAccessibility * accRev;
+	};
+
+	//! cache of accessibility data indexed by getCacheKey()
+	typedef std::map< std::string, CacheEntry > AccessibilityCache;
+
+	//! the prediction parameters
+	const Parameters parameters;
+
+	//! the VRNA parameter handler
+	VrnaHandler & vrnaHandler;
+
+	//! cached target accessibility data
+	AccessibilityCache targetCache;
+
+	//! cached query accessibility data
+	AccessibilityCache queryCache;
+
+	/**
+	 * Provides the cache key for a sequence and its accessibility constraint
+	 * @param seq the sequence
+	 * @param accConstraint the accessibility constraint
+	 * @return the key within the accessibility caches
+	 */
+	static
+	std::string
+	getCacheKey( const RnaSequence & seq, const std::string & accConstraint );
+
+	/**
+	 * Computes the accessibility data of a sequence.
+	 *
+	 * @param seq the sequence (has to exist as long as the returned object)
+	 * @param accConstraint the accessibility constraint
+	 * @param isTarget whether or not target parameters are to be used
+	 * @return the newly allocated accessibility object
+	 */
+	Accessibility *
+	newAccessibility( const RnaSequence & seq
+					, const std::string & accConstraint
+					, const bool isTarget ) const;
+
+	/**
+	 * Computes the accessibility data of a point mutant based on the data
+	 * of its wildtype.
+	 *
+	 * @param mutant the mutated sequence (has to exist as long as the returned object)
+	 * @param wildtype the accessibility data of the wildtype sequence
+	 * @param mutationPos the index of the mutated position
+	 * @param accConstraint the accessibility constraint
+	 * @param isTarget whether or not target parameters are to be used
+	 * @return the newly allocated accessibility object
+	 */
+	Accessibility *
+	newAccessibility( const RnaSequence & mutant
+					, const Accessibility & wildtype
+					, const size_t mutationPos
+					, const std::string & accConstraint
+					, const bool isTarget ) const;
+
+	/**
+	 * Computes and caches all missing accessibility data of the given pairs.
+	 * @param pairs the pairs to process
+	 */
+	void
+	fillCache( const std::vector< Pair > & pairs );
+
+	/**
+	 * Predicts and reports the interactions for a single pair.
+	 *
+	 * @param pairIndex the index of the pair
+	 * @param targetAcc the target accessibility
+	 * @param queryAcc the reversed query accessibility
+	 * @param callback the function to forward all reported interactions to
+	 * @return the number of reported interactions
+	 */
+	size_t
+	predict( const size_t pairIndex
+			, const Accessibility & targetAcc
+			, const ReverseAccessibility & queryAcc
+			, const Callback & callback ) const;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+const BatchPredictor::Parameters &
+BatchPredictor::
+getParameters() const
+{
+	return parameters;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+BatchPredictor::
+getCacheSize() const
+{
+	return targetCache.size() + queryCache.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+std::string
+BatchPredictor::
+getCacheKey( const RnaSequence & seq, const std::string & accConstraint )
+{
+	return seq.getId() + '\n' + seq.asString() + '\n' + accConstraint;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_BATCHPREDICTOR_H_ */
@@ -0,0 +1,111 @@
+
+#include "IntaRNA/DinucleotideShuffler.h"
+
+#include <algorithm>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////////
+
+DinucleotideShuffler::
+DinucleotideShuffler( const std::string & sequence )
+ :	sequence(sequence)
+	, vertices()
+	, successors()
+	, firstVertex(0)
+	, lastVertex(0)
+{
+	// get vertex index of each sequence position
+	std::vector< size_t > vertexOf( sequence.size(), 0 );
+	for (size_t i=0; i<sequence.size(); i++) {
+		const size_t v = vertices.find( sequence.at(i) );
+		if (v == std::string::npos) {
+			vertexOf[i] = vertices.size();
+			vertices.push_back( sequence.at(i) );
+		} else {
+			vertexOf[i] = v;
+		}
+	}
+	// collect dinucleotide transitions
+	successors.resize( vertices.size() );
+	for (size_t i=1; i<sequence.size(); i++) {
+		successors[vertexOf[i-1]].push_back( vertexOf[i] );
+	}
+	if (!sequence.empty()) {
+		firstVertex = vertexOf.front();
+		lastVertex = vertexOf.back();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+DinucleotideShuffler::
+~DinucleotideShuffler()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string
+DinucleotideShuffler::
+shuffle( RandomGenerator & rng ) const
+{
+	// nothing to shuffle
+	if (sequence.size() < 3) {
+		return sequence;
+	}
+
+	// select for each vertex the transition to be used last such that
+	// all selected transitions form a tree rooted in the last vertex
+	std::vector< size_t > lastTransition( vertices.size(), 0 );
+	bool isTree = false;
+	while (!isTree) {
+		for (size_t v=0; v<vertices.size(); v++) {
+			if (v != lastVertex) {
+				lastTransition[v] = getRandomNumber( rng, successors[v].size() );
+			}
+		}
+		// check whether or not all vertices reach the last vertex
+		isTree = true;
+		for (size_t v=0; isTree && v<vertices.size(); v++) {
+			size_t cur = v;
+			for (size_t steps=0; cur != lastVertex && steps < vertices.size(); steps++) {
+				cur = successors[cur][lastTransition[cur]];
+			}
+			isTree = (cur == lastVertex);
+		}
+	}
+
+	// shuffle all remaining transitions of each vertex
+	std::vector< std::vector< size_t > > transitions( successors );
+	for (size_t v=0; v<vertices.size(); v++) {
+		if (transitions[v].empty()) {
+			continue;
+		}
+		size_t toShuffle = transitions[v].size();
+		if (v != lastVertex) {
+			// move selected last transition to the end
+			std::swap( transitions[v][lastTransition[v]], transitions[v].back() );
+			toShuffle--;
+		}
+		// Fisher-Yates shuffle of the remaining transitions
+		for (size_t i=toShuffle; i>1; i--) {
+			std::swap( transitions[v][i-1], transitions[v][ getRandomNumber( rng, i ) ] );
+		}
+	}
+
+	// generate the Eulerian path
+	std::string shuffled( sequence.size(), vertices.at(firstVertex) );
+	std::vector< size_t > nextTransition( vertices.size(), 0 );
+	size_t cur = firstVertex;
+	for (size_t i=1; i<shuffled.size(); i++) {
+		cur = transitions[cur][nextTransition[cur]++];
+		shuffled[i] = vertices.at(cur);
+	}
+
+	return shuffled;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
@@ -0,0 +1,119 @@
+#ifndef INTARNA_DINUCLEOTIDESHUFFLER_H_
+#define INTARNA_DINUCLEOTIDESHUFFLER_H_
+
+#include "IntaRNA/general.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace IntaRNA {
+
+/**
+ * Generates random permutations of a sequence that preserve its exact
+ * dinucleotide composition as well as its first and last character.
+ *
+ * Shuffles are generated via random Eulerian paths within the graph of
+ * dinucleotide transitions (Altschul and Erickson, 1985; Kandel et al., 1996),
+ * i.e. each shuffle is generated in linear time without rejection of
+ * invalid permutations. The transition graph is computed once at construction
+ * such that an arbitrary number of shuffles can be generated efficiently.
+ *
+ */
+class DinucleotideShuffler
+{
+public:
+
+	//! random number generator used for shuffling
+	typedef std::mt19937 RandomGenerator;
+
+	/**
+	 * Construction and setup of the dinucleotide transition graph
+	 * @param sequence the sequence to be shuffled
+	 */
+	DinucleotideShuffler( const std::string & sequence );
+
+	//! destruction
+	virtual ~DinucleotideShuffler();
+
+	/**
+	 * Generates a random dinucleotide-preserving shuffle of the sequence.
+	 * The result depends only on the state of the given random number
+	 * generator and is thus platform independent.
+	 *
+	 * @param rng the random number generator to be used
+	 * @return the shuffled sequence
+	 */
+	std::string
+	shuffle( RandomGenerator & rng ) const;
+
+	/**
+	 * Access to the sequence to be shuffled
+	 * @return the original sequence
+	 */
+	const std::string &
+	getSequence() const;
+
+protected:
+
+	/**
+	 * Draws a uniformly distributed random number from the interval [0,n).
+	 * In contrast to std::uniform_int_distribution, the result is not
+	 * implementation dependent.
+	 * @param rng the random number generator to be used
+	 * @param n the upper bound (exclusive, >0)
+	 * @return the random number
+	 */
+	static
+	size_t
+	getRandomNumber( RandomGenerator & rng, const size_t n );
+
+	//! the sequence to be shuffled
+	const std::string sequence;
+
+	//! the distinct characters of the sequence (vertices of the graph)
+	std::string vertices;
+
+	//! for each vertex the list of successor vertices in sequence order
+	std::vector< std::vector< size_t > > successors;
+
+	//! the vertex of the first sequence character
+	size_t firstVertex;
+
+	//! the vertex of the last sequence character
+	size_t lastVertex;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+const std::string &
+DinucleotideShuffler::
+getSequence() const
+{
+	return sequence;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+DinucleotideShuffler::
+getRandomNumber( RandomGenerator & rng, const size_t n )
+{
+	// rejection sampling to avoid modulo bias
+	const RandomGenerator::result_type range = RandomGenerator::max() - RandomGenerator::min();
+	const RandomGenerator::result_type limit = range - ((range % n) + 1) % n;
+	RandomGenerator::result_type value = rng() - RandomGenerator::min();
+	while (value > limit) {
+		value = rng() - RandomGenerator::min();
+	}
+	return (size_t)(value % n);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_DINUCLEOTIDESHUFFLER_H_ */
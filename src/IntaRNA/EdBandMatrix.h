@@ -0,0 +1,417 @@
+
+#ifndef INTARNA_EDBANDMATRIX_H_
+#define INTARNA_EDBANDMATRIX_H_
+
+#include "IntaRNA/general.h"
+
+#include <vector>
+#include <limits>
+
+#include <boost/cstdint.hpp>
+
+namespace IntaRNA {
+
+/**
+ * Band matrix storage of ED values for all subsequences [i,j] of a sequence
+ * with a maximal length, i.e. (j-i) < width.
+ *
+ * Values are stored row-major in [i][j-i] layout such that all values of
+ * the same start position i are contiguous in memory. The storage is
+ * allocated lazily on the first write access; until then (and for never
+ * written cells) a default value is reported.
+ *
+ * Optionally (default if compiled with INTARNA_NARROW_ENERGY), values are
+ * stored using 16 bit per cell. Since ED values are typically small, this
+ * halves the memory footprint for long sequences. If a finite value to be
+ * stored does not fit into 16 bit, the storage is widened once to E_type,
+ * such that the represented values are always exact.
+ *
+ * @author Martin Mann
+ *
+ */
+class EdBandMatrix {
+
+public:
+
+	//! the narrow type used for 16 bit storage
+	typedef boost::int16_t narrow_type;
+
+#if INTARNA_NARROW_ENERGY
+	//! whether or not narrow storage is used by default
+	static const bool NARROW_DEFAULT = true;
+#else
+	//! whether or not narrow storage is used by default
+	static const bool NARROW_DEFAULT = false;
+#endif
+
+	/**
+	 * Creates a band matrix
+	 * @param size the number of rows (sequence length)
+	 * @param width the number of values per row, i.e. the maximal length of
+	 *        a subsequence (truncated to size)
+	 * @param narrow whether or not to use 16 bit storage if possible
+	 * @param defaultValue the value reported for never written cells
+	 */
+	EdBandMatrix( const size_t size = 0
+				, const size_t width = 0
+				, const bool narrow = NARROW_DEFAULT
+				, const E_type defaultValue = E_type(0) );
+
+	/**
+	 * destruction
+	 */
+	virtual ~EdBandMatrix();
+
+	/**
+	 * Resizes the matrix and discards all stored values
+	 * @param size the number of rows (sequence length)
+	 * @param width the number of values per row, i.e. the maximal length of
+	 *        a subsequence (truncated to size)
+	 */
+	void
+	resize( const size_t size, const size_t width );
+
+	/**
+	 * Number of rows
+	 * @return the number of rows (sequence length)
+	 */
+	size_t
+	size() const;
+
+	/**
+	 * Number of values per row
+	 * @return the maximal number of values per row
+	 */
+	size_t
+	getWidth() const;
+
+	/**
+	 * Whether or not values are currently stored using 16 bit
+	 * @return true if 16 bit storage is used
+	 */
+	bool
+	isNarrow() const;
+
+	/**
+	 * Access to the value of subsequence [i,j]
+	 * @param i the start of the subsequence
+	 * @param j the end of the subsequence with i <= j < i+width
+	 * @return the stored value or the default value if never written
+	 */
+	E_type
+	get( const size_t i, const size_t j ) const;
+
+	/**
+	 * Sets the value of subsequence [i,j]
+	 * @param i the start of the subsequence
+	 * @param j the end of the subsequence with i <= j < i+width
+	 * @param value the value to store (values >= E_INF are stored as E_INF)
+	 */
+	void
+	set( const size_t i, const size_t j, const E_type value );
+
+	/**
+	 * Direct access to all values of a row (for wide storage only)
+	 * @param i the row of interest
+	 * @return pointer to the values of [i,i+k] at position k or NULL if the
+	 *         storage is narrow or not yet allocated
+	 */
+	const E_type *
+	getRow( const size_t i ) const;
+
+protected:
+
+	//! number of rows
+	size_t rows;
+
+	//! number of values per row
+	size_t width;
+
+	//! whether or not 16 bit storage is used
+	bool narrow;
+
+	//! value reported for never written cells
+	E_type defaultValue;
+
+	//! wide storage (used if !narrow)
+	std::vector<E_type> wideValues;
+
+	//! narrow storage (used if narrow)
+	std::vector<narrow_type> narrowValues;
+
+	//! narrow storage code for E_INF
+	static const narrow_type NARROW_INF = std::numeric_limits<narrow_type>::max();
+
+	/**
+	 * Position of subsequence [i,j] within the storage
+	 * @param i the start of the subsequence
+	 * @param j the end of the subsequence
+	 * @return the storage index
+	 */
+	size_t
+	getIndex( const size_t i, const size_t j ) const;
+
+	/**
+	 * Allocates the storage, initialized with the default value
+	 */
+	void
+	allocate();
+
+	/**
+	 * Converts the narrow storage into wide storage
+	 */
+	void
+	widen();
+
+	/**
+	 * Whether or not a value can be represented by narrow storage
+	 * @param value the value of interest
+	 * @return true if the value fits into narrow storage
+	 */
+	static
+	bool
+	isNarrowable( const E_type value );
+
+	/**
+	 * Encodes a value into narrow storage
+	 * @param value the value to encode (has to be narrowable)
+	 * @return the narrow code
+	 */
+	static
+	narrow_type
+	toNarrow( const E_type value );
+
+	/**
+	 * Decodes a narrow code
+	 * @param value the narrow code
+	 * @return the represented value
+	 */
+	static
+	E_type
+	fromNarrow( const narrow_type value );
+
+};
+
+////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////
+
+inline
+EdBandMatrix::
+EdBandMatrix( const size_t size
+			, const size_t width
+			, const bool narrow
+			, const E_type defaultValue )
+	: rows(0)
+	, width(0)
+	, narrow(narrow)
+	, defaultValue( std::min(defaultValue,E_INF) )
+	, wideValues()
+	, narrowValues()
+{
+	resize( size, width );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+EdBandMatrix::
+~EdBandMatrix()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+EdBandMatrix::
+resize( const size_t size, const size_t width_ )
+{
+	rows = size;
+	width = std::min( width_, size );
+	// lazy allocation on first write
+	wideValues.clear();
+	wideValues.shrink_to_fit();
+	narrowValues.clear();
+	narrowValues.shrink_to_fit();
+	// ensure the default value is narrowable if narrow storage is requested
+	if (narrow && !isNarrowable(defaultValue)) {
+		narrow = false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+EdBandMatrix::
+size() const
+{
+	return rows;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+EdBandMatrix::
+getWidth() const
+{
+	return width;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+EdBandMatrix::
+isNarrow() const
+{
+	return narrow;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+EdBandMatrix::
+getIndex( const size_t i, const size_t j ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (i > j || j >= rows || j-i >= width) {
+		throw std::runtime_error("EdBandMatrix::getIndex("+toString(i)+","+toString(j)+") out of band (size "
+				+toString(rows)+", width "+toString(width)+")");
+	}
+#endif
+	return i*width + (j-i);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+EdBandMatrix::
+isNarrowable( const E_type value )
+{
+	return E_isINF(value)
+		|| (value >= E_type(std::numeric_limits<narrow_type>::min()) && value < E_type(NARROW_INF));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+EdBandMatrix::narrow_type
+EdBandMatrix::
+toNarrow( const E_type value )
+{
+	return E_isINF(value) ? NARROW_INF : narrow_type(value);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+EdBandMatrix::
+fromNarrow( const narrow_type value )
+{
+	return value == NARROW_INF ? E_INF : E_type(value);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+EdBandMatrix::
+get( const size_t i, const size_t j ) const
+{
+	const size_t idx = getIndex(i,j);
+	if (narrow) {
+		return narrowValues.empty() ? defaultValue : fromNarrow( narrowValues[idx] );
+	} else {
+		return wideValues.empty() ? defaultValue : wideValues[idx];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+EdBandMatrix::
+set( const size_t i, const size_t j, const E_type value_ )
+{
+	const size_t idx = getIndex(i,j);
+	const E_type value = std::min( value_, E_INF );
+	// switch to wide storage if needed
+	if (narrow && !isNarrowable(value)) {
+		widen();
+	}
+	// ensure storage is available
+	if (narrow ? narrowValues.empty() : wideValues.empty()) {
+		allocate();
+	}
+	// store
+	if (narrow) {
+		narrowValues[idx] = toNarrow(value);
+	} else {
+		wideValues[idx] = value;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+const E_type *
+EdBandMatrix::
+getRow( const size_t i ) const
+{
+	if (narrow || wideValues.empty()) {
+		return NULL;
+	}
+#if INTARNA_IN_DEBUG_MODE
+	if (i >= rows) {
+		throw std::runtime_error("EdBandMatrix::getRow("+toString(i)+") out of range (size "+toString(rows)+")");
+	}
+#endif
+	return &(wideValues[i*width]);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+EdBandMatrix::
+allocate()
+{
+	if (narrow) {
+		narrowValues.assign( rows*width, toNarrow(defaultValue) );
+	} else {
+		wideValues.assign( rows*width, defaultValue );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+EdBandMatrix::
+widen()
+{
+	if (!narrow) {
+		return;
+	}
+	// copy decoded values if already allocated
+	if (!narrowValues.empty()) {
+		wideValues.resize( narrowValues.size() );
+		for (size_t idx=0; idx<narrowValues.size(); idx++) {
+			wideValues[idx] = fromNarrow( narrowValues[idx] );
+		}
+		narrowValues.clear();
+		narrowValues.shrink_to_fit();
+	}
+	narrow = false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_EDBANDMATRIX_H_ */
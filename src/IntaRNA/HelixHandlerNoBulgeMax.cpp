@@ -23,67 +23,83 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 
 	// reset storage of maximal helix information
 	helix.clear();
+	helixRowStart.clear();
+	helixOffset1 = i1min;
 
 	const size_t minBP = helixConstraint.getMinBasePairs();
 	const E_type maxE = helixConstraint.getMaxE();
 
+	const size_t i1maxBound=std::min( i1max+1, energy.size1() );
+	const size_t i2maxBound=std::min( i2max+1, energy.size2() );
+
+	// check if anything to do
+	if (i1min >= i1maxBound || i2min >= i2maxBound) {
+		return helix.size();
+	}
+
+	// get bit-parallel complementarity information of the range
+	// (bit (i2-i2min) of row (i1-i1min) is set if (i1,i2) can form a base pair)
+	pairing.init( energy, i1min, i1maxBound-1, i2min, i2maxBound-1 );
+	const size_t rows = i1maxBound-i1min;
+	const size_t words = pairing.getRowWords();
+	std::vector<boost::uint64_t> runStart( rows*words, 0 );
+	for (size_t r=0; r<rows; r++) {
+		std::copy( pairing.getComplementaryRow(i1min+r), pairing.getComplementaryRow(i1min+r)+words, runStart.begin()+r*words );
+	}
+	// identify left ends of diagonal runs of at least minBP stacked base pairs:
+	// after k iterations, a bit is set if k+1 consecutive base pairs start there,
+	// i.e. the row is combined with the next row shifted by one position
+	// (in-place since each row depends only on the not yet updated next row)
+	for (size_t k=1; k<minBP; k++) {
+		for (size_t r=0; r<rows; r++) {
+			boost::uint64_t * cur = &(runStart[r*words]);
+			if (r+1 < rows) {
+				const boost::uint64_t * next = &(runStart[(r+1)*words]);
+				for (size_t w=0; w<words; w++) {
+					cur[w] &= (next[w] >> 1) | (w+1<words ? (next[w+1] << 63) : boost::uint64_t(0));
+				}
+			} else {
+				// no run can start in the last row
+				std::fill( cur, cur+words, boost::uint64_t(0) );
+			}
+		}
+	}
+
 	//! container to store stacking energies of canonical helix base pairs
 	typedef std::vector<E_type> StackingEnergyList;
 	// left-stacking energies of all helix base pairs
 	// (excludes right-most bp with E=E_init)
-	// data structure is used as a ring list to avoid energy recomputation
 	StackingEnergyList bpE(helixConstraint.getMaxBasePairs()-1,(E_type)0);
-	// end index of current seed information within bpE ringlist
-	size_t bpE_end = 0;
 
-	const size_t i1maxBound=std::min( i1max+1, energy.size1() );
-	const size_t i2maxBound=std::min( i2max+1, energy.size2() );
-	size_t i1,i2,maxOffset,o,curHelixLength,curBestLength;
+	size_t i1,i2,curHelixLength,curBestLength;
 	bool validHelix = false;
 	E_type curHelixE = E_INF, curBestE = E_INF;
-	// for all start indices shifts in seq1 and seq2
-	for (size_t i1start = i1min; i1start < i1maxBound; i1start++) {
-	for (size_t i2start = i2min; (i2start==i2min) || (i1start==i1min && i2start < i2maxBound); i2start++) {
-
-		// shift to right-most bp parallel to (i1start,i2start)
-		maxOffset = std::min(i1maxBound-i1start, i2maxBound-i2start);
-		curHelixE = E_INF;
-		curHelixLength = 0;
-
-		// iterate over all left end offsets of a helix
-		for( o = maxOffset; o-->0;) {
-
-			// putative base pair indices to check
-			i1 = i1start+o;
-			i2 = i2start+o;
-
-			// check if valid base pair
-			if( energy.isAccessible1( i1 )
-				&& energy.isAccessible2( i2 )
-				&& energy.areComplementary( i1, i2 ))
-			{
-				// start new canonical helix information
-				if (E_isINF(curHelixE)) {
-					curHelixE = E_type(0);
-					curHelixLength = 1;
+	// for all left ends of runs (ordered by i1 and i2)
+	helixRowStart.resize( rows+1, 0 );
+	for (size_t r=0; r<rows; r++) {
+		helixRowStart[r] = helix.size();
+		i1 = i1min+r;
+		for (size_t w=0; w<words; w++) {
+			// iterate all set bits of the current word
+			size_t c = w*64;
+			for (boost::uint64_t bits = runStart[r*words+w]; bits != 0; bits >>= 1, c++) {
+				if ((bits & 1) == 0) {
+					continue;
 				}
-				// update helix information
-				else {
-					// extended already to maxBP
-					if (curHelixLength > bpE.size()) {
-						// correct curHelixE
-						curHelixE -= bpE[(bpE_end)%bpE.size()];
-					} else {
-						// increase helix length
-						curHelixLength++;
-					}
-					// compute and store new stacking energy
-					bpE[(bpE_end)%bpE.size()] = energy.getE_interLeft(i1,i1+1,i2,i2+1);
-					// update overall helix energy
-					curHelixE += bpE[(bpE_end)%bpE.size()];
-
-					// shift storage information
-					bpE_end++;
+				i2 = i2min+c;
+
+				// get stacking energies of the maximal helix starting at (i1,i2)
+				// (stacking energies are only evaluated within runs of >= minBP)
+				curHelixE = E_type(0);
+				curHelixLength = 1;
+				while( curHelixLength <= bpE.size()
+						&& i1+curHelixLength < i1maxBound
+						&& i2+curHelixLength < i2maxBound
+						&& pairing.areComplementary( i1+curHelixLength, i2+curHelixLength ) )
+				{
+					bpE[curHelixLength-1] = energy.getE_interLeft(i1+curHelixLength-1,i1+curHelixLength,i2+curHelixLength-1,i2+curHelixLength);
+					curHelixE += bpE[curHelixLength-1];
+					curHelixLength++;
 				}
 
 				// find best helix length for current left boundary
@@ -112,26 +128,21 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 						curBestLength = l;
 					}
 					// update curE
-					curE -= bpE[(bpE_end+1-l)%bpE.size()];
+					if (l > 1) {
+						curE -= bpE[l-2];
+					}
 				}
 
 				// store helix information
 				if (E_isNotINF(curBestE)) {
 					// store helix information
-					helix[BP(i1,i2)] = HelixData(curBestE,curBestLength);
+					helix.push_back( HelixEntry( i2, HelixData(curBestE,curBestLength) ) );
 				}
-			} else {
-				// reset data structures
-				for(auto e=bpE.begin(); e!=bpE.end(); e++) { *e = (E_type)0; }
-				bpE_end = 0; // set to start position
-				curHelixE = E_INF; // reset helix energy
-				curHelixLength = 0; // reset helix length
-			}
-
-		}
 
-	} // i2start
-	} // i2start
+			} // bits
+		} // words
+	} // rows
+	helixRowStart[rows] = helix.size();
 
 #if INTARNA_MULITHREADING
 #pragma omp critical(intarna_omp_logOutput)
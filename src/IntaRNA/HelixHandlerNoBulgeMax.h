@@ -5,6 +5,10 @@
 #include "IntaRNA/InteractionEnergy.h"
 #include "IntaRNA/HelixConstraint.h"
 #include "IntaRNA/HelixHandler.h"
+#include "IntaRNA/PairingContext.h"
+
+#include <algorithm>
+#include <vector>
 
 #include <boost/unordered_map.hpp>
 
@@ -29,6 +33,10 @@ public:
 	//! it holds both the energy (first) as well as the length of the helix
 	typedef boost::unordered_map< Interaction::BasePair, HelixData, Interaction::BasePair::Hash > HelixHash;
 
+	//! helix information for a left-most base pair (i1,i2) within the flat
+	//! helix storage: the index in seq2 (first) and the helix information
+	typedef std::pair< size_t, HelixData > HelixEntry;
+
 protected:
 
 	//! shortening typedef
@@ -213,6 +221,16 @@ protected:
 	size_t
 	decodeHelixSeedLength2( const size_t code ) const;
 
+	/**
+	 * Access to the helix information of the flat helix storage
+	 * @param i1 the left-most index in seq1
+	 * @param i2 the left-most index in seq2
+	 * @return the helix information of the mfe helix starting at (i1,i2)
+	 *         or NULL if none is known
+	 */
+	const HelixData *
+	getHelixData( const size_t i1, const size_t i2 ) const;
+
 protected:
 
 	//! the used energy function
@@ -221,8 +239,19 @@ protected:
 	//! the helix constraint to be applied
 	const HelixConstraint & helixConstraint;
 
-	//! the helix mfe information for helix starting at (i1, i2)
-	HelixHash helix;
+	//! complementarity information of the current fillHelix() range
+	PairingContext pairing;
+
+	//! first index in seq1 covered by the flat helix storage
+	size_t helixOffset1;
+
+	//! start of the entries of each index in seq1 (relative to helixOffset1)
+	//! within helix, followed by a final end sentinel
+	std::vector<size_t> helixRowStart;
+
+	//! the helix mfe information for helix starting at (i1, i2) sorted by
+	//! (i1,i2), i.e. a compressed row storage of the sparse helix matrix
+	std::vector< HelixEntry > helix;
 
 	//! the helix mfe information for helix with seed starting at (i1, i2)
 	HelixHash helixSeed;
@@ -244,8 +273,12 @@ HelixHandlerNoBulgeMax::HelixHandlerNoBulgeMax(
 		:
 		energy(energy)
 		, helixConstraint(helixConstraint)
+		, pairing()
+		, helixOffset1(0)
+		, helixRowStart()
 		, helix()
 		, helixSeed()
+		, seedHandler(NULL)
 {
 	if (seedHandler != NULL) {
 		setSeedHandler( *seedHandler );
@@ -287,9 +320,9 @@ HelixHandlerNoBulgeMax::
 getHelixE(const size_t i1, const size_t i2) const
 {
 	// try to locate helix information
-	HelixHash::const_iterator data = helix.find(BP(i1,i2));
+	const HelixData * data = getHelixData(i1,i2);
 	// return respective value
-	return (data==helix.end()) ? E_INF : data->second.first;
+	return (data==NULL) ? E_INF : data->first;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -313,9 +346,9 @@ HelixHandlerNoBulgeMax::
 getHelixLength1(const size_t i1, const size_t i2) const
 {
 	// try to locate helix information
-	HelixHash::const_iterator data = helix.find(BP(i1,i2));
+	const HelixData * data = getHelixData(i1,i2);
 	// return respective value
-	return (data==helix.end()) ? 0 : data->second.second;
+	return (data==NULL) ? 0 : data->second;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -326,9 +359,9 @@ HelixHandlerNoBulgeMax::
 getHelixLength2(const size_t i1, const size_t i2) const
 {
 	// try to locate helix information
-	HelixHash::const_iterator data = helix.find(BP(i1,i2));
+	const HelixData * data = getHelixData(i1,i2);
 	// return respective value
-	return (data==helix.end()) ? 0 : data->second.second;
+	return (data==NULL) ? 0 : data->second;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -389,6 +422,25 @@ decodeHelixSeedLength2( const size_t code ) const
 
 //////////////////////////////////////////////////////////////////////////
 
+inline
+const HelixHandlerNoBulgeMax::HelixData *
+HelixHandlerNoBulgeMax::
+getHelixData( const size_t i1, const size_t i2 ) const
+{
+	// check if row is covered
+	if (i1 < helixOffset1 || i1-helixOffset1+1 >= helixRowStart.size()) {
+		return NULL;
+	}
+	// binary search within the row's entries sorted by i2
+	const auto rowBegin = helix.begin() + helixRowStart[i1-helixOffset1];
+	const auto rowEnd = helix.begin() + helixRowStart[i1-helixOffset1+1];
+	const auto data = std::lower_bound( rowBegin, rowEnd, i2
+			, [](const HelixEntry & e, const size_t i2) { return e.first < i2; } );
+	return (data == rowEnd || data->first != i2) ? NULL : &(data->second);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 inline
 void
 HelixHandlerNoBulgeMax::setSeedHandler(SeedHandler & seedHandler) {
@@ -21,11 +21,8 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 	TIMED_FUNC_IF(timerObj,VLOG_IS_ON(9));
 
 	helix.resize( i1max-i1min+1, i2max-i2min+1 );
-	helixE_rec.resize( HelixIndex({{
-				   (HelixRecMatrix::index)(helix.size1())
-				   , (HelixRecMatrix::index)(helix.size2())
-				   , (HelixRecMatrix::index)(getConstraint().getMaxBasePairs()+1)}}) );
-	std::fill( helixE_rec.origin(), helixE_rec.origin() + helixE_rec.num_elements(), std::make_pair(E_INF,0));
+	// the recursion of row i1 depends on the rows i1+1..i1+maxIL+1 only
+	helixE_rec.reset( getConstraint().getMaxIL()+2, 0, helix.size2(), getConstraint().getMaxBasePairs()+1 );
 
 	size_t minBP;
 	E_type maxE;
@@ -44,7 +41,7 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 	offset2 = i2min;
 
 	// temporary variables
-	size_t i1, i2, curBP, bestBP, u1, u2, j1, j2, hL1, hL2, k1, k2, u1best, u2best, bestL1, bestL2;
+	size_t i1, i2, curBP, bestBP, j1, j2;
 	E_type curE, bestE;
 
 	size_t  helixCountNotInf = 0;
@@ -52,6 +49,10 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 	// fill for all start indeices
 	// in decreasing index order
 	for (i1=i1max+1; i1-- > i1min;) {
+
+		// compute recursion data for all helices starting in row i1
+		fillHelixRec( i1, i2min, i2max, helix.size1(), helix.size2() );
+
 	for (i2=i2max+1; i2-- > i2min;) {
 
 		// init according to no helix interaction
@@ -62,71 +63,6 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 			continue; // go to next helixE index
 		}
 
-		// Calculate energy for all different numbers of base pairs (bpMin to bpMax)
-		for (curBP=2; curBP < getConstraint().getMaxBasePairs()+1
-					  && (i1+curBP-1-offset1) < helix.size1()
-					  && (i2+curBP-1-offset2) < helix.size2(); curBP++) {
-
-			// init current helix energy
-			curE = E_INF;
-			bestE = E_INF;
-			bestL1 = 0;
-			bestL2 = 0;
-
-			// for feasible unpaired bases
-			for (u1 = 0; u1 < getConstraint().getMaxIL()+1 && (i1+u1+1 -offset1)< helix.size1(); u1++) {
-			for (u2 = 0; u2 < getConstraint().getMaxIL()+1 - u1 && (i2+u2+1 -offset2) < helix.size2(); u2++) {
-
-				// get split base pair (right boundaries when curBP = 2)
-				k1 = i1 + u1 +1;
-				k2 = i2 + u2 +1;
-
-				// check if split base pair is complementary
-				if (energy.areComplementary(k1, k2)) {
-
-					// base case: only left and right base pair present
-					if (curBP == 2) {
-						// energy for stacking/bulge/interior depending on u1/u2
-						curE = energy.getE_interLeft(i1, k1, i2, k2);
-						// save the best energy among all u1/u2 combinations
-						if (curE < bestE) {
-							bestE = curE;
-							bestL1 = curBP +u1;
-							bestL2 = curBP +u2;
-						}
-					} else {
-						// check if recursed entry is < E_INF
-						if (E_isINF(getHelixE(k1 - offset1, k2 - offset2, curBP - 1))) {
-							continue; // invalid entry -> skip
-						}
-
-						// check right boundaries
-						if (i1 + u1 + getHelixLength1(k1-offset1, k2-offset2, curBP-1) -offset1 >= helix.size1()
-							|| i2 + u2 + getHelixLength2(k1-offset1, k2-offset2, curBP-1)-offset2 >= helix.size2()) {
-							continue; // not within the boundaries -> skip
-						}
-
-						// update mfe for split at k1,k2
-						curE = energy.getE_interLeft(i1, k1, i2, k2) + getHelixE(k1 - offset1, k2 - offset2, curBP - 1);
-
-						// store best energy only
-						if (curE < bestE) {
-							bestE = curE;
-							bestL1 = u1 + getHelixLength1(k1 - offset1, k2 - offset2, curBP - 1)+1;
-							bestL2 = u2 + getHelixLength2(k1 - offset1, k2 - offset2, curBP - 1)+1;
-
-						}
-					} // more than two base pairs
-				} // (j1, j2) complementary
-
-
-			} // u2
-			} // u1
-			// store helix energy and length
-			setHelixPair(i1 - offset1, i2 - offset2, curBP, bestE, encodeHelixLength(bestL1, bestL2));
-
-		} // curBP
-
 		// TODO: Possible runtime improvement by checking this while calculating
 		// find best unpaired combination in helx for i1,i2,bp
 		bestBP = 0;
@@ -198,6 +134,115 @@ fillHelix(const size_t i1min, const size_t i1max, const size_t i2min, const size
 
 //////////////////////////////////////////////////////////////////////////
 
+void
+HelixHandlerUnpaired::
+fillHelixRec( const size_t i1, const size_t i2min, const size_t i2max
+			, const size_t size1, const size_t size2 )
+{
+	// temporary variables
+	size_t i2, curBP, u1, u2, k1, k2, bestL1, bestL2;
+	E_type curE, bestE;
+
+	// start new row with (E_INF,0) for all entries
+	helixE_rec.initRow( i1-offset1 );
+
+	// fill for all start indices in decreasing index order
+	for (i2=i2max+1; i2-- > i2min;) {
+
+		// skip non-complementary left helix boundaries
+		if (!energy.areComplementary(i1,i2)) {
+			continue; // go to next helixE index
+		}
+
+		// Calculate energy for all different numbers of base pairs (bpMin to bpMax)
+		for (curBP=2; curBP < getConstraint().getMaxBasePairs()+1
+					  && (i1+curBP-1-offset1) < size1
+					  && (i2+curBP-1-offset2) < size2; curBP++) {
+
+			// init current helix energy
+			curE = E_INF;
+			bestE = E_INF;
+			bestL1 = 0;
+			bestL2 = 0;
+
+			// for feasible unpaired bases
+			for (u1 = 0; u1 < getConstraint().getMaxIL()+1 && (i1+u1+1 -offset1)< size1; u1++) {
+			for (u2 = 0; u2 < getConstraint().getMaxIL()+1 - u1 && (i2+u2+1 -offset2) < size2; u2++) {
+
+				// get split base pair (right boundaries when curBP = 2)
+				k1 = i1 + u1 +1;
+				k2 = i2 + u2 +1;
+
+				// check if split base pair is complementary
+				if (energy.areComplementary(k1, k2)) {
+
+					// base case: only left and right base pair present
+					if (curBP == 2) {
+						// energy for stacking/bulge/interior depending on u1/u2
+						curE = energy.getE_interLeft(i1, k1, i2, k2);
+						// save the best energy among all u1/u2 combinations
+						if (curE < bestE) {
+							bestE = curE;
+							bestL1 = curBP +u1;
+							bestL2 = curBP +u2;
+						}
+					} else {
+						// check if recursed entry is < E_INF
+						if (E_isINF(getHelixE(k1 - offset1, k2 - offset2, curBP - 1))) {
+							continue; // invalid entry -> skip
+						}
+
+						// check right boundaries
+						if (i1 + u1 + getHelixLength1(k1-offset1, k2-offset2, curBP-1) -offset1 >= size1
+							|| i2 + u2 + getHelixLength2(k1-offset1, k2-offset2, curBP-1)-offset2 >= size2) {
+							continue; // not within the boundaries -> skip
+						}
+
+						// update mfe for split at k1,k2
+						curE = energy.getE_interLeft(i1, k1, i2, k2) + getHelixE(k1 - offset1, k2 - offset2, curBP - 1);
+
+						// store best energy only
+						if (curE < bestE) {
+							bestE = curE;
+							bestL1 = u1 + getHelixLength1(k1 - offset1, k2 - offset2, curBP - 1)+1;
+							bestL2 = u2 + getHelixLength2(k1 - offset1, k2 - offset2, curBP - 1)+1;
+
+						}
+					} // more than two base pairs
+				} // (j1, j2) complementary
+
+
+			} // u2
+			} // u1
+			// store helix energy and length
+			setHelixPair(i1 - offset1, i2 - offset2, curBP, bestE, encodeHelixLength(bestL1, bestL2));
+
+		} // curBP
+
+	} // i2
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void
+HelixHandlerUnpaired::
+fillHelixRecBlock( const size_t i1, const size_t i2
+			, const size_t extent1, const size_t extent2
+			, const size_t size1, const size_t size2 )
+{
+	// last row and column of the block within the window
+	const size_t i1max = std::min( size1, i1+extent1 )-1;
+	const size_t i2max = std::min( size2, i2+extent2 )-1;
+	// rows of the block are kept without rolling
+	helixE_rec.reset( i1max-i1+1, i2, i2max-i2+1, getConstraint().getMaxBasePairs()+1 );
+	// fill in decreasing row order
+	for (size_t r1=i1max+1; r1-- > i1;) {
+		fillHelixRec( r1+offset1, i2+offset2, i2max+offset2, size1, size2 );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void
 HelixHandlerUnpaired::
 traceBackHelix( Interaction & interaction
@@ -212,6 +257,10 @@ traceBackHelix( Interaction & interaction
 			, k1, k2
 			;
 
+	// recompute the recursion data covering all helices starting at (i1_,i2_)
+	fillHelixRecBlock( i1_, i2_, getConstraint().getMaxLength1()+1, getConstraint().getMaxLength2()+1
+			, helix.size1(), helix.size2() );
+
 	// get energy of provided seed
 	E_type curE = getHelixE(i1_,i2_,bp);
 	// trace helices
@@ -301,6 +350,12 @@ fillHelixSeed(const size_t i1min, const size_t i1max, const size_t i2min, const
 	offset1 = i1min;
 	offset2 = i2min;
 
+	// the helix recursion data is recomputed along the way, where the
+	// rows up to the end of the trailing helix right of any seed are needed
+	helixE_rec.reset( std::max( getConstraint().getMaxIL()+2
+								, getConstraint().getMaxLength1() + seedHandler->getConstraint().getMaxLength1() + 1 )
+					, 0, helixSeed.size2(), getConstraint().getMaxBasePairs()+1 );
+
 	// temporary variables
 	size_t i1, i2, seedStart1, seedStart2, seedEnd1, seedEnd2, j1, j2, bestL1, bestL2, possibleBasePairs;
 	size_t  helixCountNotInf = 0, helixCount = 0;
@@ -310,6 +365,10 @@ fillHelixSeed(const size_t i1min, const size_t i1max, const size_t i2min, const
 	// fill for all start indices
 	// in decreasing index order
 	for (i1=i1max+1; i1-- > i1min;) {
+
+		// compute recursion data for all helices starting in row i1
+		fillHelixRec( i1, i2min, i2max, helixSeed.size1(), helixSeed.size2() );
+
 	for (i2=i2max+1; i2-- > i2min;) {
 
 		// count possible helices
@@ -501,6 +560,12 @@ traceBackHelixSeed( Interaction & interaction
 		return;
 	}
 
+	// recompute the recursion data covering all leading and trailing helices
+	fillHelixRecBlock( i1_-offset1, i2_-offset2
+			, 2*getConstraint().getMaxLength1() + seedHandler->getConstraint().getMaxLength1() + 1
+			, 2*getConstraint().getMaxLength2() + seedHandler->getConstraint().getMaxLength2() + 1
+			, helixSeed.size1(), helixSeed.size2() );
+
 	// Calculate how many base pairs are possible allongside the seed.
 	// Note: If seedHandler allows unpaired positions this check is not enough, check happens in loop
 	size_t possibleBasePairs = std::min(std::min(helixSeed.size1()-i1 +offset1, helixSeed.size2()-i2+offset2), helixConstraint.getMaxBasePairs())-seedHandler->getConstraint().getBasePairs();
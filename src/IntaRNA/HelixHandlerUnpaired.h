@@ -6,9 +6,10 @@
 #include "IntaRNA/HelixConstraint.h"
 #include "IntaRNA/HelixHandler.h"
 
-#include <boost/multi_array.hpp>
-
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/cstdint.hpp>
+
+#include <vector>
 
 namespace IntaRNA {
 
@@ -22,16 +23,121 @@ class HelixHandlerUnpaired : public HelixHandler {
 
 public:
 
-	//! 3D matrix type to hold the mfe energies for helix interactions
-	//! of the ranges i1..(i1+bpMax-1) and i2..(i2+bpMax-1), with
-	//! i1,i2 = the start index of the helix in seq1/2
-	//! bp = the maximal number of base pairs within the helix (>=bpMin)
-	//! using the index [i1][i2][bp] or a HelixIndex object
-	typedef boost::multi_array<std::pair<E_type, size_t>,3> HelixRecMatrix;
+	/**
+	 * Rolling storage of the helix recursion data, i.e. the mfe energy and
+	 * the length encoding of helices with left-most base pair (i1,i2) and
+	 * exactly bp base pairs.
+	 *
+	 * Only a fixed number of i1 rows is kept, which have to be filled in
+	 * decreasing i1 order. Energies and length encodings are stored in
+	 * separate planes using the layout [i1 row][i2-from2][bp].
+	 * Cells outside of the currently available rows or the covered i2
+	 * range are reported as (E_INF,0).
+	 */
+	class HelixRecBuffer {
+	public:
+
+		//! type used to store the length encodings
+		typedef boost::uint32_t length_type;
+
+		/**
+		 * Construction of an empty buffer
+		 */
+		HelixRecBuffer();
+
+		/**
+		 * Resets the buffer and discards all stored rows
+		 * @param rowNumber the number of i1 rows to keep
+		 * @param from2 the first i2 index covered
+		 * @param colNumber the number of i2 indices covered
+		 * @param bpNumber the number of base pair counts to store, i.e. bp < bpNumber
+		 */
+		void
+		reset( const size_t rowNumber, const size_t from2
+				, const size_t colNumber, const size_t bpNumber );
+
+		/**
+		 * Starts a new row, which has to be smaller than all rows started
+		 * before since the last reset. All its cells are set to (E_INF,0).
+		 * If needed, the largest row stored is dropped.
+		 * @param i1 the row to start
+		 */
+		void
+		initRow( const size_t i1 );
+
+		/**
+		 * Checks whether or not a cell is covered by the stored data
+		 * @param i1 the row of interest
+		 * @param i2 the column of interest
+		 * @return true if the cell is available; false otherwise
+		 */
+		bool
+		isAvailable( const size_t i1, const size_t i2 ) const;
+
+		/**
+		 * Access to the energy of a cell
+		 * @param i1 the row of interest
+		 * @param i2 the column of interest
+		 * @param bp the number of base pairs
+		 * @return the stored energy or E_INF if not available
+		 */
+		E_type
+		getE( const size_t i1, const size_t i2, const size_t bp ) const;
+
+		/**
+		 * Access to the length encoding of a cell
+		 * @param i1 the row of interest
+		 * @param i2 the column of interest
+		 * @param bp the number of base pairs
+		 * @return the stored length encoding or 0 if not available
+		 */
+		size_t
+		getLength( const size_t i1, const size_t i2, const size_t bp ) const;
+
+		/**
+		 * Sets the data of a cell of an available row
+		 * @param i1 the row of interest
+		 * @param i2 the column of interest
+		 * @param bp the number of base pairs
+		 * @param E the energy to store
+		 * @param length the length encoding to store
+		 */
+		void
+		set( const size_t i1, const size_t i2, const size_t bp
+				, const E_type E, const size_t length );
 
-	//! defines the helix data {{ i1, i2, bp }} to acces elements of
-	//! the HelixRecMatrix
-	typedef boost::array<HelixRecMatrix::index, 3> HelixIndex;
+	protected:
+
+		//! number of rows kept
+		size_t rowNumber;
+		//! first column covered
+		size_t from2;
+		//! number of columns covered
+		size_t colNumber;
+		//! number of base pair counts stored per cell
+		size_t bpNumber;
+		//! smallest (most recently started) row available
+		size_t minRow;
+		//! largest row started since the last reset
+		size_t topRow;
+		//! whether or not any row was started since the last reset
+		bool hasRows;
+
+		//! energy plane
+		std::vector<E_type> energies;
+		//! length encoding plane
+		std::vector<length_type> lengths;
+
+		/**
+		 * Storage position of a cell of an available row
+		 * @param i1 the row of interest
+		 * @param i2 the column of interest
+		 * @param bp the number of base pairs
+		 * @return the storage index
+		 */
+		size_t
+		getIndex( const size_t i1, const size_t i2, const size_t bp ) const;
+	};
 
 	//! matrix to store the helix information for each helix left side (i1, i2)
 	//! it holds both the energy (first) as well as the length of the helix using
@@ -324,6 +430,38 @@ protected:
 	traceBackHelix( Interaction & interaction
 			, const size_t i1, const size_t i2, const size_t bp);
 
+	/**
+	 * Computes the recursion data of row i1 within helixE_rec for all
+	 * i2 in the given range. All rows needed by the recursion, i.e.
+	 * i1+1..i1+maxIL+1, have to be available within helixE_rec.
+	 *
+	 * @param i1 the helix left end in seq 1 (index including offset)
+	 * @param i2min the first helix left end in seq 2 (index including offset)
+	 * @param i2max the last helix left end in seq 2 (index including offset)
+	 * @param size1 the size of the current window in seq 1
+	 * @param size2 the size of the current window in seq 2
+	 */
+	void
+	fillHelixRec( const size_t i1, const size_t i2min, const size_t i2max
+				, const size_t size1, const size_t size2 );
+
+	/**
+	 * Recomputes the recursion data within helixE_rec for a block of
+	 * rows and columns starting at (i1,i2) that covers all helices
+	 * starting within the block's upper left corner as needed for traceback.
+	 *
+	 * @param i1 the helix left end in seq 1 (index without offset)
+	 * @param i2 the helix left end in seq 2 (index without offset)
+	 * @param extent1 the number of rows to recompute
+	 * @param extent2 the number of columns to recompute
+	 * @param size1 the size of the current window in seq 1
+	 * @param size2 the size of the current window in seq 2
+	 */
+	void
+	fillHelixRecBlock( const size_t i1, const size_t i2
+				, const size_t extent1, const size_t extent2
+				, const size_t size1, const size_t size2 );
+
 protected:
 
 	//! the used energy function
@@ -335,8 +473,9 @@ protected:
 	//! the recursion data for the computation of a helix interaction
 	//! bp: the number of bases
 	//! i1..(i1+bp-1) and i2..(i2+bp-1)
-	//! using the indexing [i1][i2][bp]
-	HelixRecMatrix helixE_rec;
+	//! using the indexing [i1][i2][bp] (window relative), where only the
+	//! rows needed by the current recursion or traceback are kept
+	HelixRecBuffer helixE_rec;
 
 	//! the helix mfe information for helix starting at (i1, i2)
 	HelixMatrix helix;
@@ -368,12 +507,12 @@ HelixHandlerUnpaired::HelixHandlerUnpaired(
 		:
 		energy(energy)
 		, helixConstraint(helixConstraint)
-		, seedHandler(seedHandler)
-		, helixE_rec( HelixIndex({{ 0, 0, 0 }}))
+		, helixE_rec()
 		, helix()
 		, helixSeed()
 		, offset1(0)
 		, offset2(0)
+		, seedHandler(seedHandler)
 {
 	if (seedHandler != NULL) {
 		setSeedHandler(*seedHandler);
@@ -492,8 +631,7 @@ getHelixLength1(const size_t i1, const size_t i2, const size_t bp) const {
 	if (bp <= 1) {
 		return 0;
 	} else {
-		return decodeHelixLength1(helixE_rec(HelixIndex(
-				{{(HelixRecMatrix::index) i1, (HelixRecMatrix::index) i2, (HelixRecMatrix::index) bp}})).second);
+		return decodeHelixLength1(helixE_rec.getLength(i1, i2, bp));
 	}
 }
 ////////////////////////////////////////////////////////////////////////////
@@ -507,8 +645,7 @@ getHelixLength2(const size_t i1, const size_t i2, const size_t bp) const
 	if (bp <= 1) {
 		return 0;
 	} else {
-		return decodeHelixLength2(helixE_rec(HelixIndex(
-				{{(HelixRecMatrix::index) i1, (HelixRecMatrix::index) i2, (HelixRecMatrix::index) bp}})).second);
+		return decodeHelixLength2(helixE_rec.getLength(i1, i2, bp));
 	}
 }
 
@@ -543,7 +680,7 @@ getHelixE(const size_t i1, const size_t i2, const size_t bp)
 	if (bp <= 1) {
 		return 0;
 	} else {
-		return helixE_rec(HelixIndex({{(HelixRecMatrix::index) i1, (HelixRecMatrix::index) i2, (HelixRecMatrix::index) bp}})).first;
+		return helixE_rec.getE(i1, i2, bp);
 	}
 }
 
@@ -554,10 +691,7 @@ void
 HelixHandlerUnpaired::
 setHelixPair(const size_t i1, const size_t i2, const size_t bp, const E_type E, const size_t length)
 {
-	helixE_rec( HelixIndex({{
-			(HelixRecMatrix::index) i1
-			, (HelixRecMatrix::index) i2
-			, (HelixRecMatrix::index) bp}}) ) = std::make_pair(E, E_isINF(E) ? 0 : length);
+	helixE_rec.set(i1, i2, bp, E, E_isINF(E) ? 0 : length);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -631,6 +765,123 @@ setSeedHandler(SeedHandler & seedHandler) {
 
 
 
+///////////////////////////////////////////////////////////////////////////
+
+inline
+HelixHandlerUnpaired::HelixRecBuffer::
+HelixRecBuffer()
+	: rowNumber(0)
+	, from2(0)
+	, colNumber(0)
+	, bpNumber(0)
+	, minRow(0)
+	, topRow(0)
+	, hasRows(false)
+	, energies()
+	, lengths()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+void
+HelixHandlerUnpaired::HelixRecBuffer::
+reset( const size_t rowNumber_, const size_t from2_
+		, const size_t colNumber_, const size_t bpNumber_ )
+{
+	rowNumber = rowNumber_;
+	from2 = from2_;
+	colNumber = colNumber_;
+	bpNumber = bpNumber_;
+	hasRows = false;
+	// (re)allocate only if needed, content is initialized by initRow()
+	energies.resize( rowNumber*colNumber*bpNumber );
+	lengths.resize( energies.size() );
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+void
+HelixHandlerUnpaired::HelixRecBuffer::
+initRow( const size_t i1 )
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (rowNumber == 0) throw std::runtime_error("HelixHandlerUnpaired::HelixRecBuffer::initRow() : no rows allocated");
+	if (hasRows && i1 >= minRow) throw std::runtime_error("HelixHandlerUnpaired::HelixRecBuffer::initRow("+toString(i1)+") : rows have to be filled in decreasing order (last "+toString(minRow)+")");
+#endif
+	if (!hasRows) {
+		topRow = i1;
+		hasRows = true;
+	}
+	minRow = i1;
+	// clear the storage slot of the row
+	const size_t rowSize = colNumber*bpNumber;
+	const size_t start = (i1 % rowNumber)*rowSize;
+	std::fill( energies.begin()+start, energies.begin()+start+rowSize, E_INF );
+	std::fill( lengths.begin()+start, lengths.begin()+start+rowSize, length_type(0) );
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+HelixHandlerUnpaired::HelixRecBuffer::
+isAvailable( const size_t i1, const size_t i2 ) const
+{
+	return hasRows
+			&& i1 >= minRow && i1 <= topRow && i1-minRow < rowNumber
+			&& i2 >= from2 && i2-from2 < colNumber;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+HelixHandlerUnpaired::HelixRecBuffer::
+getIndex( const size_t i1, const size_t i2, const size_t bp ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (!isAvailable(i1,i2)) throw std::runtime_error("HelixHandlerUnpaired::HelixRecBuffer::getIndex("+toString(i1)+","+toString(i2)+") : cell not available");
+	if (bp >= bpNumber) throw std::runtime_error("HelixHandlerUnpaired::HelixRecBuffer::getIndex(bp="+toString(bp)+") : out of range (<"+toString(bpNumber)+")");
+#endif
+	return ((i1 % rowNumber)*colNumber + (i2-from2))*bpNumber + bp;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+HelixHandlerUnpaired::HelixRecBuffer::
+getE( const size_t i1, const size_t i2, const size_t bp ) const
+{
+	return isAvailable(i1,i2) ? energies[getIndex(i1,i2,bp)] : E_INF;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+HelixHandlerUnpaired::HelixRecBuffer::
+getLength( const size_t i1, const size_t i2, const size_t bp ) const
+{
+	return isAvailable(i1,i2) ? lengths[getIndex(i1,i2,bp)] : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline
+void
+HelixHandlerUnpaired::HelixRecBuffer::
+set( const size_t i1, const size_t i2, const size_t bp
+		, const E_type E, const size_t length )
+{
+	const size_t idx = getIndex(i1,i2,bp);
+	energies[idx] = E;
+	lengths[idx] = length_type(length);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 } // namespace
@@ -2,6 +2,9 @@
 #include "IntaRNA/InteractionEnergy.h"
 
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 #include <iostream>
 
@@ -49,5 +52,62 @@ getE_contributions( const Interaction & interaction ) const
 
 ////////////////////////////////////////////////////////////////////////////
 
+E_type
+InteractionEnergy::
+getEnsembleShiftAuto() const
+{
+	// maximal exponent of Boltzmann weights that is considered safe, i.e.
+	// half of the Z_type range is kept to account for the summation of weights
+	const Z_type maxExponent = Z_log( std::numeric_limits<Z_type>::max() ) / Z_type(2);
+
+	// lower bound of the hybridization energy based on the maximal number of base pairs
+	const size_t maxBP = std::min( getAccessibility1().getMaxLength(), getAccessibility2().getMaxLength() );
+	const E_type lowerBound = getE_init() + (maxBP>1 ? E_type(maxBP-1) * std::min( E_type(0), getBestE_interLeft() ) : E_type(0));
+	// check if no overflow possible
+	if ( - E_2_Z(lowerBound) / getRT() < maxExponent ) {
+		return E_type(0);
+	}
+
+	// compute minimal hybridization energy of any interaction; only the rows
+	// reachable via a single interior loop are stored
+	const size_t n1 = size1(), n2 = size2();
+	const size_t rows = getMaxInternalLoopSize1()+2;
+	std::vector< E_type > hybridE( rows*n2, E_INF );
+	E_type minE = E_INF;
+	for (size_t i1 = n1; i1-- > 0; ) {
+		E_type * curRow = &(hybridE[ (i1%rows)*n2 ]);
+		for (size_t i2 = n2; i2-- > 0; ) {
+			E_type & curE = curRow[i2];
+			curE = E_INF;
+			if (!areComplementary(i1,i2)) {
+				continue;
+			}
+			// single base pair
+			curE = getE_init();
+			// extension via an interior loop to the right
+			for (size_t k1=i1+1; k1<n1 && k1<=i1+1+getMaxInternalLoopSize1(); k1++) {
+				const E_type * kRow = &(hybridE[ (k1%rows)*n2 ]);
+				for (size_t k2=i2+1; k2<n2 && k2<=i2+1+getMaxInternalLoopSize2(); k2++) {
+					if (E_isINF(kRow[k2])) {
+						continue;
+					}
+					const E_type loopE = getE_interLeft(i1,k1,i2,k2);
+					if (E_isNotINF(loopE)) {
+						curE = std::min( curE, loopE + kRow[k2] );
+					}
+				}
+			}
+			minE = std::min( minE, curE );
+		}
+	}
+
+	// check if scaling is needed
+	if ( E_isINF(minE) || - E_2_Z(minE) / getRT() < maxExponent ) {
+		return E_type(0);
+	}
+	return minE;
+}
+
+////////////////////////////////////////////////////////////////////////////
 
 } // namespace
@@ -349,6 +349,18 @@ public:
 	E_type
 	getE_interLeft( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const = 0;
 
+	/**
+	 * Provides a lower bound of the energy of any single interaction loop,
+	 * i.e. of any value getE_interLeft() can return, independently of the
+	 * sequence positions involved. It is used to bound the hybridization
+	 * energy of interactions with a given number of base pairs.
+	 *
+	 * @return lower bound of any finite getE_interLeft() value
+	 */
+	virtual
+	E_type
+	getBestE_interLeft() const = 0;
+
 
 	/**
 	 * Computes the dangling end energy penalties for the left side
@@ -498,6 +510,74 @@ public:
 	Z_type
 	getBoltzmannWeight( const Z_type energy ) const ;
 
+	/**
+	 * Sets the energy shift used to scale the Boltzmann weights of whole
+	 * interactions within partition function computations (see
+	 * getBoltzmannWeightScaled()). A shift close to the expected minimal
+	 * interaction energy keeps all partition functions within the range of
+	 * Z_type without the need of a multiprecision data type.
+	 *
+	 * Note: all partition functions of interactions (e.g. Zall) are scaled by
+	 * exp( ensembleShift / RT ), which cancels out within probabilities.
+	 *
+	 * @param ensembleShift the energy shift to be used (0 = no scaling)
+	 */
+	void
+	setEnsembleShift( const E_type ensembleShift );
+
+	/**
+	 * Derives an energy shift for partition function scaling (see
+	 * setEnsembleShift()) from the minimal hybridization energy of any
+	 * interaction, similar to the pf_scale of the Vienna package that is
+	 * derived from the minimum free energy.
+	 *
+	 * Scaling is only applied if the Boltzmann weights of the sequences'
+	 * interactions can exceed the range of Z_type. To this end, a lower bound
+	 * of the hybridization energy based on the maximal number of base pairs
+	 * is checked first. Only if this bound is critical, the minimal
+	 * hybridization energy (without ED, dangling end and end contributions)
+	 * is computed in O(size1*size2*maxInternalLoopSize1*maxInternalLoopSize2)
+	 * time and linear space.
+	 *
+	 * @return the minimal hybridization energy if scaling is needed to avoid
+	 *         partition function overflows; 0 otherwise
+	 */
+	E_type
+	getEnsembleShiftAuto() const;
+
+	/**
+	 * Access to the energy shift used to scale partition functions of
+	 * interactions (see setEnsembleShift())
+	 * @return the energy shift
+	 */
+	virtual
+	E_type
+	getEnsembleShift() const;
+
+	/**
+	 * Provides the scaled Boltzmann weight of a whole interaction, i.e.
+	 * exp( - (energy - ensembleShift) / RT ).
+	 *
+	 * Use this function for all Boltzmann weights that are summed to
+	 * partition functions of interactions; individual loop terms have to be
+	 * unscaled (getBoltzmannWeight()).
+	 *
+	 * @param energy the energy of the interaction (internal representation)
+	 * @return the scaled Boltzmann weight
+	 */
+	Z_type
+	getBoltzmannWeightScaled( const E_type energy ) const;
+
+	/**
+	 * Provides the ensemble energy (in internal energy representation)
+	 * for a given scaled partition function (see getBoltzmannWeightScaled())
+	 *
+	 * @param Zscaled the scaled partition function to convert
+	 * @return E = -RT * log( Zscaled ) + ensembleShift
+	 */
+	E_type
+	getE_scaled( const Z_type Zscaled ) const;
+
 
 	/**
 	 * Provides the base pair encoding for the given indices.
@@ -536,6 +616,14 @@ public:
 	E_type
 	getEnergyAdd() const;
 
+	/**
+	 * Whether or not dangling end contributions are added to the overall
+	 * energy of an interaction (see getE())
+	 * @return true if dangling end contributions are considered
+	 */
+	bool
+	isEnergyWithDangles() const;
+
 	/**
 	 * Checks whether or not the given indices mark valid internal loop
 	 * boundaries, i.e.
@@ -607,6 +695,9 @@ protected:
 	//! whether or not GU base pairs allowed in internal loops
 	const bool internalLoopGU;
 
+	//! energy shift used to scale partition functions of interactions
+	E_type ensembleShift;
+
 	/**
 	 * Checks whether or not the given indices are valid index region within the
 	 * sequence for an intermolecular loop and do not violate the maximal
@@ -652,6 +743,7 @@ InteractionEnergy::InteractionEnergy( const Accessibility & accS1
 	, energyAdd(energyAdd)
 	, energyWithDangles(energyWithDangles)
 	, internalLoopGU(internalLoopGU)
+	, ensembleShift(0)
 {
 }
 
@@ -780,6 +872,16 @@ getEnergyAdd() const
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+bool
+InteractionEnergy::
+isEnergyWithDangles() const
+{
+	return energyWithDangles;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 inline
 Z_type
 InteractionEnergy::
@@ -802,6 +904,46 @@ getBoltzmannWeight( const Z_type e ) const
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+void
+InteractionEnergy::
+setEnsembleShift( const E_type ensembleShift )
+{
+	this->ensembleShift = ensembleShift;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergy::
+getEnsembleShift() const
+{
+	return ensembleShift;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+Z_type
+InteractionEnergy::
+getBoltzmannWeightScaled( const E_type e ) const
+{
+	return getBoltzmannWeight( e - getEnsembleShift() );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergy::
+getE_scaled( const Z_type Zscaled ) const
+{
+	return getE( Zscaled ) + getEnsembleShift();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 inline
 Interaction::BasePair
 InteractionEnergy::
@@ -167,6 +167,16 @@ public:
 	E_type
 	getE_interLeft( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const;
 
+	/**
+	 * Provides the energy of any interaction loop, which is the
+	 * base pair energy.
+	 *
+	 * @return the base pair energy
+	 */
+	virtual
+	E_type
+	getBestE_interLeft() const;
+
 	/**
 	 * Computes the dangling end energy penalty estimate for the left side of
 	 * an interaction loop region closed on the left by the intermolecular
@@ -435,6 +445,17 @@ getE_interLeft( const size_t i1, const size_t j1, const size_t i2, const size_t
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+E_type
+InteractionEnergyBasePair::
+getBestE_interLeft() const
+{
+	// each loop closes exactly one base pair
+	return basePairEnergy;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 inline
 E_type
 InteractionEnergyBasePair::
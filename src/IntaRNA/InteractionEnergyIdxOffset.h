@@ -56,6 +56,12 @@ public:
 	 */
 	void setOffset2(size_t offset2);
 
+	/**
+	 * Access to the wrapped energy object that works on original indices
+	 * @return the wrapped energy object
+	 */
+	const InteractionEnergy & getEnergyOriginal() const;
+
 
 	/**
 	 * Provides the overall energy for an interaction from [i1,j1] in the first
@@ -308,6 +314,16 @@ public:
 	E_type
 	getE_interLeft( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const;
 
+	/**
+	 * Provides a lower bound of the energy of any single interaction loop
+	 * of the original energy handler.
+	 *
+	 * @return energyOriginal.getBestE_interLeft()
+	 */
+	virtual
+	E_type
+	getBestE_interLeft() const;
+
 
 	/**
 	 * Computes the dangling end energy penalties for the left side
@@ -417,6 +433,15 @@ public:
 	Z_type
 	getRT() const;
 
+	/**
+	 * Access to the energy shift used to scale partition functions of
+	 * interactions
+	 * @return the energy shift of the original energy handler
+	 */
+	virtual
+	E_type
+	getEnsembleShift() const;
+
 	/**
 	 * Provides the base pair encoding for the given indices after shifting by
 	 * the used offset
@@ -588,6 +613,16 @@ setOffset2(size_t offset2)
 
 //////////////////////////////////////////////////////////////////////////
 
+inline
+const InteractionEnergy &
+InteractionEnergyIdxOffset::
+getEnergyOriginal() const
+{
+	return energyOriginal;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 inline
 E_type
 InteractionEnergyIdxOffset::
@@ -737,6 +772,16 @@ getE_interLeft( const size_t i1, const size_t j1, const size_t i2, const size_t
 	return energyOriginal.getE_interLeft(i1+offset1, j1+offset1, i2+offset2, j2+offset2);
 }
 
+//////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergyIdxOffset::
+getBestE_interLeft() const
+{
+	return energyOriginal.getBestE_interLeft();
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -846,6 +891,16 @@ getRT() const
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+E_type
+InteractionEnergyIdxOffset::
+getEnsembleShift() const
+{
+	return energyOriginal.getEnsembleShift();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 inline
 E_type
 InteractionEnergyIdxOffset::
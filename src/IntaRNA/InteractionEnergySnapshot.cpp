@@ -0,0 +1,107 @@
+
+#include "IntaRNA/InteractionEnergySnapshot.h"
+
+#include <algorithm>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////////
+
+InteractionEnergySnapshot::
+InteractionEnergySnapshot( const InteractionEnergyIdxOffset & energy )
+	: energy(energy)
+	, energyOriginal(energy.getEnergyOriginal())
+	, offset1(0)
+	, offset2(0)
+	, size1(0)
+	, size2(0)
+	, seqSize1(energyOriginal.size1())
+	, seqSize2(energyOriginal.size2())
+	, RT(energyOriginal.getRT())
+	, withDangles(energyOriginal.isEnergyWithDangles())
+	, energyAdd(energyOriginal.getEnergyAdd())
+	, ed1()
+	, ed2()
+{
+	clear();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+InteractionEnergySnapshot::
+~InteractionEnergySnapshot()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+InteractionEnergySnapshot::
+init( const size_t size1_, const size_t size2_ )
+{
+	// store window
+	offset1 = energy.getOffset1();
+	offset2 = energy.getOffset2();
+	size1 = std::min( size1_, seqSize1-offset1 );
+	size2 = std::min( size2_, seqSize2-offset2 );
+
+	// materialize ED values
+	fillRows( ed1, offset1, size1, seqSize1
+			, energyOriginal.getAccessibility1().getMaxLength()
+			, &InteractionEnergy::getED1 );
+	fillRows( ed2, offset2, size2, seqSize2
+			, energyOriginal.getAccessibility2().getMaxLength()
+			, &InteractionEnergy::getED2 );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+InteractionEnergySnapshot::
+clear()
+{
+	size1 = 0;
+	size2 = 0;
+	ed1.from = ed1.to = ed1.rows = ed1.width = 0;
+	ed1.ed.clear();
+	ed2.from = ed2.to = ed2.rows = ed2.width = 0;
+	ed2.ed.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+InteractionEnergySnapshot::
+fillRows( EDrows & rows
+		, const size_t offset
+		, const size_t size
+		, const size_t seqSize
+		, const size_t maxLength
+		, E_type (InteractionEnergy::*getED)( const size_t, const size_t ) const )
+{
+	if (size == 0) {
+		rows.from = rows.to = rows.rows = rows.width = 0;
+		rows.ed.clear();
+		return;
+	}
+	// include left neighbor for dangling end probabilities
+	rows.from = (offset > 0) ? offset-1 : offset;
+	rows.rows = offset+size-rows.from;
+	// include right neighbor for dangling end probabilities
+	rows.to = std::min( offset+size, seqSize-1 );
+	rows.width = std::min( rows.to-rows.from+1, maxLength );
+	rows.ed.resize( rows.rows*rows.width );
+
+	for (size_t r=0; r<rows.rows; r++) {
+		const size_t i = rows.from+r;
+		const size_t jMax = std::min( rows.to, i+rows.width-1 );
+		E_type * row = &(rows.ed[r*rows.width]);
+		for (size_t j=i; j<=jMax; j++) {
+			row[j-i] = (energyOriginal.*getED)( i, j );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
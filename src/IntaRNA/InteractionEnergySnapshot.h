@@ -0,0 +1,412 @@
+
+#ifndef INTARNA_INTERACTIONENERGYSNAPSHOT_H_
+#define INTARNA_INTERACTIONENERGYSNAPSHOT_H_
+
+#include "IntaRNA/general.h"
+#include "IntaRNA/InteractionEnergyIdxOffset.h"
+
+#include <vector>
+
+namespace IntaRNA {
+
+/**
+ * Flattened view of the accessibility-based energy terms of a prediction
+ * window.
+ *
+ * A single ED lookup within the DP is dispatched through the index offset
+ * wrapper, the energy function, the (reversed) accessibility and its
+ * underlying storage, each with its own index checks. The snapshot
+ * materializes the ED values of all subsequences of the window (including
+ * the neighbored positions needed for dangling end probabilities) once via
+ * init() into plain row-major arrays, such that the overall energy of an
+ * interaction (see InteractionEnergy::getE()) can be computed with direct
+ * array access for the ED and dangling end probability terms.
+ *
+ * Index pairs not covered by the snapshot (e.g. subsequences exceeding the
+ * maximal accessibility length or an empty snapshot) are transparently
+ * forwarded to the energy function.
+ *
+ * All indices are given in the index space of the energy function, i.e.
+ * relative to its offsets at the time of init().
+ *
+ * @author Martin Mann
+ *
+ */
+class InteractionEnergySnapshot {
+
+public:
+
+	/**
+	 * Creates an empty snapshot for the given energy function
+	 *
+	 * @param energy the energy function to get the energy terms from, which
+	 *        has to exist as long as the snapshot is used
+	 */
+	InteractionEnergySnapshot( const InteractionEnergyIdxOffset & energy );
+
+	/**
+	 * destruction
+	 */
+	virtual ~InteractionEnergySnapshot();
+
+	/**
+	 * Fills the snapshot for the window starting at the current offsets of
+	 * the energy function.
+	 *
+	 * NOTE: the offsets of the energy function must not be altered as long
+	 * as the snapshot is used; call init() or clear() afterwards.
+	 *
+	 * @param size1 the number of positions of the window in seq1 (truncated
+	 *        to the sequence length)
+	 * @param size2 the number of positions of the window in seq2 (truncated
+	 *        to the sequence length)
+	 */
+	void
+	init( const size_t size1
+			, const size_t size2 );
+
+	/**
+	 * Removes all information, such that all calls are forwarded to the
+	 * energy function
+	 */
+	void
+	clear();
+
+	/**
+	 * Provides the ED penalty for making a region within seq1 accessible
+	 * (see InteractionEnergy::getED1())
+	 * @param i1 the start of the accessible region
+	 * @param j1 the end of the accessible region
+	 * @return the ED value for [i1,j1]
+	 */
+	E_type
+	getED1( const size_t i1, const size_t j1 ) const;
+
+	/**
+	 * Provides the ED penalty for making a region within seq2 accessible
+	 * (see InteractionEnergy::getED2())
+	 * @param i2 the start of the accessible region
+	 * @param j2 the end of the accessible region
+	 * @return the ED value for [i2,j2]
+	 */
+	E_type
+	getED2( const size_t i2, const size_t j2 ) const;
+
+	/**
+	 * Probability that the left dangling ends of an interaction are unpaired
+	 * (see InteractionEnergy::getPr_danglingLeft())
+	 * @param i1 the index of the first sequence interacting with i2
+	 * @param j1 the index of the first sequence interacting with j2 with i1<=j1
+	 * @param i2 the index of the second sequence interacting with i1
+	 * @param j2 the index of the second sequence interacting with j1 with i2<=j2
+	 * @return the probability of the left dangling ends to be unpaired
+	 */
+	Z_type
+	getPr_danglingLeft( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const;
+
+	/**
+	 * Probability that the right dangling ends of an interaction are unpaired
+	 * (see InteractionEnergy::getPr_danglingRight())
+	 * @param i1 the index of the first sequence interacting with i2
+	 * @param j1 the index of the first sequence interacting with j2 with i1<=j1
+	 * @param i2 the index of the second sequence interacting with i1
+	 * @param j2 the index of the second sequence interacting with j1 with i2<=j2
+	 * @return the probability of the right dangling ends to be unpaired
+	 */
+	Z_type
+	getPr_danglingRight( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const;
+
+	/**
+	 * Computes the overall energy of an interaction given its hybridization
+	 * energy (see InteractionEnergy::getE()). Dangling end and helix end
+	 * energies depend on the base pairs and are taken from the energy function.
+	 *
+	 * @param i1 the index of the first sequence interacting with i2
+	 * @param j1 the index of the first sequence interacting with j2 with i1<=j1
+	 * @param i2 the index of the second sequence interacting with i1
+	 * @param j2 the index of the second sequence interacting with j1 with i2<=j2
+	 * @param hybridE the hybridization energy of the interaction
+	 * @return the overall energy of the interaction or E_INF if not possible
+	 */
+	E_type
+	getE( const size_t i1, const size_t j1
+			, const size_t i2, const size_t j2
+			, const E_type hybridE ) const;
+
+protected:
+
+	/**
+	 * Row-major storage of the ED values of all subsequences of a window
+	 * in the original index space, i.e. the value for [i,j] is stored in
+	 * row (i-from) at column (j-i) if j<=to.
+	 */
+	struct EDrows {
+		//! first original index covered
+		size_t from;
+		//! last original index covered
+		size_t to;
+		//! number of rows
+		size_t rows;
+		//! number of columns, i.e. maximal covered (j-i)+1
+		size_t width;
+		//! the ED values
+		std::vector<E_type> ed;
+	};
+
+	//! the energy function to get the energy terms from
+	const InteractionEnergyIdxOffset & energy;
+
+	//! the wrapped energy function working on original indices
+	const InteractionEnergy & energyOriginal;
+
+	//! index offset of the window in seq1
+	size_t offset1;
+
+	//! index offset of the window in seq2
+	size_t offset2;
+
+	//! number of covered window positions in seq1
+	size_t size1;
+
+	//! number of covered window positions in seq2
+	size_t size2;
+
+	//! length of seq1
+	size_t seqSize1;
+
+	//! length of seq2
+	size_t seqSize2;
+
+	//! the normalized temperature for Boltzmann weight computation
+	Z_type RT;
+
+	//! whether or not dangling end contributions are considered
+	bool withDangles;
+
+	//! the energy shift added to each interaction energy
+	E_type energyAdd;
+
+	//! ED values for seq1
+	EDrows ed1;
+
+	//! ED values for seq2
+	EDrows ed2;
+
+	/**
+	 * Fills the ED rows for a window of a sequence
+	 * @param rows the container to fill
+	 * @param offset the original index of the first window position
+	 * @param size the number of window positions
+	 * @param seqSize the length of the sequence
+	 * @param maxLength the maximal length of accessible regions
+	 * @param getED the energy function's ED access for this sequence
+	 */
+	void
+	fillRows( EDrows & rows
+			, const size_t offset
+			, const size_t size
+			, const size_t seqSize
+			, const size_t maxLength
+			, E_type (InteractionEnergy::*getED)( const size_t, const size_t ) const );
+
+	/**
+	 * Provides the ED value of seq1 in original index space
+	 * @param i the start of the region (original index)
+	 * @param j the end of the region (original index)
+	 * @return the ED value for [i,j]
+	 */
+	E_type
+	getOrigED1( const size_t i, const size_t j ) const;
+
+	/**
+	 * Provides the ED value of seq2 in original index space
+	 * @param i the start of the region (original index)
+	 * @param j the end of the region (original index)
+	 * @return the ED value for [i,j]
+	 */
+	E_type
+	getOrigED2( const size_t i, const size_t j ) const;
+
+	/**
+	 * Checks whether or not a region is stored within the given rows
+	 * @param rows the rows to check
+	 * @param i the start of the region (original index)
+	 * @param j the end of the region (original index)
+	 * @return true if the ED value of [i,j] is stored; false otherwise
+	 */
+	static
+	bool
+	isStored( const EDrows & rows, const size_t i, const size_t j );
+
+	/**
+	 * Provides the probability of a dangling position to be unpaired given
+	 * the ED difference of the regions with and without it
+	 * @param edDiff the ED difference
+	 * @return the probability clipped to [0,1]
+	 */
+	Z_type
+	getPr_unpaired( const E_type edDiff ) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+InteractionEnergySnapshot::
+isStored( const EDrows & rows, const size_t i, const size_t j )
+{
+	return i >= rows.from && i-rows.from < rows.rows
+		&& j >= i && j <= rows.to && j-i < rows.width;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergySnapshot::
+getOrigED1( const size_t i, const size_t j ) const
+{
+	if (isStored( ed1, i, j )) {
+		return ed1.ed[ (i-ed1.from)*ed1.width + (j-i) ];
+	}
+	return energyOriginal.getED1( i, j );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergySnapshot::
+getOrigED2( const size_t i, const size_t j ) const
+{
+	if (isStored( ed2, i, j )) {
+		return ed2.ed[ (i-ed2.from)*ed2.width + (j-i) ];
+	}
+	return energyOriginal.getED2( i, j );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergySnapshot::
+getED1( const size_t i1, const size_t j1 ) const
+{
+	if (j1 < size1) {
+		return getOrigED1( i1+offset1, j1+offset1 );
+	}
+	return energy.getED1( i1, j1 );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergySnapshot::
+getED2( const size_t i2, const size_t j2 ) const
+{
+	if (j2 < size2) {
+		return getOrigED2( i2+offset2, j2+offset2 );
+	}
+	return energy.getED2( i2, j2 );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+Z_type
+InteractionEnergySnapshot::
+getPr_unpaired( const E_type edDiff ) const
+{
+	return std::max( (Z_type)0.0
+				, std::min( (Z_type)1.0
+						, Z_exp( - E_2_Z(edDiff) / RT )
+						)
+				);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+Z_type
+InteractionEnergySnapshot::
+getPr_danglingLeft( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const
+{
+	if (j1 >= size1 || j2 >= size2) {
+		return energy.getPr_danglingLeft( i1, j1, i2, j2 );
+	}
+	// original indices
+	const size_t oi1 = i1+offset1, oj1 = j1+offset1, oi2 = i2+offset2, oj2 = j2+offset2;
+	// Pr( i-1 is unpaired | i..j unpaired ) if dangle possible
+	return (oi1>0 ? getPr_unpaired( getOrigED1(oi1-1,oj1)-getOrigED1(oi1,oj1) ) : (Z_type)1.0)
+		*  (oi2>0 ? getPr_unpaired( getOrigED2(oi2-1,oj2)-getOrigED2(oi2,oj2) ) : (Z_type)1.0);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+Z_type
+InteractionEnergySnapshot::
+getPr_danglingRight( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const
+{
+	if (j1 >= size1 || j2 >= size2) {
+		return energy.getPr_danglingRight( i1, j1, i2, j2 );
+	}
+	// original indices
+	const size_t oi1 = i1+offset1, oj1 = j1+offset1, oi2 = i2+offset2, oj2 = j2+offset2;
+	// Pr( j+1 is unpaired | i..j unpaired ) if dangle possible
+	return (oj1+1<seqSize1 ? getPr_unpaired( getOrigED1(oi1,oj1+1)-getOrigED1(oi1,oj1) ) : (Z_type)1.0)
+		*  (oj2+1<seqSize2 ? getPr_unpaired( getOrigED2(oi2,oj2+1)-getOrigED2(oi2,oj2) ) : (Z_type)1.0);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+E_type
+InteractionEnergySnapshot::
+getE( const size_t i1, const size_t j1
+		, const size_t i2, const size_t j2
+		, const E_type hybridE ) const
+{
+	// forward if not covered
+	if (j1 >= size1 || j2 >= size2) {
+		return energy.getE( i1, j1, i2, j2, hybridE );
+	}
+
+	// check if hybridization energy is not infinite
+	if (E_isINF(hybridE)) {
+		return E_INF;
+	}
+	// check if EDs are not infinite
+	const E_type curED1 = getED1( i1, j1 );
+	const E_type curED2 = getED2( i2, j2 );
+	if ( curED1 >= Accessibility::ED_UPPER_BOUND || curED2 >= Accessibility::ED_UPPER_BOUND ) {
+		return E_INF;
+	}
+
+	// original indices
+	const size_t oi1 = i1+offset1, oj1 = j1+offset1, oi2 = i2+offset2, oj2 = j2+offset2;
+
+	// compute overall interaction energy
+	return hybridE
+			// accessibility penalty
+			+ curED1
+			+ curED2
+			// dangling end penalty
+			// weighted by the probability that ends are unpaired
+			+ (withDangles ? Z_2_E(E_2_Z(energyOriginal.getE_danglingLeft( oi1, oi2 ))*getPr_danglingLeft(i1,j1,i2,j2)) : E_type(0))
+			+ (withDangles ? Z_2_E(E_2_Z(energyOriginal.getE_danglingRight( oj1, oj2 ))*getPr_danglingRight(i1,j1,i2,j2)) : E_type(0))
+			// helix closure penalty
+			+ energyOriginal.getE_endLeft( oi1, oi2 )
+			+ energyOriginal.getE_endRight( oj1, oj2 )
+			+ energyAdd
+			;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_INTERACTIONENERGYSNAPSHOT_H_ */
@@ -1,6 +1,7 @@
 
 #include "IntaRNA/InteractionEnergyVrna.h"
 #include "IntaRNA/AccessibilityVrna.h"
+#include "IntaRNA/Profiler.h"
 
 #include <cassert>
 #include <set>
@@ -44,6 +45,7 @@ InteractionEnergyVrna::InteractionEnergyVrna(
 	, esValues2(NULL)
 	, Eall1(E_INF)
 	, Eall2(E_INF)
+	, bestE_interLeft(E_INF)
 {
 	vrna_md_defaults_reset( &foldModel );
 
@@ -66,6 +68,48 @@ InteractionEnergyVrna::InteractionEnergyVrna(
 
 ////////////////////////////////////////////////////////////////////////////
 
+E_type
+InteractionEnergyVrna::
+getBestE_interLeft() const
+{
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_bestEinterLeft)
+#endif
+	if (E_isINF(bestE_interLeft)) {
+		// nucleotide codes (including 'N') to enumerate
+		const int maxCode = 4;
+		int minE = std::numeric_limits<int>::max();
+		// enumerate closing base pairs (x1,x2) and enclosed base pairs (y1,y2)
+		for (int x1=0; x1<=maxCode; x1++) {
+		for (int x2=0; x2<=maxCode; x2++) {
+			const int type = BP_pair[x1][x2];
+			if (type == 0) continue;
+		for (int y1=0; y1<=maxCode; y1++) {
+		for (int y2=0; y2<=maxCode; y2++) {
+			const int type2 = BP_pair[y2][y1];
+			if (type2 == 0) continue;
+			// enumerate loop sizes
+			for (int u1=0; u1<=(int)maxInternalLoopSize1; u1++) {
+			for (int u2=0; u2<=(int)maxInternalLoopSize2; u2++) {
+				// stacking and bulges do not depend on mismatch context
+				const int maxM = (u1==0 || u2==0) ? 0 : maxCode;
+				for (int m1=0; m1<=maxM; m1++) {
+				for (int m2=0; m2<=maxM; m2++) {
+				// within 1-nt loops both mismatches are the same nucleotide
+				for (int n1=(u1==1?m1:0); n1<=(u1==1?m1:maxM); n1++) {
+				for (int n2=(u2==1?m2:0); n2<=(u2==1?m2:maxM); n2++) {
+					minE = std::min( minE, E_IntLoop( u1, u2, type, type2, m1, m2, n1, n2, foldParams ) );
+				}}}}
+			}}
+		}}
+		}}
+		bestE_interLeft = Evrna_2_E(minE);
+	}
+	return bestE_interLeft;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 InteractionEnergyVrna::~InteractionEnergyVrna()
 {
 	// garbage collection
@@ -85,12 +129,45 @@ void
 InteractionEnergyVrna::
 computeES( const Accessibility & acc, InteractionEnergyVrna::EsMatrix & esToFill )
 {
-
-	// prepare container
-	esToFill.resize( acc.getSequence().size(), acc.getSequence().size() );
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::ES_COMPUTATION );
 
 	// sequence length
-	const int seqLength = (int)acc.getSequence().size();
+	const size_t seqLength = acc.getSequence().size();
+	// maximal length of subsequences to be considered
+	const size_t maxLength = std::max( (size_t)1, std::min( acc.getMaxLength(), seqLength ) );
+
+	// prepare container (band of all subsequences up to maxLength)
+	esToFill.resize( seqLength, maxLength );
+
+	// length of the windows to be folded; each window provides the ES values
+	// of all subsequences that are not at its (artificial) boundaries
+	const size_t windowLength = 4*maxLength;
+
+	// fill ES values of all subsequences starting within [from,to)
+	for (size_t from = 0, to = 0; from < seqLength; from = to) {
+		// window covering [from-1, from-1+windowLength) to provide the left
+		// neighbor of each subsequence
+		const size_t winStart = (from == 0) ? 0 : from-1;
+		const size_t winEnd = std::min( seqLength, winStart+windowLength );
+		// all subsequences starting before to have their right neighbor
+		// within the window
+		to = (winEnd == seqLength) ? seqLength : winEnd-maxLength;
+		computeES( acc, winStart, winEnd, from, to, esToFill );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+InteractionEnergyVrna::
+computeES( const Accessibility & acc
+		, const size_t winStart, const size_t winEnd
+		, const size_t from, const size_t to
+		, InteractionEnergyVrna::EsMatrix & esToFill )
+{
+	// window length
+	const int seqLength = (int)(winEnd-winStart);
 	const Z_type RT = getRT();
 
 	// VRNA compatible data structures
@@ -98,9 +175,9 @@ computeES( const Accessibility & acc, InteractionEnergyVrna::EsMatrix & esToFill
 	char * structureConstraint = (char *) vrna_alloc(sizeof(char) * (seqLength + 1));
 	for (int i=0; i<seqLength; i++) {
 		// copy sequence
-		sequence[i] = acc.getSequence().asString().at(i);
+		sequence[i] = acc.getSequence().asString().at(winStart+i);
 		// copy accessibility constraint if present
-		structureConstraint[i] = acc.getAccConstraint().getVrnaDotBracket(i);
+		structureConstraint[i] = acc.getAccConstraint().getVrnaDotBracket(winStart+i);
 	}
 	sequence[seqLength] = structureConstraint[seqLength] = '\0';
 	// prepare folding data
@@ -111,8 +188,7 @@ computeES( const Accessibility & acc, InteractionEnergyVrna::EsMatrix & esToFill
 	if (curModel.max_bp_span >= (int)acc.getSequence().size()) {
 		curModel.max_bp_span = -1;
 	}
-	// TODO check if VRNA_OPTION_WINDOW reasonable to speedup
-	vrna_fold_compound_t * foldData = vrna_fold_compound( sequence, &foldModel, VRNA_OPTION_PF);
+	vrna_fold_compound_t * foldData = vrna_fold_compound( sequence, &curModel, VRNA_OPTION_PF);
 
 	// Adding hard constraints from pseudo dot-bracket
 	unsigned int constraint_options = VRNA_CONSTRAINT_DB_DEFAULT;
@@ -137,22 +213,23 @@ computeES( const Accessibility & acc, InteractionEnergyVrna::EsMatrix & esToFill
 	// copy ensemble energies of multi loop parts = ES values
 	FLT_OR_DBL qm_val = 0.0;
 	const int minLoopSubseqLength = foldModel.min_loop_size + 2;
-	for (int i=0; i<seqLength; i++) {
-		for (int j=i; j<seqLength; j++) {
+	const int wFrom = (int)(from-winStart), wTo = (int)(to-winStart);
+	for (int i=wFrom; i<wTo; i++) {
+		for (int j=i; j<seqLength && j-i < (int)esToFill.getWidth(); j++) {
 			// check if too short to enable a base pair
 			if (j-i+1 < minLoopSubseqLength) {
 				// make unfavorable
-				esToFill(i,j) = E_INF;
+				esToFill.set(winStart+i, winStart+j, E_INF);
 			} else {
 				// get Qm value
 				// indexing via iindx starts with 1 instead of 0
-				qm_val = foldData->exp_matrices->qm[foldData->iindx[i+1]-j+1];
+				qm_val = foldData->exp_matrices->qm[foldData->iindx[i+1]-(j+1)];
 				if ( Z_equal(Z_type(qm_val), Z_type(0)) ) {
-					esToFill(i,j) = E_INF;
+					esToFill.set(winStart+i, winStart+j, E_INF);
 				} else {
 					// ES energy = -RT*log( Qm )
-					esToFill(i,j) =  Z_2_E( - RT* Z_type( std::log(qm_val)
-													+((FLT_OR_DBL)(j-i+1))*std::log(foldData->exp_params->pf_scale)));
+					esToFill.set(winStart+i, winStart+j, Z_2_E( - RT* Z_type( std::log(qm_val)
+													+((FLT_OR_DBL)(j-i+1))*std::log(foldData->exp_params->pf_scale))));
 				}
 			}
 		}
@@ -4,6 +4,7 @@
 
 #include "IntaRNA/InteractionEnergy.h"
 #include "IntaRNA/VrnaHandler.h"
+#include "IntaRNA/EdBandMatrix.h"
 
 extern "C" {
 	#include <ViennaRNA/utils.h>
@@ -19,8 +20,6 @@ extern "C" {
 }
 #endif
 
-#include <boost/numeric/ublas/triangular.hpp>
-
 #define Evrna_2_E( e ) ( static_cast<E_type>(e) )
 
 namespace IntaRNA {
@@ -182,6 +181,19 @@ public:
 	E_type
 	getE_interLeft( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const;
 
+	/**
+	 * Provides a lower bound of the energy of any single interaction loop
+	 * within the allowed internal loop sizes, i.e. the minimal loop energy
+	 * over all base pair types and mismatch contexts.
+	 *
+	 * Note, the value is computed on first call and stored.
+	 *
+	 * @return lower bound of any finite getE_interLeft() value
+	 */
+	virtual
+	E_type
+	getBestE_interLeft() const;
+
 
 	/**
 	 * Computes the dangling end energy penalties for the left side
@@ -285,8 +297,9 @@ protected:
 	//! base pair code for (G,C)
 	const int bpGC;
 
-	//! matrix to store ES values (upper triangular matrix)
-	typedef boost::numeric::ublas::triangular_matrix<E_type, boost::numeric::ublas::upper> EsMatrix;
+	//! matrix to store ES values (upper triangular matrix banded by the
+	//! maximal length of accessible regions)
+	typedef EdBandMatrix EsMatrix;
 
 	//! the ES values for seq1 if computed (otherwise NULL)
 	EsMatrix * esValues1;
@@ -300,6 +313,9 @@ protected:
 	//! ensemble energy of intra-molecular structures of seq2
 	mutable E_type Eall2;
 
+	//! minimal energy of any interaction loop (E_INF if not computed yet)
+	mutable E_type bestE_interLeft;
+
 	/**
 	 * Checks whether or not a given base pair is a GC base pair
 	 * @param i1 the index in the first sequence
@@ -310,13 +326,36 @@ protected:
 	isGC( const size_t i1, const size_t i2 ) const;
 
 	/**
-	 * Computes the ES values and fills esValues container
+	 * Computes the ES values and fills esValues container for all
+	 * subsequences up to the maximal length of accessible regions.
+	 *
+	 * To this end, overlapping windows of the sequence are folded
+	 * independently such that time and memory are linear in the sequence
+	 * length.
+	 *
 	 * @param acc the accessibility object for the sequence to compute the ES values for
 	 * @param esToFill the container to write the ES values to
 	 */
 	void
 	computeES( const Accessibility & acc, EsMatrix & esToFill );
 
+	/**
+	 * Computes the ES values for all subsequences starting within [from,to)
+	 * from the partition functions of the window [winStart,winEnd)
+	 *
+	 * @param acc the accessibility object for the sequence to compute the ES values for
+	 * @param winStart the first sequence position of the window to fold
+	 * @param winEnd the position after the last sequence position of the window
+	 * @param from the first subsequence start to fill (> winStart if winStart > 0)
+	 * @param to the position after the last subsequence start to fill
+	 * @param esToFill the container to write the ES values to
+	 */
+	void
+	computeES( const Accessibility & acc
+			, const size_t winStart, const size_t winEnd
+			, const size_t from, const size_t to
+			, EsMatrix & esToFill );
+
 	/**
 	 * Computes the ensemble energy of all intra-molecular structures that
 	 * are conform to the accessibility constraints
@@ -447,8 +486,13 @@ getES1( const size_t i1, const size_t j1 ) const
 	if (esValues1 == NULL) throw std::runtime_error("InteractionEnergy::getES1() : ES values not initialized");
 #endif
 
+	// subsequences exceeding the maximal length are not considered
+	if (j1-i1 >= esValues1->getWidth()) {
+		return E_INF;
+	}
+
 	// return computed value
-	return (*esValues1)(i1,j1);
+	return esValues1->get(i1,j1);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -465,8 +509,13 @@ getES2( const size_t i2, const size_t j2 ) const
 	if (esValues2 == NULL) throw std::runtime_error("InteractionEnergy::getES2() : ES values not initialized");
 #endif
 
+	// subsequences exceeding the maximal length are not considered
+	if (j2-i2 >= esValues2->getWidth()) {
+		return E_INF;
+	}
+
 	// return computed value
-	return (*esValues2)(i2,j2);
+	return esValues2->get(i2,j2);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,122 @@
+
+#ifndef INTARNA_NARROWENERGY_H_
+#define INTARNA_NARROWENERGY_H_
+
+#include "IntaRNA/general.h"
+
+#include <boost/cstdint.hpp>
+
+#include <limits>
+#include <stdexcept>
+
+namespace IntaRNA {
+
+/**
+ * Compact 16-bit storage of an energy value (E_type) to be used as element
+ * type of large DP matrices.
+ *
+ * The value is stored inline within the cell, i.e. access needs no
+ * indirection. E_INF and all finite values above the 16-bit range are
+ * saturated to a dedicated infinity code, since such energies can not
+ * contribute to a favorable interaction. Finite values below the 16-bit
+ * range (i.e. interaction energies below -327 kcal/mol) can not be
+ * represented and raise an std::overflow_error to avoid wrong results.
+ *
+ * The implicit conversions from and to E_type enable the usage as drop-in
+ * replacement for E_type within matrices.
+ *
+ * @author Martin Mann
+ *
+ */
+class NarrowEnergy {
+
+public:
+
+	//! the narrow type used for storage
+	typedef int16_t storage_type;
+
+	//! storage code for E_INF
+	static const storage_type NARROW_INF = std::numeric_limits<storage_type>::max();
+
+	//! minimal storable energy
+	static const storage_type NARROW_MIN = std::numeric_limits<storage_type>::min();
+
+public:
+
+	/**
+	 * Default construction as E_INF
+	 */
+	NarrowEnergy()
+		: val(NARROW_INF)
+	{}
+
+	/**
+	 * Construction from a given energy value
+	 * @param e the energy to store
+	 */
+	NarrowEnergy( const E_type e )
+		: val(narrow(e))
+	{}
+
+	/**
+	 * Assignment of an energy value
+	 * @param e the energy to store
+	 * @return *this
+	 */
+	NarrowEnergy &
+	operator= ( const E_type e )
+	{
+		val = narrow(e);
+		return *this;
+	}
+
+	/**
+	 * Access to the represented energy value
+	 * @return the stored energy
+	 */
+	operator E_type () const
+	{
+		return val == NARROW_INF ? E_INF : E_type(val);
+	}
+
+protected:
+
+	//! the narrow value or the code NARROW_INF
+	storage_type val;
+
+	/**
+	 * Converts the given energy value to its storage representation
+	 * @param e the energy to convert
+	 * @return the narrow representation of e
+	 * @throws std::overflow_error if e is below the storable range
+	 */
+	static
+	storage_type
+	narrow( const E_type e )
+	{
+		// saturate infinity and too large values
+		if (e >= E_type(NARROW_INF)) {
+			return NARROW_INF;
+		}
+		// check if representable
+		if (e < E_type(NARROW_MIN)) {
+			throw std::overflow_error("NarrowEnergy : energy "+toString(e)+" is below the 16-bit storage range! Recompile without narrow energy storage or restrict the interaction length.");
+		}
+		return storage_type(e);
+	}
+
+};
+
+////////////////////////////////////////////////////////////////////////////
+
+#if INTARNA_NARROW_ENERGY
+	//! type for energy values within large DP matrices
+	typedef NarrowEnergy E_storage_type;
+#else
+	//! type for energy values within large DP matrices
+	typedef E_type E_storage_type;
+#endif
+
+} // namespace
+
+#endif /* INTARNA_NARROWENERGY_H_ */
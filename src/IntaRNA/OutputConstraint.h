@@ -62,6 +62,10 @@ public:
 	//! maximal ED penalty of each interacting subsequence to be considered for output
 	const E_type maxED;
 
+	//! whether or not screening mode is enabled, i.e. predictions can stop
+	//! once enough hits are found or no interaction can reach maxE
+	const bool screening;
+
 public:
 
 	/**
@@ -78,6 +82,10 @@ public:
 	 * @param noGUend whether or not inter-molecular UG base pairs are allowed at interaction ends
 	 * @param needZall whether or not Zall has to be computed for output generation
 	 * @param needBPs whether or not interaction base pairs have to be traced for output generation
+	 * @param maxED maximal ED penalty of each interacting subsequence to be considered for output
+	 * @param screening whether or not screening mode is enabled, i.e.
+	 *            predictions can stop once reportMax hits are found or no
+	 *            interaction can reach maxE
 	 */
 	OutputConstraint(	  const size_t reportMax = 1
 						, const ReportOverlap reportOverlap = OVERLAP_BOTH
@@ -88,7 +96,8 @@ public:
 						, const bool noGUend = false
 						, const bool needZall = false
 						, const bool needBPs = true
-						, const E_type maxED = Accessibility::ED_UPPER_BOUND);
+						, const E_type maxED = Accessibility::ED_UPPER_BOUND
+						, const bool screening = false);
 
 	//! destruction
 	virtual ~OutputConstraint();
@@ -6,7 +6,9 @@
 #include "IntaRNA/Interaction.h"
 #include "IntaRNA/InteractionRange.h"
 #include "IntaRNA/OutputConstraint.h"
+#include "IntaRNA/PValueEstimator.h"
 #include <string>
+#include <unordered_map>
 
 namespace IntaRNA {
 
@@ -56,6 +58,16 @@ public:
 	size_t
 	reported() const;
 
+	/**
+	 * Returns the number of reported non-empty interactions that are known
+	 * to be stored for final output (hits). Handlers that do not keep track
+	 * of hits return 0.
+	 * @return the number of stored hits (or 0 if not tracked)
+	 */
+	virtual
+	size_t
+	reportedHits() const;
+
 
 	/**
 	 * returns the reversed string
@@ -89,6 +101,47 @@ public:
 	Z_type
 	getZ() const;
 
+	/**
+	 * Sets the null model to be used to estimate p-values of the reported
+	 * interaction energies for the same pair of sequences.
+	 *
+	 * @param pValueEstimator the p-value estimation to be used
+	 */
+	virtual
+	void
+	setPValueEstimator( const PValueEstimator & pValueEstimator );
+
+	/**
+	 * Access to the null model set via setPValueEstimator() (initially empty).
+	 *
+	 * @return the p-value estimation for the reported interactions
+	 */
+	const PValueEstimator &
+	getPValueEstimator() const;
+
+	//! fusion partners of interactions indexed by the boundary of the interaction
+	typedef std::unordered_map< Interaction::Boundary, Interaction, Interaction::Boundary::Hash > FusionMap;
+
+	/**
+	 * Sets the fusion partners of the reported interactions for the same pair
+	 * of sequences, i.e. the mfe interactions predicted when the respective
+	 * interacting sites are blocked.
+	 *
+	 * @param fusions the fusion partners indexed by the interaction boundary
+	 */
+	virtual
+	void
+	setFusions( const FusionMap & fusions );
+
+	/**
+	 * Access to the fusion partner of an interaction set via setFusions().
+	 *
+	 * @param interaction the interaction of interest
+	 * @return the fusion partner or NULL if not available
+	 */
+	const Interaction *
+	getFusion( const Interaction & interaction ) const;
+
 	/**
 	 * Access to the output constraints to be applied
 	 * @return the OutputConstraint object to be heeded
@@ -108,6 +161,12 @@ protected:
 	//! overall partition function for the sequences provided in Z_energy
 	Z_type Z;
 
+	//! null model for p-value estimation of reported interaction energies
+	PValueEstimator pValueEstimator;
+
+	//! fusion partners of the reported interactions
+	FusionMap fusions;
+
 };
 
 
@@ -120,6 +179,8 @@ OutputHandler::OutputHandler( const OutputConstraint & outConstraint )
 	: outConstraint(outConstraint)
 	, reportedInteractions(0)
 	, Z(0)
+	, pValueEstimator()
+	, fusions()
 {
 }
 
@@ -151,6 +212,17 @@ reported() const
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+size_t
+OutputHandler::
+reportedHits() const
+{
+	// hits are not tracked
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 inline
 Z_type
 OutputHandler::
@@ -161,6 +233,52 @@ getZ() const
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+void
+OutputHandler::
+setPValueEstimator( const PValueEstimator & pValueEstimator )
+{
+	this->pValueEstimator = pValueEstimator;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+const PValueEstimator &
+OutputHandler::
+getPValueEstimator() const
+{
+	return pValueEstimator;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandler::
+setFusions( const FusionMap & fusions )
+{
+	this->fusions = fusions;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+const Interaction *
+OutputHandler::
+getFusion( const Interaction & interaction ) const
+{
+	if (fusions.empty() || interaction.basePairs.empty()) {
+		return NULL;
+	}
+	const FusionMap::const_iterator fusion = fusions.find( Interaction::Boundary(
+				  interaction.basePairs.begin()->first, interaction.basePairs.rbegin()->first
+				, interaction.basePairs.begin()->second, interaction.basePairs.rbegin()->second ) );
+	return fusion == fusions.end() ? NULL : &(fusion->second);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 inline
 const OutputConstraint &
 OutputHandler::
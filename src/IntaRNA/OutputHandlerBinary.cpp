@@ -0,0 +1,556 @@
+#include "IntaRNA/OutputHandlerBinary.h"
+
+#if INTARNA_MULITHREADING
+	#include <omp.h>
+#endif
+
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////
+
+const std::string OutputHandlerBinary::magic = "IntaRNA-binOut1";
+
+////////////////////////////////////////////////////////////////////////
+
+const size_t OutputHandlerBinary::rowGroupSizeDefault = 4096;
+
+////////////////////////////////////////////////////////////////////////
+
+const boost::uint8_t OutputHandlerBinary::flagBestSeedOnly = 1;
+
+////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+	//! appends the binary representation of a value to a buffer
+	template< typename T >
+	void
+	writeValue( std::string & buffer, const T & value )
+	{
+		buffer.append( reinterpret_cast<const char*>(&value), sizeof(T) );
+	}
+
+	//! appends the binary representation of all vector values to a buffer
+	template< typename T >
+	void
+	writeValues( std::string & buffer, const std::vector<T> & values )
+	{
+		if (!values.empty()) {
+			buffer.append( reinterpret_cast<const char*>(&(values[0])), values.size()*sizeof(T) );
+		}
+	}
+
+}
+
+////////////////////////////////////////////////////////////////////////
+
+OutputHandlerBinary::OutputHandlerBinary(
+		const OutputConstraint & outConstraint
+		, std::ostream & out_
+		, const InteractionEnergy & energy
+		, const OutputHandlerCsv::ColTypeList & columns
+		, const bool compress
+		, const size_t rowGroupSize
+		)
+ :	OutputHandler(outConstraint)
+	, out(out_)
+	, energy(energy)
+	, columns(columns.begin(), columns.end())
+	, compress(compress)
+	, rowGroupSize(std::max((size_t)1,rowGroupSize))
+	, columnsNeedED(OutputHandlerCsv::needED(columns))
+	, columnsNeedContributions(OutputHandlerCsv::needContributions(columns))
+	, data(columns.size())
+	, rows(0)
+{
+	// init column data
+	for (size_t c=0; c<data.size(); c++) {
+		data[c].type = getStorageType( this->columns.at(c) );
+		data[c].clear();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+OutputHandlerBinary::~OutputHandlerBinary()
+{
+	// write remaining rows
+	flushRowGroup();
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputStreamUpdate)
+#endif
+	{
+		// force output
+		out.flush();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+OutputHandlerBinary::StorageType
+OutputHandlerBinary::
+getStorageType( const OutputHandlerCsv::ColType col )
+{
+	switch( col ) {
+	case OutputHandlerCsv::id1:
+	case OutputHandlerCsv::id2:
+	case OutputHandlerCsv::seq1:
+	case OutputHandlerCsv::seq2:
+		return STRING_DICT;
+	case OutputHandlerCsv::subseq1:
+	case OutputHandlerCsv::subseq2:
+	case OutputHandlerCsv::subseqDP:
+	case OutputHandlerCsv::subseqDB:
+	case OutputHandlerCsv::hybridDP:
+	case OutputHandlerCsv::hybridDB:
+	case OutputHandlerCsv::hybridDPfull:
+	case OutputHandlerCsv::hybridDBfull:
+	case OutputHandlerCsv::hybridDPfuse:
+		return STRING;
+	case OutputHandlerCsv::start1:
+	case OutputHandlerCsv::end1:
+	case OutputHandlerCsv::start2:
+	case OutputHandlerCsv::end2:
+		return INT;
+	case OutputHandlerCsv::bpList:
+	case OutputHandlerCsv::seedStart1:
+	case OutputHandlerCsv::seedEnd1:
+	case OutputHandlerCsv::seedStart2:
+	case OutputHandlerCsv::seedEnd2:
+		return INT_LIST;
+	case OutputHandlerCsv::seedE:
+	case OutputHandlerCsv::seedED1:
+	case OutputHandlerCsv::seedED2:
+	case OutputHandlerCsv::seedPu1:
+	case OutputHandlerCsv::seedPu2:
+		return FLOAT_LIST;
+	default:
+		return FLOAT;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerBinary::
+writeHeader( std::ostream & out
+			, const OutputHandlerCsv::ColTypeList & columns
+			, const bool bestSeedOnly )
+{
+	std::string header( magic );
+	header.resize( 16, '\0' );
+	writeValue( header, (boost::uint8_t)(bestSeedOnly ? flagBestSeedOnly : 0) );
+	writeValue( header, (boost::uint32_t)columns.size() );
+	for (auto col = columns.begin(); col != columns.end(); col++) {
+		const std::string & name = OutputHandlerCsv::getColType2string().at( *col );
+		writeValue( header, (boost::uint8_t)getStorageType( *col ) );
+		writeValue( header, (boost::uint32_t)name.size() );
+		header.append( name );
+	}
+	// write header
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputStreamUpdate)
+#endif
+	{
+		out.write( header.c_str(), header.size() );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerBinary::
+add( const Interaction & i )
+{
+#if INTARNA_IN_DEBUG_MODE
+	// debug checks
+	if ( i.basePairs.size() > 0 && ! i.isValid() ) {
+		throw std::runtime_error("OutputHandlerBinary::add() : given interaction is not valid : "+toString(i));
+	}
+#endif
+
+	// special handling if no base pairs present
+	if (i.basePairs.size() == 0) {
+		return;
+	}
+
+	// get interaction start/end per sequence
+	const size_t i1 = i.basePairs.begin()->first;
+	const size_t j1 = i.basePairs.rbegin()->first;
+	const size_t i2 = i.basePairs.begin()->second;
+	const size_t j2 = i.basePairs.rbegin()->second;
+
+	// get individual energy contributions (only if needed)
+	InteractionEnergy::EnergyContributions contr{};
+	if (columnsNeedContributions) {
+		contr = energy.getE_contributions(i);
+	} else if (columnsNeedED) {
+		contr.ED1 = energy.getED1( energy.getIndex1(*i.basePairs.begin()), energy.getIndex1(*i.basePairs.rbegin()) );
+		contr.ED2 = energy.getED2( energy.getIndex2(*i.basePairs.begin()), energy.getIndex2(*i.basePairs.rbegin()) );
+	}
+
+	// number of seeds to be stored
+	const size_t seedNumber = (i.seed == NULL ? 0 : (outConstraint.bestSeedOnly ? 1 : i.seed->size()));
+
+	bool rowGroupFull = false;
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputHandlerBinaryUpdate)
+#endif
+	{
+	// count the interaction
+	reportedInteractions++;
+
+	for (size_t c = 0; c < columns.size(); c++) {
+		Column & col = data[c];
+		switch ( columns[c] ) {
+
+		case OutputHandlerCsv::id1:
+			addString( col, i.s1->getId() );
+			break;
+
+		case OutputHandlerCsv::id2:
+			addString( col, i.s2->getId() );
+			break;
+
+		case OutputHandlerCsv::seq1:
+			addString( col, i.s1->asString() );
+			break;
+
+		case OutputHandlerCsv::seq2:
+			addString( col, i.s2->asString() );
+			break;
+
+		case OutputHandlerCsv::subseq1:
+			addString( col, i.s1->asString().substr(i1, j1-i1+1) );
+			break;
+
+		case OutputHandlerCsv::subseq2:
+			addString( col, i.s2->asString().substr(j2, i2-j2+1) );
+			break;
+
+		case OutputHandlerCsv::subseqDP:
+			addString( col, i.s1->asString().substr(i1, j1-i1+1)
+							+ '&'
+							+ i.s2->asString().substr(j2, i2-j2+1) );
+			break;
+
+		case OutputHandlerCsv::subseqDB:
+			addString( col, toString(i.s1->getInOutIndex(i1))
+							+ i.s1->asString().substr(i1, j1-i1+1)
+							+ '&'
+							+ toString(i.s2->getInOutIndex(j2))
+							+ i.s2->asString().substr(j2, i2-j2+1) );
+			break;
+
+		case OutputHandlerCsv::start1:
+			col.ints.push_back( i.s1->getInOutIndex(i1) );
+			break;
+
+		case OutputHandlerCsv::end1:
+			col.ints.push_back( i.s1->getInOutIndex(j1) );
+			break;
+
+		case OutputHandlerCsv::start2:
+			col.ints.push_back( i.s2->getInOutIndex(j2) );
+			break;
+
+		case OutputHandlerCsv::end2:
+			col.ints.push_back( i.s2->getInOutIndex(i2) );
+			break;
+
+		case OutputHandlerCsv::hybridDP:
+			addString( col, Interaction::dotBracket( i ) );
+			break;
+
+		case OutputHandlerCsv::hybridDB:
+			addString( col, Interaction::dotBar( i ) );
+			break;
+
+		case OutputHandlerCsv::hybridDPfull:
+			addString( col, Interaction::dotBracket( i, '(', ')', true ) );
+			break;
+
+		case OutputHandlerCsv::hybridDBfull:
+			addString( col, Interaction::dotBar( i, true ) );
+			break;
+
+		case OutputHandlerCsv::bpList:
+			// store index pairs consecutively
+			for( auto bp = i.basePairs.begin(); bp != i.basePairs.end(); bp++ ) {
+				col.ints.push_back( i.s1->getInOutIndex(bp->first) );
+				col.ints.push_back( i.s2->getInOutIndex(bp->second) );
+			}
+			col.offsets.push_back( col.ints.size() );
+			break;
+
+		case OutputHandlerCsv::E:
+			addFloat( col, E_2_Ekcal(i.energy) );
+			break;
+
+		case OutputHandlerCsv::Etotal:
+			addFloat( col, E_2_Ekcal( i.energy + energy.getEall1() + energy.getEall2() )
+					, !( E_isINF(energy.getEall1()) || E_isINF(energy.getEall2()) ) );
+			break;
+
+		case OutputHandlerCsv::ED1:
+			addFloat( col, E_2_Ekcal(contr.ED1) );
+			break;
+
+		case OutputHandlerCsv::ED2:
+			addFloat( col, E_2_Ekcal(contr.ED2) );
+			break;
+
+		case OutputHandlerCsv::Pu1:
+			addFloat( col, static_cast<double>(E_equal(contr.ED1,0) ? Z_type(1) : energy.getBoltzmannWeight(contr.ED1)) );
+			break;
+
+		case OutputHandlerCsv::Pu2:
+			addFloat( col, static_cast<double>(E_equal(contr.ED2,0) ? Z_type(1) : energy.getBoltzmannWeight(contr.ED2)) );
+			break;
+
+		case OutputHandlerCsv::E_init:
+			addFloat( col, E_2_Ekcal(contr.init) );
+			break;
+
+		case OutputHandlerCsv::E_loops:
+			addFloat( col, E_2_Ekcal(contr.loops) );
+			break;
+
+		case OutputHandlerCsv::E_dangleL:
+			addFloat( col, E_2_Ekcal(contr.dangleLeft) );
+			break;
+
+		case OutputHandlerCsv::E_dangleR:
+			addFloat( col, E_2_Ekcal(contr.dangleRight) );
+			break;
+
+		case OutputHandlerCsv::E_endL:
+			addFloat( col, E_2_Ekcal(contr.endLeft) );
+			break;
+
+		case OutputHandlerCsv::E_endR:
+			addFloat( col, E_2_Ekcal(contr.endRight) );
+			break;
+
+		case OutputHandlerCsv::E_hybrid:
+			addFloat( col, E_2_Ekcal(i.energy - contr.ED1 - contr.ED2) );
+			break;
+
+		case OutputHandlerCsv::E_norm:
+			addFloat( col, E_2_Ekcal(i.energy) / std::log( energy.size1() * energy.size2() ) );
+			break;
+
+		case OutputHandlerCsv::E_hybridNorm:
+			addFloat( col, E_2_Ekcal(i.energy - contr.ED1 - contr.ED2) / std::log( energy.size1() * energy.size2() ) );
+			break;
+
+		case OutputHandlerCsv::E_add:
+			addFloat( col, E_2_Ekcal(contr.energyAdd) );
+			break;
+
+		case OutputHandlerCsv::w:
+			addFloat( col, static_cast<double>(energy.getBoltzmannWeight(i.energy)) );
+			break;
+
+		case OutputHandlerCsv::seedStart1:
+		case OutputHandlerCsv::seedEnd1:
+		case OutputHandlerCsv::seedStart2:
+		case OutputHandlerCsv::seedEnd2: {
+			auto seed = (i.seed == NULL ? Interaction::SeedSet::const_iterator() : i.seed->begin());
+			for (size_t s = 0; s < seedNumber; seed++, s++) {
+				switch( columns[c] ) {
+				case OutputHandlerCsv::seedStart1 : col.ints.push_back( i.s1->getInOutIndex(seed->bp_i.first) ); break;
+				case OutputHandlerCsv::seedEnd1 : col.ints.push_back( i.s1->getInOutIndex(seed->bp_j.first) ); break;
+				case OutputHandlerCsv::seedStart2 : col.ints.push_back( i.s2->getInOutIndex(seed->bp_j.second) ); break;
+				default : col.ints.push_back( i.s2->getInOutIndex(seed->bp_i.second) ); break;
+				}
+			}
+			col.offsets.push_back( col.ints.size() );
+			break;}
+
+		case OutputHandlerCsv::seedE:
+		case OutputHandlerCsv::seedED1:
+		case OutputHandlerCsv::seedED2:
+		case OutputHandlerCsv::seedPu1:
+		case OutputHandlerCsv::seedPu2: {
+			auto seed = (i.seed == NULL ? Interaction::SeedSet::const_iterator() : i.seed->begin());
+			for (size_t s = 0; s < seedNumber; seed++, s++) {
+				switch( columns[c] ) {
+				case OutputHandlerCsv::seedE : col.floats.push_back( E_2_Ekcal(seed->energy) ); break;
+				case OutputHandlerCsv::seedED1 : col.floats.push_back( E_2_Ekcal(energy.getED1( seed->bp_i.first, seed->bp_j.first )) ); break;
+				case OutputHandlerCsv::seedED2 : col.floats.push_back( E_2_Ekcal(energy.getAccessibility2().getAccessibilityOrigin().getED( seed->bp_j.second, seed->bp_i.second )) ); break;
+				case OutputHandlerCsv::seedPu1 : col.floats.push_back( static_cast<double>(energy.getBoltzmannWeight( energy.getED1( seed->bp_i.first, seed->bp_j.first ) )) ); break;
+				default : col.floats.push_back( static_cast<double>(energy.getBoltzmannWeight( energy.getAccessibility2().getAccessibilityOrigin().getED( seed->bp_j.second, seed->bp_i.second ) )) ); break;
+				}
+			}
+			col.offsets.push_back( col.floats.size() );
+			break;}
+
+		case OutputHandlerCsv::Eall:
+			addFloat( col, Z_equal(Z,Z_type(0)) ? 0.0 : E_2_Ekcal(energy.getE_scaled(Z)), !Z_equal(Z,Z_type(0)) );
+			break;
+
+		case OutputHandlerCsv::Eall1:
+			addFloat( col, E_2_Ekcal(energy.getEall1()), !E_isINF(energy.getEall1()) );
+			break;
+
+		case OutputHandlerCsv::Eall2:
+			addFloat( col, E_2_Ekcal(energy.getEall2()), !E_isINF(energy.getEall2()) );
+			break;
+
+		case OutputHandlerCsv::EallTotal:
+			if ( Z_equal(Z,Z_type(0)) || E_isINF(energy.getEall1()) || E_isINF(energy.getEall2()) )
+				addFloat( col, 0.0, false );
+			else
+				addFloat( col, E_2_Ekcal( energy.getE_scaled(Z) + energy.getEall1() + energy.getEall2() ) );
+			break;
+
+		case OutputHandlerCsv::Zall:
+			addFloat( col, static_cast<double>(Z), !Z_equal(Z,Z_type(0)) );
+			break;
+
+		case OutputHandlerCsv::Zall1:
+			addFloat( col, static_cast<double>(energy.getBoltzmannWeight(energy.getEall1())), !E_isINF(energy.getEall1()) );
+			break;
+
+		case OutputHandlerCsv::Zall2:
+			addFloat( col, static_cast<double>(energy.getBoltzmannWeight(energy.getEall2())), !E_isINF(energy.getEall2()) );
+			break;
+
+		case OutputHandlerCsv::P_E:
+			addFloat( col, Z_equal(Z,Z_type(0)) ? 0.0 : static_cast<double>(energy.getBoltzmannWeightScaled(i.energy)/Z), !Z_equal(Z,Z_type(0)) );
+			break;
+
+		case OutputHandlerCsv::RT:
+			addFloat( col, static_cast<double>(energy.getRT()) );
+			break;
+
+		case OutputHandlerCsv::pvalEmp:
+			addFloat( col, pValueEstimator.empty() ? 0.0 : pValueEstimator.getPValueEmpirical( E_2_Ekcal(i.energy) ), !pValueEstimator.empty() );
+			break;
+
+		case OutputHandlerCsv::pvalGauss:
+			addFloat( col, pValueEstimator.empty() ? 0.0 : pValueEstimator.getPValueGauss( E_2_Ekcal(i.energy) ), !pValueEstimator.empty() );
+			break;
+
+		case OutputHandlerCsv::pvalGumbel:
+			addFloat( col, pValueEstimator.empty() ? 0.0 : pValueEstimator.getPValueGumbel( E_2_Ekcal(i.energy) ), !pValueEstimator.empty() );
+			break;
+
+		case OutputHandlerCsv::Efuse:
+			addFloat( col, getFusion(i) == NULL ? 0.0 : E_2_Ekcal( i.energy + getFusion(i)->energy ), getFusion(i) != NULL );
+			break;
+
+		case OutputHandlerCsv::hybridDPfuse:
+			addString( col, getFusion(i) == NULL ? OutputHandlerCsv::notAvailable : Interaction::dotBracket( *getFusion(i) ) );
+			break;
+
+		default : throw std::runtime_error("OutputHandlerBinary::add() : unhandled ColType '"+OutputHandlerCsv::getColType2string().at(columns[c])+"'");
+		}
+	}
+	rows++;
+	rowGroupFull = (rows >= rowGroupSize);
+	} // omp critical(intarna_omp_outputHandlerBinaryUpdate)
+
+	// write full row group
+	if (rowGroupFull) {
+		flushRowGroup();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerBinary::
+flushRowGroup()
+{
+	std::string payload;
+	boost::uint64_t groupRows = 0;
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputHandlerBinaryUpdate)
+#endif
+	{
+	groupRows = rows;
+	if (rows > 0) {
+		// serialize column after column
+		for (auto col = data.begin(); col != data.end(); col++) {
+			switch( col->type ) {
+			case STRING_DICT :
+				writeValue( payload, (boost::uint32_t)col->dict.size() );
+				for (auto entry = col->dict.begin(); entry != col->dict.end(); entry++) {
+					writeValue( payload, (boost::uint32_t)entry->size() );
+					payload.append( *entry );
+				}
+				writeValues( payload, col->codes );
+				break;
+			case STRING :
+				writeValues( payload, col->offsets );
+				payload.append( col->chars );
+				break;
+			case INT :
+				writeValues( payload, col->ints );
+				break;
+			case FLOAT :
+				writeValues( payload, col->available );
+				writeValues( payload, col->floats );
+				break;
+			case INT_LIST :
+				writeValues( payload, col->offsets );
+				writeValues( payload, col->ints );
+				break;
+			case FLOAT_LIST :
+				writeValues( payload, col->offsets );
+				writeValues( payload, col->floats );
+				break;
+			}
+			// reset for next row group
+			col->clear();
+		}
+		rows = 0;
+	}
+	} // omp critical(intarna_omp_outputHandlerBinaryUpdate)
+
+	// check if anything to write
+	if (groupRows == 0) {
+		return;
+	}
+
+	// compress if needed
+	std::string compressed;
+	if (compress) {
+		namespace bio = boost::iostreams;
+		bio::filtering_ostream zout;
+		zout.push( bio::zlib_compressor() );
+		zout.push( bio::back_inserter( compressed ) );
+		zout.write( payload.c_str(), payload.size() );
+		// close stream to flush all data
+		zout.reset();
+	}
+
+	// row group header
+	std::string groupHeader;
+	writeValue( groupHeader, groupRows );
+	writeValue( groupHeader, (boost::uint8_t)(compress ? 1 : 0) );
+	writeValue( groupHeader, (boost::uint64_t)(compress ? compressed.size() : payload.size()) );
+	writeValue( groupHeader, (boost::uint64_t)payload.size() );
+
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputStreamUpdate)
+#endif
+	{
+		out.write( groupHeader.c_str(), groupHeader.size() );
+		if (compress) {
+			out.write( compressed.c_str(), compressed.size() );
+		} else {
+			out.write( payload.c_str(), payload.size() );
+		}
+	} // omp critical(intarna_omp_outputStreamUpdate)
+}
+
+////////////////////////////////////////////////////////////////////////
+
+} // namespace
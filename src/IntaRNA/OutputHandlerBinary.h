@@ -0,0 +1,273 @@
+
+#ifndef INTARNA_OUTPUTHANDLERBINARY_H_
+#define INTARNA_OUTPUTHANDLERBINARY_H_
+
+#include "IntaRNA/general.h"
+
+#include "IntaRNA/OutputConstraint.h"
+#include "IntaRNA/OutputHandler.h"
+#include "IntaRNA/OutputHandlerCsv.h"
+#include "IntaRNA/InteractionEnergy.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <boost/cstdint.hpp>
+
+namespace IntaRNA {
+
+/**
+ * OutputHandler that writes interactions in a self-describing columnar
+ * binary format, which can be read via OutputHandlerBinaryReader and
+ * converted back to the CSV format of OutputHandlerCsv.
+ *
+ * The columns are identified by the OutputHandlerCsv::ColType names
+ * (see --outCsvCols). The format is
+ *
+ *  - file header (see writeHeader()) :
+ *    magic string, flags, number of columns, and for each column its
+ *    storage type and ColType name
+ *  - a sequence of row groups, each holding
+ *    number of rows, compression flag, stored and raw payload size,
+ *    and the (optionally zlib compressed) payload of all column data
+ *    for the rows of the group (column after column).
+ *
+ * Column data is stored depending on the storage type (see getStorageType()):
+ *
+ *  - STRING_DICT : dictionary of distinct strings + one code per row
+ *  - STRING : (rows+1) offsets + concatenated characters
+ *  - INT : one value per row
+ *  - FLOAT : one availability flag per row + one value per row
+ *  - INT_LIST / FLOAT_LIST : (rows+1) offsets + concatenated values;
+ *    an empty list encodes a not available value
+ *
+ * All numbers are stored in native byte order. Partition functions and
+ * probabilities are stored as double values.
+ *
+ */
+class OutputHandlerBinary : public OutputHandler
+{
+
+public:
+
+	//! the storage types of the columns
+	enum StorageType {
+		STRING_DICT = 0, //!< dictionary encoded strings
+		STRING, //!< plain strings
+		INT, //!< integers (positions)
+		FLOAT, //!< floating point values (energies, probabilities)
+		INT_LIST, //!< lists of integers (base pairs, seed positions)
+		FLOAT_LIST //!< lists of floating point values (seed energies)
+	};
+
+	//! the magic string at the beginning of each binary output
+	static const std::string magic;
+
+	//! default number of rows per row group
+	static const size_t rowGroupSizeDefault;
+
+	//! flag of the file header : only best seed information is stored
+	static const boost::uint8_t flagBestSeedOnly;
+
+	/**
+	 * Data of a single column for a row group
+	 */
+	struct Column {
+		//! the storage type of the column
+		StorageType type;
+		//! STRING_DICT : the distinct strings
+		std::vector< std::string > dict;
+		//! STRING_DICT : index of the strings within dict
+		std::unordered_map< std::string, boost::uint32_t > dictIndex;
+		//! STRING_DICT : dictionary code per row
+		std::vector< boost::uint32_t > codes;
+		//! STRING, INT_LIST, FLOAT_LIST : start offset per row and final end
+		//! (starts with a single 0 entry)
+		std::vector< boost::uint64_t > offsets;
+		//! STRING : concatenated characters
+		std::string chars;
+		//! INT, INT_LIST : the values
+		std::vector< boost::int32_t > ints;
+		//! FLOAT : availability flag per row
+		std::vector< boost::uint8_t > available;
+		//! FLOAT, FLOAT_LIST : the values
+		std::vector< double > floats;
+
+		/**
+		 * Resets the data for a new row group
+		 */
+		void clear();
+	};
+
+	/**
+	 * Construct a binary output handler for interaction reporting.
+	 *
+	 * @param outConstraint the output constraint applied to find the reported
+	 *        interaction
+	 * @param out the stream to write to (the file header has to be written
+	 *        already via writeHeader())
+	 * @param energy the interaction energy object used for computation
+	 * @param columns the order and list of columns to be stored
+	 * @param compress whether or not row groups are zlib compressed
+	 * @param rowGroupSize the maximal number of rows per row group
+	 */
+	OutputHandlerBinary( const OutputConstraint & outConstraint
+						, std::ostream & out
+						, const InteractionEnergy & energy
+						, const OutputHandlerCsv::ColTypeList & columns
+						, const bool compress = false
+						, const size_t rowGroupSize = rowGroupSizeDefault
+						);
+
+	/**
+	 * destruction, which writes all buffered rows as last row group
+	 */
+	virtual ~OutputHandlerBinary();
+
+	/**
+	 * Adds the data of the given interaction as new row to the current row
+	 * group. If the row group is full, it is written to the stream.
+	 *
+	 * @param interaction the interaction to output
+	 */
+	virtual
+	void
+	add( const Interaction & interaction  );
+
+	/**
+	 * Writes the file header for a given list of columns.
+	 *
+	 * @param out the stream to write to
+	 * @param columns the order and list of columns to be stored
+	 * @param bestSeedOnly whether or not only the best seed is stored
+	 *        (needed for identical CSV conversion)
+	 */
+	static
+	void
+	writeHeader( std::ostream & out
+				, const OutputHandlerCsv::ColTypeList & columns
+				, const bool bestSeedOnly );
+
+	/**
+	 * Provides the storage type used for a given column type.
+	 * @param col the column type of interest
+	 * @return the storage type of the column
+	 */
+	static
+	StorageType
+	getStorageType( const OutputHandlerCsv::ColType col );
+
+protected:
+
+	//! overall partition function (if set)
+	using OutputHandler::Z;
+
+	//! the output stream to write to
+	std::ostream & out;
+
+	//! the interaction energy function used for interaction computation
+	const InteractionEnergy & energy;
+
+	//! the sequence of columns to be stored
+	const std::vector< OutputHandlerCsv::ColType > columns;
+
+	//! whether or not row groups are compressed
+	const bool compress;
+
+	//! maximal number of rows per row group
+	const size_t rowGroupSize;
+
+	//! whether or not a column requires the ED values of the interaction
+	const bool columnsNeedED;
+
+	//! whether or not a column requires the full energy decomposition
+	const bool columnsNeedContributions;
+
+	//! the column data of the current row group
+	std::vector< Column > data;
+
+	//! number of rows within the current row group
+	size_t rows;
+
+	/**
+	 * Writes the current row group to the stream and resets the data.
+	 */
+	void
+	flushRowGroup();
+
+	/**
+	 * Appends a string to a STRING_DICT or STRING column.
+	 * @param col the column to extend
+	 * @param value the string to append
+	 */
+	static
+	void
+	addString( Column & col, const std::string & value );
+
+	/**
+	 * Appends a value to a FLOAT column.
+	 * @param col the column to extend
+	 * @param value the value to append
+	 * @param isAvailable whether or not the value is available
+	 */
+	static
+	void
+	addFloat( Column & col, const double value, const bool isAvailable = true );
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerBinary::Column::
+clear()
+{
+	dict.clear();
+	dictIndex.clear();
+	codes.clear();
+	offsets.assign( 1, 0 );
+	chars.clear();
+	ints.clear();
+	available.clear();
+	floats.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerBinary::
+addString( Column & col, const std::string & value )
+{
+	if (col.type == STRING_DICT) {
+		auto entry = col.dictIndex.find( value );
+		if (entry == col.dictIndex.end()) {
+			entry = col.dictIndex.insert( std::make_pair( value, (boost::uint32_t)col.dict.size() ) ).first;
+			col.dict.push_back( value );
+		}
+		col.codes.push_back( entry->second );
+	} else {
+		col.chars.append( value );
+		col.offsets.push_back( col.chars.size() );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerBinary::
+addFloat( Column & col, const double value, const bool isAvailable )
+{
+	col.available.push_back( isAvailable ? 1 : 0 );
+	col.floats.push_back( isAvailable ? value : 0.0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_OUTPUTHANDLERBINARY_H_ */
@@ -0,0 +1,318 @@
+#include "IntaRNA/OutputHandlerBinaryReader.h"
+
+#include <cstring>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/array.hpp>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+	//! extracts a value from a buffer at the given position and moves the position
+	template< typename T >
+	T
+	readValue( const std::string & buffer, size_t & pos )
+	{
+		if (pos + sizeof(T) > buffer.size()) {
+			throw std::runtime_error("OutputHandlerBinaryReader : corrupted row group data");
+		}
+		T value;
+		std::memcpy( &value, buffer.c_str()+pos, sizeof(T) );
+		pos += sizeof(T);
+		return value;
+	}
+
+	//! extracts a given number of values from a buffer at the given position and moves the position
+	template< typename T >
+	void
+	readValues( const std::string & buffer, size_t & pos, std::vector<T> & values, const size_t number )
+	{
+		if (pos + number*sizeof(T) > buffer.size()) {
+			throw std::runtime_error("OutputHandlerBinaryReader : corrupted row group data");
+		}
+		values.resize( number );
+		if (number > 0) {
+			std::memcpy( &(values[0]), buffer.c_str()+pos, number*sizeof(T) );
+		}
+		pos += number*sizeof(T);
+	}
+
+}
+
+////////////////////////////////////////////////////////////////////////
+
+OutputHandlerBinaryReader::
+OutputHandlerBinaryReader( std::istream & in )
+ :	in(in)
+	, columns()
+	, flags(0)
+	, data()
+	, rows(0)
+{
+	// check magic string
+	char buffer[16];
+	read( buffer, 16 );
+	if (std::memcmp( buffer, OutputHandlerBinary::magic.c_str(), OutputHandlerBinary::magic.size()+1 ) != 0) {
+		throw std::runtime_error("OutputHandlerBinaryReader() : input is no binary IntaRNA output");
+	}
+	read( reinterpret_cast<char*>(&flags), sizeof(flags) );
+	boost::uint32_t colNumber = 0;
+	read( reinterpret_cast<char*>(&colNumber), sizeof(colNumber) );
+	// parse column information
+	data.resize( colNumber );
+	for (size_t c=0; c<colNumber; c++) {
+		boost::uint8_t type;
+		read( reinterpret_cast<char*>(&type), sizeof(type) );
+		boost::uint32_t nameLength;
+		read( reinterpret_cast<char*>(&nameLength), sizeof(nameLength) );
+		std::string name( nameLength, ' ' );
+		if (nameLength > 0) {
+			read( &(name[0]), nameLength );
+		}
+		// get column type (throws for unknown names)
+		const OutputHandlerCsv::ColType colType = *(OutputHandlerCsv::string2list( name ).begin());
+		if (type != OutputHandlerBinary::getStorageType( colType )) {
+			throw std::runtime_error("OutputHandlerBinaryReader() : unexpected storage type for column '"+name+"'");
+		}
+		columns.push_back( colType );
+		data[c].type = OutputHandlerBinary::getStorageType( colType );
+		data[c].clear();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+OutputHandlerBinaryReader::
+~OutputHandlerBinaryReader()
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerBinaryReader::
+read( char * buffer, const size_t bytes )
+{
+	in.read( buffer, bytes );
+	if ((size_t)in.gcount() != bytes) {
+		throw std::runtime_error("OutputHandlerBinaryReader : unexpected end of input");
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool
+OutputHandlerBinaryReader::
+nextRowGroup()
+{
+	rows = 0;
+	for (auto col = data.begin(); col != data.end(); col++) {
+		col->clear();
+	}
+
+	// check for end of input
+	if (in.peek() == std::istream::traits_type::eof()) {
+		return false;
+	}
+
+	// parse row group header
+	boost::uint64_t groupRows, storedBytes, rawBytes;
+	boost::uint8_t compressed;
+	read( reinterpret_cast<char*>(&groupRows), sizeof(groupRows) );
+	read( reinterpret_cast<char*>(&compressed), sizeof(compressed) );
+	read( reinterpret_cast<char*>(&storedBytes), sizeof(storedBytes) );
+	read( reinterpret_cast<char*>(&rawBytes), sizeof(rawBytes) );
+
+	// read payload
+	std::string payload( storedBytes, '\0' );
+	if (storedBytes > 0) {
+		read( &(payload[0]), storedBytes );
+	}
+	if (compressed != 0) {
+		namespace bio = boost::iostreams;
+		bio::filtering_istream zin;
+		zin.push( bio::zlib_decompressor() );
+		zin.push( bio::array_source( payload.c_str(), payload.size() ) );
+		std::string raw( rawBytes, '\0' );
+		if (rawBytes > 0) {
+			zin.read( &(raw[0]), rawBytes );
+			if ((size_t)zin.gcount() != rawBytes) {
+				throw std::runtime_error("OutputHandlerBinaryReader : corrupted compressed row group");
+			}
+		}
+		payload.swap( raw );
+	}
+
+	// parse column data
+	size_t pos = 0;
+	for (auto col = data.begin(); col != data.end(); col++) {
+		switch( col->type ) {
+		case OutputHandlerBinary::STRING_DICT : {
+			const boost::uint32_t dictSize = readValue<boost::uint32_t>( payload, pos );
+			for (size_t d=0; d<dictSize; d++) {
+				const boost::uint32_t length = readValue<boost::uint32_t>( payload, pos );
+				if (pos + length > payload.size()) {
+					throw std::runtime_error("OutputHandlerBinaryReader : corrupted row group data");
+				}
+				col->dict.push_back( payload.substr( pos, length ) );
+				pos += length;
+			}
+			readValues( payload, pos, col->codes, groupRows );
+			for (auto code = col->codes.begin(); code != col->codes.end(); code++) {
+				if (*code >= dictSize) {
+					throw std::runtime_error("OutputHandlerBinaryReader : corrupted dictionary code");
+				}
+			}
+			break; }
+		case OutputHandlerBinary::STRING :
+			readValues( payload, pos, col->offsets, groupRows+1 );
+			if (pos + col->offsets.back() > payload.size()) {
+				throw std::runtime_error("OutputHandlerBinaryReader : corrupted row group data");
+			}
+			col->chars = payload.substr( pos, col->offsets.back() );
+			pos += col->offsets.back();
+			break;
+		case OutputHandlerBinary::INT :
+			readValues( payload, pos, col->ints, groupRows );
+			break;
+		case OutputHandlerBinary::FLOAT :
+			readValues( payload, pos, col->available, groupRows );
+			readValues( payload, pos, col->floats, groupRows );
+			break;
+		case OutputHandlerBinary::INT_LIST :
+			readValues( payload, pos, col->offsets, groupRows+1 );
+			readValues( payload, pos, col->ints, col->offsets.back() );
+			break;
+		case OutputHandlerBinary::FLOAT_LIST :
+			readValues( payload, pos, col->offsets, groupRows+1 );
+			readValues( payload, pos, col->floats, col->offsets.back() );
+			break;
+		}
+	}
+	if (pos != payload.size()) {
+		throw std::runtime_error("OutputHandlerBinaryReader : corrupted row group data");
+	}
+
+	rows = groupRows;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerBinaryReader::
+writeCsv( std::ostream & out, const std::string & colSep, const std::string & listSep ) const
+{
+	// sanitize identifiers once per dictionary entry
+	std::vector< std::vector< std::string > > sanitizedIds( data.size() );
+	size_t c = 0;
+	for (auto colType = columns.begin(); colType != columns.end(); colType++, c++) {
+		if (*colType == OutputHandlerCsv::id1 || *colType == OutputHandlerCsv::id2) {
+			for (auto id = data[c].dict.begin(); id != data[c].dict.end(); id++) {
+				sanitizedIds[c].push_back( boost::replace_all_copy( *id, colSep, "_" ) );
+			}
+		}
+	}
+
+	std::string row;
+	for (size_t r=0; r<rows; r++) {
+		row.clear();
+		c = 0;
+		for (auto colType = columns.begin(); colType != columns.end(); colType++, c++) {
+			// print separator if needed
+			if (c > 0) {
+				row.append( colSep );
+			}
+			const OutputHandlerBinary::Column & col = data[c];
+			switch( col.type ) {
+			case OutputHandlerBinary::STRING_DICT :
+				row.append( sanitizedIds[c].empty() ? col.dict[col.codes[r]] : sanitizedIds[c][col.codes[r]] );
+				break;
+			case OutputHandlerBinary::STRING :
+				row.append( col.chars, col.offsets[r], col.offsets[r+1]-col.offsets[r] );
+				break;
+			case OutputHandlerBinary::INT :
+				OutputHandlerCsv::append( row, (long)col.ints[r] );
+				break;
+			case OutputHandlerBinary::FLOAT :
+				if (col.available[r] == 0) {
+					row.append( OutputHandlerCsv::notAvailable );
+				} else {
+					OutputHandlerCsv::append( row, col.floats[r] );
+				}
+				break;
+			case OutputHandlerBinary::INT_LIST :
+				if (col.offsets[r] == col.offsets[r+1]) {
+					row.append( OutputHandlerCsv::notAvailable );
+				} else if (*colType == OutputHandlerCsv::bpList) {
+					// index pairs
+					for (size_t v=col.offsets[r]; v+1<col.offsets[r+1]; v+=2) {
+						if (v != col.offsets[r]) {
+							row.append( listSep );
+						}
+						row.push_back('(');
+						OutputHandlerCsv::append( row, (long)col.ints[v] );
+						row.push_back(',');
+						OutputHandlerCsv::append( row, (long)col.ints[v+1] );
+						row.push_back(')');
+					}
+				} else {
+					for (size_t v=col.offsets[r]; v<col.offsets[r+1]; v++) {
+						if (v != col.offsets[r]) {
+							row.append( listSep );
+						}
+						OutputHandlerCsv::append( row, (long)col.ints[v] );
+					}
+				}
+				break;
+			case OutputHandlerBinary::FLOAT_LIST : {
+				// seed probability lists are printed with full precision
+				const bool exact = !isBestSeedOnly() && (*colType == OutputHandlerCsv::seedPu1 || *colType == OutputHandlerCsv::seedPu2);
+				if (col.offsets[r] == col.offsets[r+1]) {
+					row.append( OutputHandlerCsv::notAvailable );
+				} else {
+					for (size_t v=col.offsets[r]; v<col.offsets[r+1]; v++) {
+						if (v != col.offsets[r]) {
+							row.append( listSep );
+						}
+						if (exact) {
+							OutputHandlerCsv::appendExact( row, col.floats[v] );
+						} else {
+							OutputHandlerCsv::append( row, col.floats[v] );
+						}
+					}
+				}
+				break; }
+			}
+		}
+		row.push_back('\n');
+		out.write( row.c_str(), row.size() );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+
+size_t
+OutputHandlerBinaryReader::
+convertToCsv( std::istream & in, std::ostream & out
+			, const std::string & colSep
+			, const std::string & listSep )
+{
+	OutputHandlerBinaryReader reader( in );
+	out <<OutputHandlerCsv::getHeader( reader.getColumns(), colSep );
+	size_t rowNumber = 0;
+	while( reader.nextRowGroup() ) {
+		reader.writeCsv( out, colSep, listSep );
+		rowNumber += reader.size();
+	}
+	return rowNumber;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+} // namespace
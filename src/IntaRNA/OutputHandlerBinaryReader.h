@@ -0,0 +1,287 @@
+
+#ifndef INTARNA_OUTPUTHANDLERBINARYREADER_H_
+#define INTARNA_OUTPUTHANDLERBINARYREADER_H_
+
+#include "IntaRNA/general.h"
+#include "IntaRNA/OutputHandlerBinary.h"
+#include "IntaRNA/OutputHandlerCsv.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace IntaRNA {
+
+/**
+ * Reads the columnar binary output written by OutputHandlerBinary row group
+ * by row group and provides typed access to the column data of the current
+ * row group as well as a conversion to the CSV format of OutputHandlerCsv.
+ *
+ * Usage:
+ *
+ *  OutputHandlerBinaryReader reader( in );
+ *  while( reader.nextRowGroup() ) {
+ *    for (size_t r=0; r<reader.size(); r++) {
+ *      ... reader.getInt( c, r ) ...
+ *    }
+ *  }
+ *
+ */
+class OutputHandlerBinaryReader
+{
+public:
+
+	/**
+	 * Construction and parsing of the file header.
+	 *
+	 * @param in the stream to read from (binary mode)
+	 *
+	 * @throws std::runtime_error if the stream is no binary IntaRNA output
+	 */
+	OutputHandlerBinaryReader( std::istream & in );
+
+	//! destruction
+	virtual ~OutputHandlerBinaryReader();
+
+	/**
+	 * Access to the stored columns.
+	 * @return the list of stored columns
+	 */
+	const OutputHandlerCsv::ColTypeList &
+	getColumns() const;
+
+	/**
+	 * Whether or not only the best seed information was stored.
+	 * @return true if only the best seed was stored per interaction
+	 */
+	bool
+	isBestSeedOnly() const;
+
+	/**
+	 * Reads the next row group.
+	 * @return true if a row group was read; false if the end of the stream
+	 *         was reached
+	 *
+	 * @throws std::runtime_error in case of corrupted data
+	 */
+	bool
+	nextRowGroup();
+
+	/**
+	 * Number of rows of the current row group
+	 * @return the number of rows
+	 */
+	size_t
+	size() const;
+
+	/**
+	 * Access to the value of a STRING_DICT or STRING column.
+	 * @param col the index of the column within getColumns()
+	 * @param row the row within the current row group
+	 * @return the string value
+	 */
+	std::string
+	getString( const size_t col, const size_t row ) const;
+
+	/**
+	 * Access to the value of an INT column.
+	 * @param col the index of the column within getColumns()
+	 * @param row the row within the current row group
+	 * @return the integer value
+	 */
+	long
+	getInt( const size_t col, const size_t row ) const;
+
+	/**
+	 * Whether or not the value of a FLOAT column is available.
+	 * @param col the index of the column within getColumns()
+	 * @param row the row within the current row group
+	 * @return true if available; false if not (NAN in CSV output)
+	 */
+	bool
+	isAvailable( const size_t col, const size_t row ) const;
+
+	/**
+	 * Access to the value of a FLOAT column.
+	 * @param col the index of the column within getColumns()
+	 * @param row the row within the current row group
+	 * @return the floating point value
+	 */
+	double
+	getFloat( const size_t col, const size_t row ) const;
+
+	/**
+	 * Access to the values of an INT_LIST column.
+	 * @param col the index of the column within getColumns()
+	 * @param row the row within the current row group
+	 * @return the list of values (empty if not available)
+	 */
+	std::vector<long>
+	getIntList( const size_t col, const size_t row ) const;
+
+	/**
+	 * Access to the values of a FLOAT_LIST column.
+	 * @param col the index of the column within getColumns()
+	 * @param row the row within the current row group
+	 * @return the list of values (empty if not available)
+	 */
+	std::vector<double>
+	getFloatList( const size_t col, const size_t row ) const;
+
+	/**
+	 * Writes the rows of the current row group in the CSV format of
+	 * OutputHandlerCsv to the given stream.
+	 *
+	 * @param out the stream to write to
+	 * @param colSep the column separator to be used
+	 * @param listSep the separator to be used within list columns
+	 */
+	void
+	writeCsv( std::ostream & out, const std::string & colSep, const std::string & listSep ) const;
+
+	/**
+	 * Converts the whole binary input stream to CSV output including the
+	 * CSV header. For default separators, the output is identical to the
+	 * output of OutputHandlerCsv for the same columns.
+	 *
+	 * @param in the binary stream to read from
+	 * @param out the stream to write the CSV data to
+	 * @param colSep the column separator to be used
+	 * @param listSep the separator to be used within list columns
+	 * @return the number of converted rows
+	 */
+	static
+	size_t
+	convertToCsv( std::istream & in, std::ostream & out
+				, const std::string & colSep = ";"
+				, const std::string & listSep = ":" );
+
+protected:
+
+	//! the stream to read from
+	std::istream & in;
+
+	//! the stored columns
+	OutputHandlerCsv::ColTypeList columns;
+
+	//! the flags of the file header
+	boost::uint8_t flags;
+
+	//! the column data of the current row group
+	std::vector< OutputHandlerBinary::Column > data;
+
+	//! number of rows of the current row group
+	size_t rows;
+
+	/**
+	 * Reads a given number of bytes from the input stream.
+	 * @param buffer the buffer to fill
+	 * @param bytes the number of bytes to read
+	 * @throws std::runtime_error if not enough data is available
+	 */
+	void
+	read( char * buffer, const size_t bytes );
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+const OutputHandlerCsv::ColTypeList &
+OutputHandlerBinaryReader::
+getColumns() const
+{
+	return columns;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+OutputHandlerBinaryReader::
+isBestSeedOnly() const
+{
+	return (flags & OutputHandlerBinary::flagBestSeedOnly) != 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+OutputHandlerBinaryReader::
+size() const
+{
+	return rows;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+std::string
+OutputHandlerBinaryReader::
+getString( const size_t col, const size_t row ) const
+{
+	const OutputHandlerBinary::Column & c = data.at(col);
+	if (c.type == OutputHandlerBinary::STRING_DICT) {
+		return c.dict.at( c.codes.at(row) );
+	}
+	return c.chars.substr( c.offsets.at(row), c.offsets.at(row+1)-c.offsets.at(row) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+long
+OutputHandlerBinaryReader::
+getInt( const size_t col, const size_t row ) const
+{
+	return data.at(col).ints.at(row);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+OutputHandlerBinaryReader::
+isAvailable( const size_t col, const size_t row ) const
+{
+	return data.at(col).available.at(row) != 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+double
+OutputHandlerBinaryReader::
+getFloat( const size_t col, const size_t row ) const
+{
+	return data.at(col).floats.at(row);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+std::vector<long>
+OutputHandlerBinaryReader::
+getIntList( const size_t col, const size_t row ) const
+{
+	const OutputHandlerBinary::Column & c = data.at(col);
+	return std::vector<long>( c.ints.begin()+c.offsets.at(row), c.ints.begin()+c.offsets.at(row+1) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+std::vector<double>
+OutputHandlerBinaryReader::
+getFloatList( const size_t col, const size_t row ) const
+{
+	const OutputHandlerBinary::Column & c = data.at(col);
+	return std::vector<double>( c.floats.begin()+c.offsets.at(row), c.floats.begin()+c.offsets.at(row+1) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_OUTPUTHANDLERBINARYREADER_H_ */
@@ -30,6 +30,8 @@ const OutputHandlerCsv::ColTypeList OutputHandlerCsv::colTypeNumericSort(
 		",Etotal,EallTotal"
 		",P_E"
 		",RT"
+		",pvalEmp,pvalGauss,pvalGumbel"
+		",Efuse"
 		));
 
 ////////////////////////////////////////////////////////////////////////
@@ -47,6 +49,9 @@ OutputHandlerCsv::OutputHandlerCsv(
 	, out(out_)
 	, energy(energy)
 	, columns(columns)
+	, columnPlan(columns.begin(), columns.end())
+	, columnsNeedED(needED(columns))
+	, columnsNeedContributions(needContributions(columns))
 	, colSep(colSep)
 	, listSep(listSep)
 {
@@ -105,377 +110,414 @@ add( const Interaction & i )
 	const size_t i2 = i.basePairs.begin()->second;
 	const size_t j2 = i.basePairs.rbegin()->second;
 
-	// get individual energy contributions
-	InteractionEnergy::EnergyContributions contr = energy.getE_contributions(i);
+	// get individual energy contributions (only if needed)
+	InteractionEnergy::EnergyContributions contr{};
+	if (columnsNeedContributions) {
+		contr = energy.getE_contributions(i);
+	} else if (columnsNeedED) {
+		contr.ED1 = energy.getED1( energy.getIndex1(*i.basePairs.begin()), energy.getIndex1(*i.basePairs.rbegin()) );
+		contr.ED2 = energy.getED2( energy.getIndex2(*i.basePairs.begin()), energy.getIndex2(*i.basePairs.rbegin()) );
+	}
 
-	// ensure outputs do not intervene
-	{
-		std::stringstream outTmp;
+	// per-thread row buffer to avoid reallocation for each interaction
+	static thread_local std::string row;
+	row.clear();
 
-		for (auto col = columns.begin(); col != columns.end(); col++) {
-			// print separator if needed
-			if (col != columns.begin()) {
-				outTmp <<colSep;
+	for (auto col = columnPlan.begin(); col != columnPlan.end(); col++) {
+		// print separator if needed
+		if (col != columnPlan.begin()) {
+			row.append(colSep);
+		}
+		// print this column information
+		switch ( *col ) {
+
+		case id1:
+			// ensure no colSeps are contained
+			appendId( row, i.s1->getId(), colSep, 0 );
+			break;
+
+		case id2:
+			// ensure no colSeps are contained
+			appendId( row, i.s2->getId(), colSep, 1 );
+			break;
+
+		case seq1:
+			row.append( i.s1->asString() );
+			break;
+
+		case seq2:
+			row.append( i.s2->asString() );
+			break;
+
+		case subseq1:
+			row.append( i.s1->asString(), i1, j1-i1+1 );
+			break;
+
+		case subseq2:
+			row.append( i.s2->asString(), j2, i2-j2+1 );
+			break;
+
+		case subseqDP:
+			row.append( i.s1->asString(), i1, j1-i1+1 );
+			row.push_back('&');
+			row.append( i.s2->asString(), j2, i2-j2+1 );
+			break;
+
+		case subseqDB:
+			append( row, i.s1->getInOutIndex(i1) );
+			row.append( i.s1->asString(), i1, j1-i1+1 );
+			row.push_back('&');
+			append( row, i.s2->getInOutIndex(j2) );
+			row.append( i.s2->asString(), j2, i2-j2+1 );
+			break;
+
+		case start1:
+			append( row, i.s1->getInOutIndex(i1) );
+			break;
+
+		case end1:
+			append( row, i.s1->getInOutIndex(j1) );
+			break;
+
+		case start2:
+			append( row, i.s2->getInOutIndex(j2) );
+			break;
+
+		case end2:
+			append( row, i.s2->getInOutIndex(i2) );
+			break;
+
+		case hybridDP:
+			row.append( Interaction::dotBracket( i ) );
+			break;
+
+		case hybridDB:
+			row.append( Interaction::dotBar( i ) );
+			break;
+
+		case hybridDPfull:
+			row.append( Interaction::dotBracket( i, '(', ')', true ) );
+			break;
+
+		case hybridDBfull:
+			row.append( Interaction::dotBar( i, true ) );
+			break;
+
+		case bpList: {
+			for( auto bp = i.basePairs.begin(); bp != i.basePairs.end(); bp++ ) {
+				if (bp != i.basePairs.begin()) {
+					row.append( listSep );
+				}
+				row.push_back('(');
+				append( row, i.s1->getInOutIndex(bp->first) );
+				row.push_back(',');
+				append( row, i.s2->getInOutIndex(bp->second) );
+				row.push_back(')');
+			};
+			break;}
+
+		case E:
+			append( row, E_2_Ekcal(i.energy) );
+			break;
+
+		case Etotal:
+			if ( E_isINF(energy.getEall1()) || E_isINF(energy.getEall2()) )
+				row.append( notAvailable );
+			else
+				append( row, E_2_Ekcal( i.energy + energy.getEall1() + energy.getEall2() ) );
+			break;
+
+		case ED1:
+			append( row, E_2_Ekcal(contr.ED1) );
+			break;
+
+		case ED2:
+			append( row, E_2_Ekcal(contr.ED2) );
+			break;
+
+		case Pu1:
+			append( row, (E_equal(contr.ED1,0) ? Z_type(1) : energy.getBoltzmannWeight(contr.ED1)) );
+			break;
+
+		case Pu2:
+			append( row, (E_equal(contr.ED2,0) ? Z_type(1) : energy.getBoltzmannWeight(contr.ED2)) );
+			break;
+
+		case E_init:
+			append( row, E_2_Ekcal(contr.init) );
+			break;
+
+		case E_loops:
+			append( row, E_2_Ekcal(contr.loops) );
+			break;
+
+		case E_dangleL:
+			append( row, E_2_Ekcal(contr.dangleLeft) );
+			break;
+
+		case E_dangleR:
+			append( row, E_2_Ekcal(contr.dangleRight) );
+			break;
+
+		case E_endL:
+			append( row, E_2_Ekcal(contr.endLeft) );
+			break;
+
+		case E_endR:
+			append( row, E_2_Ekcal(contr.endRight) );
+			break;
+
+		case E_hybrid:
+			append( row, E_2_Ekcal(i.energy - contr.ED1 - contr.ED2) );
+			break;
+
+		case E_norm:
+			append( row, E_2_Ekcal(i.energy) / std::log( energy.size1() * energy.size2() ) );
+			break;
+
+		case E_hybridNorm:
+			append( row, E_2_Ekcal(i.energy - contr.ED1 - contr.ED2) / std::log( energy.size1() * energy.size2() ) );
+			break;
+
+		case E_add:
+			append( row, E_2_Ekcal(contr.energyAdd) );
+			break;
+
+		case w:
+			append( row, energy.getBoltzmannWeight(i.energy) );
+			break;
+
+		case seedStart1:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, i.s1->getInOutIndex(i.seed->begin()->bp_i.first) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, i.s1->getInOutIndex(s.bp_i.first) );
+								});
+				}
 			}
-			// print this column information
-			switch ( *col ) {
-
-			case id1:
-				// ensure no colSeps are contained
-				outTmp <<boost::replace_all_copy(i.s1->getId(), colSep, "_");
-				break;
-
-			case id2:
-				// ensure no colSeps are contained
-				outTmp <<boost::replace_all_copy(i.s2->getId(), colSep, "_");
-				break;
-
-			case seq1:
-				outTmp <<i.s1->asString();
-				break;
-
-			case seq2:
-				outTmp <<i.s2->asString();
-				break;
-
-			case subseq1:
-				outTmp <<i.s1->asString().substr(i1, j1-i1+1);
-				break;
-
-			case subseq2:
-				outTmp <<i.s2->asString().substr(j2, i2-j2+1);
-				break;
-
-			case subseqDP:
-				outTmp <<i.s1->asString().substr(i1, j1-i1+1)
-					<<'&'
-					<<i.s2->asString().substr(j2, i2-j2+1);
-				break;
-
-			case subseqDB:
-				outTmp <<i.s1->getInOutIndex(i1)
-					<<i.s1->asString().substr(i1, j1-i1+1)
-					<<'&'
-					<<i.s2->getInOutIndex(j2)
-					<<i.s2->asString().substr(j2, i2-j2+1);
-				break;
-
-			case start1:
-				outTmp <<i.s1->getInOutIndex(i1);
-				break;
-
-			case end1:
-				outTmp <<i.s1->getInOutIndex(j1);
-				break;
-
-			case start2:
-				outTmp <<i.s2->getInOutIndex(j2);
-				break;
-
-			case end2:
-				outTmp <<i.s2->getInOutIndex(i2);
-				break;
-
-			case hybridDP:
-				outTmp <<Interaction::dotBracket( i );
-				break;
-
-			case hybridDB:
-				outTmp <<Interaction::dotBar( i );
-				break;
-
-			case hybridDPfull:
-				outTmp <<Interaction::dotBracket( i, '(', ')', true );
-				break;
-
-			case hybridDBfull:
-				outTmp <<Interaction::dotBar( i, true );
-				break;
-
-			case bpList: {
-				auto bp = i.basePairs.begin();
-				outTmp <<'(' <<i.s1->getInOutIndex(bp->first) <<',' <<i.s2->getInOutIndex(bp->second) <<')' ;
-				for( ++bp; bp != i.basePairs.end(); bp++ ) {
-					outTmp << listSep <<'(' <<i.s1->getInOutIndex(bp->first) <<',' <<i.s2->getInOutIndex(bp->second) <<')';
-				};
-				break;}
-
-			case E:
-				outTmp <<E_2_Ekcal(i.energy);
-				break;
-
-			case Etotal:
-				if ( E_isINF(energy.getEall1()) || E_isINF(energy.getEall2()) )
-					outTmp << notAvailable;
-				else
-					outTmp <<E_2_Ekcal( i.energy + energy.getEall1() + energy.getEall2() );
-				break;
-
-			case ED1:
-				outTmp <<E_2_Ekcal(contr.ED1);
-				break;
-
-			case ED2:
-				outTmp <<E_2_Ekcal(contr.ED2);
-				break;
-
-			case Pu1:
-				outTmp <<(E_equal(contr.ED1,0) ? Z_type(1) : energy.getBoltzmannWeight(contr.ED1));
-				break;
-
-			case Pu2:
-				outTmp <<(E_equal(contr.ED2,0) ? Z_type(1) : energy.getBoltzmannWeight(contr.ED2));
-				break;
-
-			case E_init:
-				outTmp <<E_2_Ekcal(contr.init);
-				break;
-
-			case E_loops:
-				outTmp <<E_2_Ekcal(contr.loops);
-				break;
-
-			case E_dangleL:
-				outTmp <<E_2_Ekcal(contr.dangleLeft);
-				break;
-
-			case E_dangleR:
-				outTmp <<E_2_Ekcal(contr.dangleRight);
-				break;
-
-			case E_endL:
-				outTmp <<E_2_Ekcal(contr.endLeft);
-				break;
-
-			case E_endR:
-				outTmp <<E_2_Ekcal(contr.endRight);
-				break;
-
-			case E_hybrid:
-				outTmp <<E_2_Ekcal(i.energy - contr.ED1 - contr.ED2);
-				break;
-
-			case E_norm:
-				outTmp <<E_2_Ekcal(i.energy) / std::log( energy.size1() * energy.size2() );
-				break;
-
-			case E_hybridNorm:
-				outTmp <<E_2_Ekcal(i.energy - contr.ED1 - contr.ED2) / std::log( energy.size1() * energy.size2() );
-				break;
-
-			case E_add:
-				outTmp <<E_2_Ekcal(contr.energyAdd);
-				break;
-
-			case w:
-				outTmp <<energy.getBoltzmannWeight(i.energy);
-				break;
-
-			case seedStart1:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						outTmp << std::accumulate( std::next( i.seed->begin() )
-										, i.seed->end()
-										, toString( i.s1->getInOutIndex(i.seed->begin()->bp_i.first) ) // start with first element
-										, [&](std::string a, Interaction::Seed s) {
-											 return std::move(a) + listSep + toString( i.s1->getInOutIndex(s.bp_i.first) ); // extend list
-										 });
-					} else {
-						outTmp <<i.s1->getInOutIndex(i.seed->begin()->bp_i.first);
-					}
+			break;
+
+		case seedEnd1:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, i.s1->getInOutIndex(i.seed->begin()->bp_j.first) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, i.s1->getInOutIndex(s.bp_j.first) );
+								});
 				}
-				break;
-
-			case seedEnd1:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						outTmp << std::accumulate( std::next( i.seed->begin() )
-										, i.seed->end()
-										, toString( i.s1->getInOutIndex(i.seed->begin()->bp_j.first) ) // start with first element
-										, [&](std::string a, Interaction::Seed s) {
-											 return std::move(a) + listSep + toString( i.s1->getInOutIndex(s.bp_j.first) ); // extend list
-										 });
-					} else {
-						outTmp <<i.s1->getInOutIndex(i.seed->begin()->bp_j.first);
-					}
+			}
+			break;
+
+		case seedStart2:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, i.s2->getInOutIndex(i.seed->begin()->bp_j.second) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, i.s2->getInOutIndex(s.bp_j.second) );
+								});
 				}
-				break;
-
-			case seedStart2:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						outTmp << std::accumulate( std::next( i.seed->begin() )
-										, i.seed->end()
-										, toString( i.s2->getInOutIndex(i.seed->begin()->bp_j.second) ) // start with first element
-										, [&](std::string a, Interaction::Seed s) {
-											 return std::move(a) + listSep + toString( i.s2->getInOutIndex(s.bp_j.second) ); // extend list
-										 });
-					} else {
-						outTmp <<i.s2->getInOutIndex(i.seed->begin()->bp_j.second);
-					}
+			}
+			break;
+
+		case seedEnd2:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, i.s2->getInOutIndex(i.seed->begin()->bp_i.second) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, i.s2->getInOutIndex(s.bp_i.second) );
+								});
 				}
-				break;
-
-			case seedEnd2:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						outTmp << std::accumulate( std::next( i.seed->begin() )
-										, i.seed->end()
-										, toString( i.s2->getInOutIndex(i.seed->begin()->bp_i.second) ) // start with first element
-										, [&](std::string a, Interaction::Seed s) {
-											 return std::move(a) + listSep + toString( i.s2->getInOutIndex(s.bp_i.second) ); // extend list
-										 });
-					} else {
-						outTmp <<i.s2->getInOutIndex(i.seed->begin()->bp_i.second);
-					}
+			}
+			break;
+
+		case seedE:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, E_2_Ekcal(i.seed->begin()->energy) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, E_2_Ekcal(s.energy) );
+								});
 				}
-				break;
-
-			case seedE:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					outTmp << E_2_Ekcal(i.seed->begin()->energy);
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						// print via std::for_each instead of std::accumulate due to rounding issues of boost::lexical_cast or std::to_string
-						// since sometimes (float(int)/100.0) gives strings with 10E-5 deviations of expected value
-						std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
-									 outTmp << listSep << E_2_Ekcal(s.energy);
-									});
-					}
+			}
+			break;
+
+		case seedED1:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, E_2_Ekcal(energy.getED1( i.seed->begin()->bp_i.first, i.seed->begin()->bp_j.first )) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, E_2_Ekcal(energy.getED1( s.bp_i.first, s.bp_j.first )) );
+								});
 				}
-				break;
-
-			case seedED1:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					outTmp << E_2_Ekcal(energy.getED1( i.seed->begin()->bp_i.first, i.seed->begin()->bp_j.first ));
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
-									 outTmp << listSep << E_2_Ekcal(energy.getED1( s.bp_i.first, s.bp_j.first ));
-									});
-					}
+			}
+			break;
+
+		case seedED2:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				append( row, E_2_Ekcal(energy.getAccessibility2().getAccessibilityOrigin().getED( i.seed->begin()->bp_j.second, i.seed->begin()->bp_i.second )) );
+				if (!outConstraint.bestSeedOnly) {
+					// generate list
+					std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
+								row.append( listSep );
+								append( row, E_2_Ekcal(energy.getAccessibility2().getAccessibilityOrigin().getED( s.bp_j.second, s.bp_i.second )) );
+								});
 				}
-				break;
-
-			case seedED2:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					outTmp << E_2_Ekcal(energy.getAccessibility2().getAccessibilityOrigin().getED( i.seed->begin()->bp_j.second, i.seed->begin()->bp_i.second ));
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						std::for_each( ++(i.seed->begin()), i.seed->end(), [&]( const Interaction::Seed & s) {
-							outTmp << listSep << E_2_Ekcal(energy.getAccessibility2().getAccessibilityOrigin().getED( s.bp_j.second, s.bp_i.second ));
-						});
+			}
+			break;
+
+		case seedPu1:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				if (!outConstraint.bestSeedOnly) {
+					// generate list (with toString() precision)
+					for (auto s = i.seed->begin(); s != i.seed->end(); s++) {
+						if (s != i.seed->begin()) {
+							row.append( listSep );
+						}
+						appendExact( row, energy.getBoltzmannWeight( energy.getED1( s->bp_i.first, s->bp_j.first ) ) );
 					}
-				}
-				break;
-
-			case seedPu1:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
 				} else {
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						outTmp << std::accumulate( std::next( i.seed->begin() )
-										, i.seed->end()
-										, toString( energy.getBoltzmannWeight( energy.getED1( i.seed->begin()->bp_i.first, i.seed->begin()->bp_j.first )) ) // start with first element
-										, [&](std::string a, Interaction::Seed s) {
-											 return std::move(a) + listSep + toString( energy.getBoltzmannWeight( energy.getED1( s.bp_i.first, s.bp_j.first ) ) ); // extend list
-										 });
-					} else {
-						outTmp <<energy.getBoltzmannWeight( energy.getED1( i.seed->begin()->bp_i.first, i.seed->begin()->bp_j.first ));
-					}
+					append( row, energy.getBoltzmannWeight( energy.getED1( i.seed->begin()->bp_i.first, i.seed->begin()->bp_j.first )) );
 				}
-				break;
-
-			case seedPu2:
-				if (i.seed == NULL) {
-					outTmp <<notAvailable;
-				} else {
-					if (!outConstraint.bestSeedOnly) {
-						// generate list
-						outTmp << std::accumulate( std::next( i.seed->begin() )
-										, i.seed->end()
-										, toString( energy.getBoltzmannWeight( energy.getAccessibility2().getAccessibilityOrigin().getED( i.seed->begin()->bp_j.second, i.seed->begin()->bp_i.second )) ) // start with first element
-										, [&](std::string a, Interaction::Seed s) {
-											 return std::move(a) + listSep + toString( energy.getBoltzmannWeight( energy.getAccessibility2().getAccessibilityOrigin().getED( s.bp_j.second, s.bp_i.second ) ) ); // extend list
-										 });
-					} else {
-						outTmp <<energy.getBoltzmannWeight( energy.getAccessibility2().getAccessibilityOrigin().getED( i.seed->begin()->bp_j.second, i.seed->begin()->bp_i.second ));
+			}
+			break;
+
+		case seedPu2:
+			if (i.seed == NULL) {
+				row.append( notAvailable );
+			} else {
+				if (!outConstraint.bestSeedOnly) {
+					// generate list (with toString() precision)
+					for (auto s = i.seed->begin(); s != i.seed->end(); s++) {
+						if (s != i.seed->begin()) {
+							row.append( listSep );
+						}
+						appendExact( row, energy.getBoltzmannWeight( energy.getAccessibility2().getAccessibilityOrigin().getED( s->bp_j.second, s->bp_i.second ) ) );
 					}
+				} else {
+					append( row, energy.getBoltzmannWeight( energy.getAccessibility2().getAccessibilityOrigin().getED( i.seed->begin()->bp_j.second, i.seed->begin()->bp_i.second )) );
 				}
-				break;
+			}
+			break;
 
-			case Eall:
-				if ( Z_equal(Z,Z_type(0)) ) outTmp << notAvailable; else outTmp <<E_2_Ekcal(energy.getE(Z));
-				break;
+		case Eall:
+			if ( Z_equal(Z,Z_type(0)) ) row.append( notAvailable ); else append( row, E_2_Ekcal(energy.getE_scaled(Z)) );
+			break;
 
-			case Eall1:
-				if ( E_isINF(energy.getEall1()) ) outTmp << notAvailable; else outTmp <<E_2_Ekcal(energy.getEall1());
-				break;
+		case Eall1:
+			if ( E_isINF(energy.getEall1()) ) row.append( notAvailable ); else append( row, E_2_Ekcal(energy.getEall1()) );
+			break;
 
-			case Eall2:
-				if ( E_isINF(energy.getEall2()) ) outTmp << notAvailable; else outTmp <<E_2_Ekcal(energy.getEall2());
-				break;
+		case Eall2:
+			if ( E_isINF(energy.getEall2()) ) row.append( notAvailable ); else append( row, E_2_Ekcal(energy.getEall2()) );
+			break;
 
-			case EallTotal:
-				if ( Z_equal(Z,Z_type(0)) || E_isINF(energy.getEall1()) || E_isINF(energy.getEall2()) )
-					outTmp << notAvailable;
-				else
-					outTmp <<E_2_Ekcal( energy.getE(Z) + energy.getEall1() + energy.getEall2() );
-				break;
+		case EallTotal:
+			if ( Z_equal(Z,Z_type(0)) || E_isINF(energy.getEall1()) || E_isINF(energy.getEall2()) )
+				row.append( notAvailable );
+			else
+				append( row, E_2_Ekcal( energy.getE_scaled(Z) + energy.getEall1() + energy.getEall2() ) );
+			break;
 
-			case Zall:
-				if ( Z_equal(Z,Z_type(0)) ) outTmp << notAvailable; else outTmp <<Z;
-				break;
+		case Zall:
+			if ( Z_equal(Z,Z_type(0)) ) row.append( notAvailable ); else append( row, Z );
+			break;
 
-			case Zall1:
-				if ( E_isINF(energy.getEall1()) ) outTmp << notAvailable; else outTmp <<energy.getBoltzmannWeight(energy.getEall1());
-				break;
+		case Zall1:
+			if ( E_isINF(energy.getEall1()) ) row.append( notAvailable ); else append( row, energy.getBoltzmannWeight(energy.getEall1()) );
+			break;
 
-			case Zall2:
-				if ( E_isINF(energy.getEall2()) ) outTmp << notAvailable; else outTmp <<energy.getBoltzmannWeight(energy.getEall2());
-				break;
+		case Zall2:
+			if ( E_isINF(energy.getEall2()) ) row.append( notAvailable ); else append( row, energy.getBoltzmannWeight(energy.getEall2()) );
+			break;
 
-			case P_E:
-				if ( Z_equal(Z,Z_type(0)) ) outTmp << notAvailable; else outTmp <<(energy.getBoltzmannWeight(i.energy)/Z);
-				break;
+		case P_E:
+			if ( Z_equal(Z,Z_type(0)) ) row.append( notAvailable ); else append( row, (energy.getBoltzmannWeightScaled(i.energy)/Z) );
+			break;
 
-			case RT:
-				outTmp << energy.getRT();
-				break;
+		case RT:
+			append( row, energy.getRT() );
+			break;
 
-			default : throw std::runtime_error("OutputHandlerCsv::add() : unhandled ColType '"+colType2string[*col]+"'");
-			}
+		case pvalEmp:
+			if ( pValueEstimator.empty() ) row.append( notAvailable ); else append( row, pValueEstimator.getPValueEmpirical( E_2_Ekcal(i.energy) ) );
+			break;
+
+		case pvalGauss:
+			if ( pValueEstimator.empty() ) row.append( notAvailable ); else append( row, pValueEstimator.getPValueGauss( E_2_Ekcal(i.energy) ) );
+			break;
+
+		case pvalGumbel:
+			if ( pValueEstimator.empty() ) row.append( notAvailable ); else append( row, pValueEstimator.getPValueGumbel( E_2_Ekcal(i.energy) ) );
+			break;
+
+		case Efuse:
+			if ( getFusion(i) == NULL ) row.append( notAvailable ); else append( row, E_2_Ekcal( i.energy + getFusion(i)->energy ) );
+			break;
+
+		case hybridDPfuse:
+			if ( getFusion(i) == NULL ) row.append( notAvailable ); else row.append( Interaction::dotBracket( *getFusion(i) ) );
+			break;
+
+		default : throw std::runtime_error("OutputHandlerCsv::add() : unhandled ColType '"+colType2string[*col]+"'");
 		}
-		outTmp <<'\n';
-	#if INTARNA_MULITHREADING
-		#pragma omp critical(intarna_omp_outputStreamUpdate)
-	#endif
-		{
-			out << outTmp.str();
-		} // omp critical(intarna_omp_outputStreamUpdate)
 	}
+	row.push_back('\n');
+
+	// ensure outputs do not intervene
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputStreamUpdate)
+#endif
+	{
+		out.write( row.c_str(), row.size() );
+	} // omp critical(intarna_omp_outputStreamUpdate)
 
 }
 
 ////////////////////////////////////////////////////////////////////////
 
+void
+OutputHandlerCsv::
+appendId( std::string & row, const std::string & id, const std::string & colSep, const size_t slot )
+{
+	// per-thread cache of the last sanitized identifiers
+	static thread_local std::string lastId[2], lastColSep[2], lastSanitized[2];
+	if (id != lastId[slot] || colSep != lastColSep[slot] || lastSanitized[slot].empty()) {
+		lastId[slot] = id;
+		lastColSep[slot] = colSep;
+		lastSanitized[slot] = boost::replace_all_copy(id, colSep, "_");
+	}
+	row.append( lastSanitized[slot] );
+}
+
+////////////////////////////////////////////////////////////////////////
+
 } // namespace
@@ -11,6 +11,10 @@
 #include <list>
 #include <map>
 #include <numeric>
+#include <vector>
+
+#include <cstdio>
+#include <sstream>
 
 #include <boost/algorithm/string.hpp>
 
@@ -83,6 +87,13 @@ public:
 		EallTotal, //!< total ensemble energy (Eall+Eall1+Eall2) of all interactions including the intra-molecular ensemble energies (outConstraint.needZall)
 		P_E, //!< probability of mfe within interaction ensemble (outConstraint.needZall)
 		RT, //!< the scaled temperature used for Boltzmann weight computation
+		// output only available if p-values are estimated (getPValueEstimator())
+		pvalEmp, //!< empirical p-value of the interaction energy wrt. the null model
+		pvalGauss, //!< p-value of the interaction energy based on the Gauss distribution fitted to the null model
+		pvalGumbel, //!< p-value of the interaction energy based on the Gumbel distribution fitted to the null model
+		// output only available if fusion partners are computed (getFusion())
+		Efuse, //!< overall energy of the interaction and its fusion partner
+		hybridDPfuse, //!< fusion partner in VRNA dot-bracket notation
 		ColTypeNumber //!< number of column types
 	};
 
@@ -164,6 +175,11 @@ protected:
 			colType2string[Zall2] = "Zall2";
 			colType2string[P_E] = "P_E";
 			colType2string[RT] = "RT";
+			colType2string[pvalEmp] = "pvalEmp";
+			colType2string[pvalGauss] = "pvalGauss";
+			colType2string[pvalGumbel] = "pvalGumbel";
+			colType2string[Efuse] = "Efuse";
+			colType2string[hybridDPfuse] = "hybridDPfuse";
 			// ensure filling is complete
 			for (size_t i=0; i<ColTypeNumber; i++) {
 				if ( colType2string.find( static_cast<ColType>(i) ) == colType2string.end() ) {
@@ -258,6 +274,28 @@ public:
 	bool
 	needBPs( const ColTypeList & colTypes );
 
+	/**
+	 * Checks whether or not the ED values of the interacting subsequences
+	 * are needed to generate all colTypes
+	 * @param colTypes the list of column types to consider
+	 * @return true if one of the colTypes requires ED values;
+	 *         false otherwise.
+	 */
+	static
+	bool
+	needED( const ColTypeList & colTypes );
+
+	/**
+	 * Checks whether or not the full energy decomposition is needed to
+	 * generate all colTypes
+	 * @param colTypes the list of column types to consider
+	 * @return true if one of the colTypes requires energy contributions
+	 *         beside ED values; false otherwise.
+	 */
+	static
+	bool
+	needContributions( const ColTypeList & colTypes );
+
 	/**
 	 * Generates the header line for a given list of columns
 	 * @param colTypes the list of column types to consider
@@ -268,6 +306,57 @@ public:
 	std::string
 	getHeader( const ColTypeList & colTypes, const std::string& colSep );
 
+	/**
+	 * Appends an integral number to the row.
+	 * @param row the row to extend
+	 * @param value the value to append
+	 */
+	static
+	void
+	append( std::string & row, const long value );
+
+	/**
+	 * Appends a floating point number to the row using the default stream
+	 * formatting (6 significant digits).
+	 * @param row the row to extend
+	 * @param value the value to append
+	 */
+	static
+	void
+	append( std::string & row, const double value );
+
+	/**
+	 * Appends a floating point number to the row using the same formatting
+	 * as toString(), i.e. with full precision.
+	 * @param row the row to extend
+	 * @param value the value to append
+	 */
+	static
+	void
+	appendExact( std::string & row, const double value );
+
+#if INTARNA_MULTIPRECISION
+	/**
+	 * Appends a floating point number to the row using the default stream
+	 * formatting.
+	 * @param row the row to extend
+	 * @param value the value to append
+	 */
+	static
+	void
+	append( std::string & row, const Z_type & value );
+
+	/**
+	 * Appends a floating point number to the row using the same formatting
+	 * as toString().
+	 * @param row the row to extend
+	 * @param value the value to append
+	 */
+	static
+	void
+	appendExact( std::string & row, const Z_type & value );
+#endif
+
 
 protected:
 
@@ -283,12 +372,37 @@ protected:
 	//! the sequence of columns to be reported
 	const std::list< ColType > columns;
 
+	//! flat copy of the columns to be reported, resolved once at construction
+	//! to avoid list traversal for each reported interaction
+	const std::vector< ColType > columnPlan;
+
+	//! whether or not a column requires the ED values of the interaction
+	const bool columnsNeedED;
+
+	//! whether or not a column requires the full energy decomposition,
+	//! i.e. the call of InteractionEnergy::getE_contributions()
+	const bool columnsNeedContributions;
+
 	//! the column separator to be used
 	std::string colSep;
 
 	//! the list separator to be used within single columns
 	std::string listSep;
 
+	/**
+	 * Appends a sequence identifier to the row where all column separators
+	 * are replaced by '_'. The sanitized identifiers are cached per thread,
+	 * such that the replacement is done only once per sequence.
+	 *
+	 * @param row the row to extend
+	 * @param id the identifier to append
+	 * @param colSep the column separator to be replaced
+	 * @param slot the cache slot to be used (0 or 1)
+	 */
+	static
+	void
+	appendId( std::string & row, const std::string & id, const std::string & colSep, const size_t slot );
+
 
 
 };
@@ -417,6 +531,112 @@ needBPs( const ColTypeList & colTypes )
 
 //////////////////////////////////////////////////////////////////////////
 
+inline
+bool
+OutputHandlerCsv::
+needED( const ColTypeList & colTypes )
+{
+	for (auto it = colTypes.begin(); it != colTypes.end(); it++ ) {
+		// check if type requires ED values
+		switch ( *it ) {
+		case ED1:
+		case ED2:
+		case Pu1:
+		case Pu2:
+		case E_hybrid:
+		case E_hybridNorm:
+			return true;
+		}
+	}
+	return needContributions( colTypes );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+OutputHandlerCsv::
+needContributions( const ColTypeList & colTypes )
+{
+	for (auto it = colTypes.begin(); it != colTypes.end(); it++ ) {
+		// check if type requires the energy decomposition
+		switch ( *it ) {
+		case E_init:
+		case E_loops:
+		case E_dangleL:
+		case E_dangleR:
+		case E_endL:
+		case E_endR:
+		case E_add:
+			return true;
+		}
+	}
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerCsv::
+append( std::string & row, const long value )
+{
+	char buffer[32];
+	row.append( buffer, std::snprintf( buffer, sizeof(buffer), "%ld", value ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerCsv::
+append( std::string & row, const double value )
+{
+	// same as default std::ostream formatting
+	char buffer[64];
+	row.append( buffer, std::snprintf( buffer, sizeof(buffer), "%g", value ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerCsv::
+appendExact( std::string & row, const double value )
+{
+	// same as boost::lexical_cast formatting
+	char buffer[64];
+	row.append( buffer, std::snprintf( buffer, sizeof(buffer), "%.17g", value ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+#if INTARNA_MULTIPRECISION
+
+inline
+void
+OutputHandlerCsv::
+append( std::string & row, const Z_type & value )
+{
+	std::ostringstream tmp;
+	tmp <<value;
+	row.append( tmp.str() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerCsv::
+appendExact( std::string & row, const Z_type & value )
+{
+	row.append( toString(value) );
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 inline
 std::string
 OutputHandlerCsv::
@@ -43,10 +43,10 @@ OutputHandlerEnsemble::
 //		<<"Zall " <<getZ() <<'\n'
 //		<<"Zall1 " <<(E_isINF(energy.getEall1())? 0 : energy.getBoltzmannWeight(energy.getEall1())) <<'\n'
 //		<<"Zall2 " <<(E_isINF(energy.getEall2())? 0 : energy.getBoltzmannWeight(energy.getEall2())) <<'\n'
-		<<"Eall " <<(Z_equal(getZ(),Z_type(0)) ? 0 : E_2_Ekcal(energy.getE(getZ()))) <<'\n'
+		<<"Eall " <<(Z_equal(getZ(),Z_type(0)) ? 0 : E_2_Ekcal(energy.getE_scaled(getZ()))) <<'\n'
 		<<"Eall1 " <<(E_isINF(energy.getEall1())? 0 : E_2_Ekcal(energy.getEall1())) <<'\n'
 		<<"Eall2 " <<(E_isINF(energy.getEall2())? 0 : E_2_Ekcal(energy.getEall2())) <<'\n'
-		<<"EallTotal " <<(Z_equal(getZ(),Z_type(0))||E_isINF(energy.getEall1())||E_isINF(energy.getEall2())? 0 : E_2_Ekcal(energy.getE(getZ())+energy.getEall1()+energy.getEall2())) <<'\n'
+		<<"EallTotal " <<(Z_equal(getZ(),Z_type(0))||E_isINF(energy.getEall1())||E_isINF(energy.getEall2())? 0 : E_2_Ekcal(energy.getE_scaled(getZ())+energy.getEall1()+energy.getEall2())) <<'\n'
 		;
 #if INTARNA_MULITHREADING
 	#pragma omp critical(intarna_omp_outputStreamUpdate)
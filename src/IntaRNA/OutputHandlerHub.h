@@ -92,6 +92,25 @@ public:
 	Z_type
 	getZ() const;
 
+	/**
+	 * Forwards the null model for p-value estimation to all handlers.
+	 *
+	 * @param pValueEstimator the p-value estimation to be used
+	 */
+	virtual
+	void
+	setPValueEstimator( const PValueEstimator & pValueEstimator );
+
+	/**
+	 * Forwards the fusion partners of the reported interactions to all
+	 * handlers.
+	 *
+	 * @param fusions the fusion partners indexed by the interaction boundary
+	 */
+	virtual
+	void
+	setFusions( const FusionMap & fusions );
+
 	/**
 	 * Adds a new OutputHandler to the forwarding list.
 	 * @param handler pointer to the handler to forward to
@@ -243,6 +262,34 @@ incrementZ( const Z_type subZ )
 
 /////////////////////////////////////////////////////////////////////////
 
+inline
+void
+OutputHandlerHub::
+setPValueEstimator( const PValueEstimator & pValueEstimator )
+{
+	OutputHandler::setPValueEstimator( pValueEstimator );
+	// forward to all in list
+	for (auto it=outList.begin(); it!=outList.end(); it++) {
+		(*it)->setPValueEstimator(pValueEstimator);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////
+
+inline
+void
+OutputHandlerHub::
+setFusions( const FusionMap & fusions )
+{
+	OutputHandler::setFusions( fusions );
+	// forward to all in list
+	for (auto it=outList.begin(); it!=outList.end(); it++) {
+		(*it)->setFusions(fusions);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////
+
 inline
 Z_type
 OutputHandlerHub::
@@ -3,6 +3,10 @@
 
 #include <algorithm>
 
+#if INTARNA_MULITHREADING
+	#include <omp.h>
+#endif
+
 namespace IntaRNA
 {
 
@@ -13,6 +17,12 @@ OutputHandlerInteractionList(const OutputConstraint & outConstraint
 							, const size_t maxToStore)
  :	OutputHandler(outConstraint)
 	, storage()
+#if INTARNA_MULITHREADING
+	// one collector per thread + one shared collector
+	, collectors( omp_get_max_threads()+1 )
+#else
+	, collectors( 1 )
+#endif
 	, maxToStore(maxToStore)
 {
 }
@@ -27,50 +37,161 @@ OutputHandlerInteractionList::
 		delete (*it);
 	}
 	storage.clear();
+	for( auto c = collectors.begin(); c != collectors.end(); c++ ) {
+		for( auto it = c->best.begin(); it != c->best.end(); it++ ) {
+			delete (*it);
+		}
+		c->best.clear();
+	}
 }
 
 /////////////////////////////////////////////////////////////////////////////
 
-void
+size_t
 OutputHandlerInteractionList::
-add( const Interaction & interaction )
+getThreadIndex()
 {
-	if (interaction.isEmpty()) {
 #if INTARNA_MULITHREADING
-	#pragma omp critical(intarna_omp_OutputHandlerInteractionListUpdate)
+	return (size_t)omp_get_thread_num();
+#else
+	return 0;
 #endif
-		{
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerInteractionList::
+add( const Interaction & interaction )
+{
+	const size_t threadIndex = getThreadIndex();
+
+	// thread with own collector : no synchronization needed
+	if (threadIndex+1 < collectors.size()) {
+		Collector & collector = collectors[threadIndex];
 		// count interaction
-		reportedInteractions++;
+		collector.reported++;
+		if (!interaction.isEmpty()) {
+			insert( collector.best, interaction );
 		}
 		return;
 	}
 
+	// use shared collector
 #if INTARNA_MULITHREADING
 	#pragma omp critical(intarna_omp_OutputHandlerInteractionListUpdate)
 #endif
 	{
+		Collector & collector = collectors.back();
 		// count interaction
-		reportedInteractions++;
-		if (storage.size() < maxToStore || lessThan_StorageContainer( &interaction, *(storage.rbegin()) )) {
-			// find where to insert this interaction
-			StorageContainer::iterator insertPos = std::lower_bound( storage.begin(), storage.end(), &interaction, lessThan_StorageContainer );
-			// check if interaction is NOT already part of the list
-			if ( insertPos == storage.end() || lessThan_StorageContainer( &interaction, *(insertPos) ) ) {
-				// insert current interaction
-				storage.insert( insertPos, new Interaction(interaction) );
-				// remove last element if needed
-				if (storage.size() > maxToStore) {
-					// delete object
-					delete (*(storage.rbegin()));
-					// remove pointer
-					storage.resize(storage.size()-1);
-				}
-			}
+		collector.reported++;
+		if (!interaction.isEmpty()) {
+			insert( collector.best, interaction );
 		}
 	}
 }
 
 /////////////////////////////////////////////////////////////////////////////
 
+void
+OutputHandlerInteractionList::
+insert( StorageContainer & container, const Interaction & interaction ) const
+{
+	// check if interaction is among the best to store
+	if (maxToStore == 0
+		|| (container.size() >= maxToStore && !lessThan_StorageContainer( &interaction, container.back() )))
+	{
+		return;
+	}
+
+	// find where to insert this interaction
+	const size_t insertPos = std::lower_bound( container.begin(), container.end(), &interaction, lessThan_StorageContainer ) - container.begin();
+
+	// check if interaction is already part of the container
+	if ( insertPos < container.size() && !lessThan_StorageContainer( &interaction, container[insertPos] ) ) {
+		return;
+	}
+
+	Interaction * toInsert = NULL;
+	if (container.size() >= maxToStore) {
+		// reuse last element that drops out of the container
+		toInsert = container.back();
+		container.pop_back();
+		*toInsert = interaction;
+	} else {
+		toInsert = new Interaction(interaction);
+	}
+	// insert current interaction
+	container.insert( container.begin()+insertPos, toInsert );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+void
+OutputHandlerInteractionList::
+mergeCollectors() const
+{
+	// check if there is anything to merge
+	bool toMerge = false;
+	for( auto c = collectors.begin(); !toMerge && c != collectors.end(); c++ ) {
+		toMerge = !c->best.empty();
+	}
+	if (!toMerge) {
+		return;
+	}
+
+	// collect all candidates (already merged ones first)
+	StorageContainer candidates;
+	candidates.swap( storage );
+	for( auto c = collectors.begin(); c != collectors.end(); c++ ) {
+		candidates.insert( candidates.end(), c->best.begin(), c->best.end() );
+		c->best.clear();
+	}
+
+	// sort while preserving the insertion order of equivalent interactions
+	std::stable_sort( candidates.begin(), candidates.end(), lessThan_StorageContainer );
+
+	// keep the first of equivalent interactions and only the best maxToStore
+	storage.reserve( std::min( candidates.size(), maxToStore ) );
+	for( auto it = candidates.begin(); it != candidates.end(); it++ ) {
+		if (storage.size() < maxToStore
+			&& (storage.empty() || lessThan_StorageContainer( storage.back(), *it )))
+		{
+			storage.push_back( *it );
+		} else {
+			delete (*it);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+size_t
+OutputHandlerInteractionList::
+reported() const
+{
+	size_t reportedSum = reportedInteractions;
+	for( auto c = collectors.begin(); c != collectors.end(); c++ ) {
+		reportedSum += c->reported;
+	}
+	return reportedSum;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+size_t
+OutputHandlerInteractionList::
+reportedHits() const
+{
+	size_t hits = storage.size();
+	const size_t threadIndex = getThreadIndex();
+	// check collector of this thread if not shared
+	if (threadIndex+1 < collectors.size() || collectors.size() == 1) {
+		hits = std::max( hits, collectors[threadIndex].best.size() );
+	}
+	return hits;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
 } /* namespace IntaRNA */
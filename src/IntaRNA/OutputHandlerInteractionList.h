@@ -4,7 +4,7 @@
 
 #include "OutputHandler.h"
 
-#include <list>
+#include <vector>
 
 namespace IntaRNA
 {
@@ -12,20 +12,28 @@ namespace IntaRNA
 /**
  * OutputHandler that stores all reported interactions in a list
  *
+ * To avoid a serialization of parallel predictions (e.g. of different
+ * windows), each thread collects its k-best interactions in a separate
+ * bounded container. The thread-local containers are merged into the final
+ * sorted list on the first access to the stored interactions via begin(),
+ * end() or empty(), which must not overlap with concurrent add() calls.
+ *
  * NOTE: this handler does NOT support InteractionRange instances
  *
  */
 class OutputHandlerInteractionList: public OutputHandler
 {
+
 protected:
 
 	//! the container used internally for storing interactions
-	typedef std::list<Interaction*> StorageContainer;
+	typedef std::vector<Interaction*> StorageContainer;
 
 public:
 
 	//! const iterator on stored interactions
 	typedef StorageContainer::const_iterator const_iterator;
+
 	//! iterator on stored interactions
 	typedef StorageContainer::iterator iterator;
 
@@ -52,6 +60,26 @@ public:
 	void
 	add( const Interaction & interaction );
 
+	/**
+	 * Returns the number of reported interactions.
+	 * @return the number of reported interactions
+	 */
+	virtual
+	size_t
+	reported() const;
+
+	/**
+	 * Returns a lower bound of the number of currently stored interactions,
+	 * i.e. the maximum of the number of merged interactions and the number
+	 * of interactions collected by the calling thread. Without parallel
+	 * predictions, the exact number of stored interactions is returned.
+	 *
+	 * @return the (lower bound of the) number of stored interactions
+	 */
+	virtual
+	size_t
+	reportedHits() const;
+
 	//! whether or not the container is empty
 	//! @return true if no elements are stored
 	bool empty() const;
@@ -74,11 +102,30 @@ public:
 
 protected:
 
-	//! counter of reported interactions
+	/**
+	 * Bounded container of the k-best interactions reported by a single
+	 * thread, sorted via lessThan_StorageContainer.
+	 */
+	class Collector {
+	public:
+		//! the sorted best interactions (at most maxToStore)
+		StorageContainer best;
+		//! number of interactions reported to this collector
+		size_t reported;
+
+		//! construction of an empty collector
+		Collector() : best(), reported(0) {}
+	};
+
+	//! counter of reported interactions (not used, see collectors)
 	using OutputHandler::reportedInteractions;
 
-	//! container where interactions are stored
-	StorageContainer storage;
+	//! container where the merged interactions are stored
+	mutable StorageContainer storage;
+
+	//! thread-local collectors of interactions not merged into storage yet;
+	//! the last collector is shared by threads without an own collector
+	mutable std::vector< Collector > collectors;
 
 	//! number of elements to store within storage (only maxToStore best)
 	const size_t maxToStore;
@@ -88,6 +135,33 @@ protected:
 	bool lessThan_StorageContainer( const Interaction * const a
 			, const Interaction * const b )
 	    { return *a < *b; }
+
+	/**
+	 * Inserts an interaction into a sorted bounded container if it is
+	 * among the maxToStore best and not already present. Interaction objects
+	 * dropped from the full container are reused.
+	 *
+	 * @param container the sorted container to update
+	 * @param interaction the interaction to insert
+	 */
+	void
+	insert( StorageContainer & container, const Interaction & interaction ) const;
+
+	/**
+	 * Merges all thread-local collectors into storage.
+	 * Must not be called concurrently with add().
+	 */
+	void
+	mergeCollectors() const;
+
+	/**
+	 * Access to the collector of the calling thread.
+	 * @return the index of the collector within collectors
+	 */
+	static
+	size_t
+	getThreadIndex();
+
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -96,6 +170,7 @@ inline
 bool
 OutputHandlerInteractionList::
 empty() const {
+	mergeCollectors();
 	return storage.empty();
 }
 
@@ -106,6 +181,7 @@ OutputHandlerInteractionList::
 const_iterator
 OutputHandlerInteractionList::
 begin() const {
+	mergeCollectors();
 	return storage.begin();
 }
 
@@ -116,6 +192,7 @@ OutputHandlerInteractionList::
 const_iterator
 OutputHandlerInteractionList::
 end() const {
+	mergeCollectors();
 	return storage.end();
 }
 
@@ -126,6 +203,7 @@ OutputHandlerInteractionList::
 iterator
 OutputHandlerInteractionList::
 begin() {
+	mergeCollectors();
 	return storage.begin();
 }
 
@@ -136,13 +214,12 @@ OutputHandlerInteractionList::
 iterator
 OutputHandlerInteractionList::
 end() {
+	mergeCollectors();
 	return storage.end();
 }
 
 ////////////////////////////////////////////////////////////////////////////
-
 ////////////////////////////////////////////////////////////////////////////
-
 ////////////////////////////////////////////////////////////////////////////
 
 } /* namespace IntaRNA */
@@ -420,7 +420,7 @@ add( const Interaction & i )
 		if (!Z_equal(Z,Z_type(0)) && Z_isNotINF(Z)) {
 		outTmp
 			<<"\n"
-			<<"ensemble energy    = "<<E_2_Ekcal(energy.getE(Z)) <<" kcal/mol\n"
+			<<"ensemble energy    = "<<E_2_Ekcal(energy.getE_scaled(Z)) <<" kcal/mol\n"
 			;
 		}
 
@@ -0,0 +1,163 @@
+
+#include "IntaRNA/PValueEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////////
+
+PValueEstimator::
+PValueEstimator()
+ :	samples()
+	, gaussMean( std::numeric_limits<double>::quiet_NaN() )
+	, gaussSd( std::numeric_limits<double>::quiet_NaN() )
+	, gumbelLocation( std::numeric_limits<double>::quiet_NaN() )
+	, gumbelScale( std::numeric_limits<double>::quiet_NaN() )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+PValueEstimator::
+PValueEstimator( const std::vector< double > & samples_ )
+ :	samples( samples_ )
+	, gaussMean( std::numeric_limits<double>::quiet_NaN() )
+	, gaussSd( std::numeric_limits<double>::quiet_NaN() )
+	, gumbelLocation( std::numeric_limits<double>::quiet_NaN() )
+	, gumbelScale( std::numeric_limits<double>::quiet_NaN() )
+{
+	if (samples.empty()) {
+		return;
+	}
+	// sort for empirical p-value lookup
+	std::sort( samples.begin(), samples.end() );
+
+	// maximum likelihood fit of the normal distribution
+	double sum = 0;
+	for (const double & s : samples) {
+		sum += s;
+	}
+	gaussMean = sum / (double)samples.size();
+	double sumSq = 0;
+	for (const double & s : samples) {
+		sumSq += (s-gaussMean)*(s-gaussMean);
+	}
+	gaussSd = std::sqrt( sumSq / (double)samples.size() );
+
+	// maximum likelihood fit of the Gumbel distribution
+	fitGumbel();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+PValueEstimator::
+~PValueEstimator()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+PValueEstimator::
+fitGumbel()
+{
+	// degenerated sample
+	if (!(gaussSd > 0)) {
+		gumbelLocation = gaussMean;
+		gumbelScale = 0;
+		return;
+	}
+
+	// the largest sample is used as offset to avoid numerical overflows
+	const double maxSample = samples.back();
+
+	// The maximum likelihood scale b of the (minimum) Gumbel distribution
+	// is the root of the strictly increasing function
+	//   f(b) = b - sum(x*w)/sum(w) + mean(x)  with  w = exp(x/b)
+	// which is found via Newton's method starting from the moment estimate.
+	double scale = gaussSd * std::sqrt(6.0) / M_PI;
+	for (size_t iteration = 0; iteration < 100; iteration++) {
+		double sumW = 0, sumXW = 0, sumXXW = 0;
+		for (const double & s : samples) {
+			const double w = std::exp( (s-maxSample)/scale );
+			sumW += w;
+			sumXW += s*w;
+			sumXXW += s*s*w;
+		}
+		const double weightedMean = sumXW / sumW;
+		const double weightedVar = std::max( 0.0, sumXXW / sumW - weightedMean*weightedMean );
+		const double f = scale - weightedMean + gaussMean;
+		const double fDerivative = 1.0 + weightedVar / (scale*scale);
+		double newScale = scale - f / fDerivative;
+		// ensure positive scale
+		if (!(newScale > 0)) {
+			newScale = scale / 2.0;
+		}
+		const bool converged = std::abs(newScale-scale) <= 1e-12 * scale;
+		scale = newScale;
+		if (converged) {
+			break;
+		}
+	}
+	gumbelScale = scale;
+
+	// location for the given scale
+	double sumW = 0;
+	for (const double & s : samples) {
+		sumW += std::exp( (s-maxSample)/scale );
+	}
+	gumbelLocation = maxSample + scale * std::log( sumW / (double)samples.size() );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+double
+PValueEstimator::
+getPValueEmpirical( const double energy ) const
+{
+	if (empty()) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	return (double)( std::upper_bound( samples.begin(), samples.end(), energy ) - samples.begin() ) / (double)samples.size();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+double
+PValueEstimator::
+getPValueGauss( const double energy ) const
+{
+	if (empty()) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	// degenerated distribution
+	if (!(gaussSd > 0)) {
+		return energy >= gaussMean ? 1.0 : 0.0;
+	}
+	// cumulative distribution function
+	return 0.5 * std::erfc( (gaussMean - energy) / (gaussSd * std::sqrt(2.0)) );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+double
+PValueEstimator::
+getPValueGumbel( const double energy ) const
+{
+	if (empty()) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	// degenerated distribution
+	if (!(gumbelScale > 0)) {
+		return energy >= gumbelLocation ? 1.0 : 0.0;
+	}
+	// cumulative distribution function = 1 - exp(-exp(z))
+	return -std::expm1( -std::exp( (energy - gumbelLocation) / gumbelScale ) );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
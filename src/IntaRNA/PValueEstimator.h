@@ -0,0 +1,200 @@
+#ifndef INTARNA_PVALUEESTIMATOR_H_
+#define INTARNA_PVALUEESTIMATOR_H_
+
+#include "IntaRNA/general.h"
+
+#include <vector>
+
+namespace IntaRNA {
+
+/**
+ * Estimates empirical p-values of interaction energies based on a sample of
+ * energies from a null model, e.g. the minimal interaction energies of
+ * shuffled sequences.
+ *
+ * Besides the empirical p-value, i.e. the fraction of sampled energies not
+ * larger than a given energy, the p-value is estimated via a normal (Gauss)
+ * distribution and a left-skewed (minimum) Gumbel distribution fitted via
+ * maximum likelihood to the sample.
+ *
+ */
+class PValueEstimator
+{
+public:
+
+	/**
+	 * Construction of an empty estimator without samples; all p-values
+	 * are not available (NaN).
+	 */
+	PValueEstimator();
+
+	/**
+	 * Construction and distribution fitting.
+	 * @param samples the sampled energies (kcal/mol) of the null model
+	 */
+	PValueEstimator( const std::vector< double > & samples );
+
+	//! destruction
+	virtual ~PValueEstimator();
+
+	/**
+	 * Whether or not samples are available for p-value estimation
+	 * @return true if no samples are available; false otherwise
+	 */
+	bool
+	empty() const;
+
+	/**
+	 * Number of samples
+	 * @return the number of samples the estimation is based on
+	 */
+	size_t
+	size() const;
+
+	/**
+	 * Empirical p-value, i.e. the fraction of samples with an energy
+	 * not larger than the given energy.
+	 * @param energy the energy (kcal/mol) to compute the p-value for
+	 * @return the empirical p-value
+	 */
+	double
+	getPValueEmpirical( const double energy ) const;
+
+	/**
+	 * P-value based on the fitted normal distribution, i.e. the probability
+	 * of an energy not larger than the given energy.
+	 * @param energy the energy (kcal/mol) to compute the p-value for
+	 * @return the p-value of the normal distribution
+	 */
+	double
+	getPValueGauss( const double energy ) const;
+
+	/**
+	 * P-value based on the fitted left-skewed Gumbel distribution, i.e. the
+	 * probability of an energy not larger than the given energy.
+	 * @param energy the energy (kcal/mol) to compute the p-value for
+	 * @return the p-value of the Gumbel distribution
+	 */
+	double
+	getPValueGumbel( const double energy ) const;
+
+	/**
+	 * Access to the mean of the fitted normal distribution
+	 * @return the mean of the samples
+	 */
+	double
+	getGaussMean() const;
+
+	/**
+	 * Access to the standard deviation of the fitted normal distribution
+	 * @return the (maximum likelihood) standard deviation of the samples
+	 */
+	double
+	getGaussSd() const;
+
+	/**
+	 * Access to the location of the fitted Gumbel distribution
+	 * @return the location parameter of the Gumbel distribution
+	 */
+	double
+	getGumbelLocation() const;
+
+	/**
+	 * Access to the scale of the fitted Gumbel distribution
+	 * @return the scale parameter of the Gumbel distribution
+	 */
+	double
+	getGumbelScale() const;
+
+protected:
+
+	//! the sorted samples
+	std::vector< double > samples;
+
+	//! mean of the normal distribution
+	double gaussMean;
+
+	//! standard deviation of the normal distribution
+	double gaussSd;
+
+	//! location of the Gumbel distribution
+	double gumbelLocation;
+
+	//! scale of the Gumbel distribution
+	double gumbelScale;
+
+	/**
+	 * Maximum likelihood fit of the Gumbel distribution parameters
+	 * gumbelLocation and gumbelScale for the samples. Requires gaussSd
+	 * to be set for initialization.
+	 */
+	void
+	fitGumbel();
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PValueEstimator::
+empty() const
+{
+	return samples.empty();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+PValueEstimator::
+size() const
+{
+	return samples.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+double
+PValueEstimator::
+getGaussMean() const
+{
+	return gaussMean;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+double
+PValueEstimator::
+getGaussSd() const
+{
+	return gaussSd;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+double
+PValueEstimator::
+getGumbelLocation() const
+{
+	return gumbelLocation;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+inline
+double
+PValueEstimator::
+getGumbelScale() const
+{
+	return gumbelScale;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_PVALUEESTIMATOR_H_ */
@@ -0,0 +1,100 @@
+
+#include "IntaRNA/PairingContext.h"
+
+#include <algorithm>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////////
+
+PairingContext::
+PairingContext()
+	: from1(0)
+	, from2(0)
+	, size1(0)
+	, size2(0)
+	, rowWords(0)
+	, accessible1()
+	, accessible2()
+	, complementary()
+	, gu()
+	, maxInternalLoopSize1(0)
+	, maxInternalLoopSize2(0)
+	, internalLoopGU(false)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+PairingContext::
+~PairingContext()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+PairingContext::
+init( const InteractionEnergy & energy
+		, const size_t from1_, const size_t to1
+		, const size_t from2_, const size_t to2 )
+{
+	// store window
+	from1 = from1_;
+	from2 = from2_;
+	size1 = (from1 < energy.size1()) ? std::min(to1,energy.size1()-1)-from1+1 : 0;
+	size2 = (from2 < energy.size2()) ? std::min(to2,energy.size2()-1)-from2+1 : 0;
+	rowWords = (size2+63)/64;
+
+	// store loop constraints
+	maxInternalLoopSize1 = energy.getMaxInternalLoopSize1();
+	maxInternalLoopSize2 = energy.getMaxInternalLoopSize2();
+	internalLoopGU = energy.isInternalLoopGUallowed();
+
+	// accessibility bitsets
+	accessible1.assign( size1, false );
+	for (size_t i=0; i<size1; i++) {
+		accessible1[i] = energy.isAccessible1(from1+i);
+	}
+	accessible2.assign( size2, false );
+	for (size_t i=0; i<size2; i++) {
+		accessible2[i] = energy.isAccessible2(from2+i);
+	}
+
+	// base pair bit matrices
+	complementary.assign( size1*rowWords, 0 );
+	gu.assign( size1*rowWords, 0 );
+	for (size_t i1=0; i1<size1; i1++) {
+		// skip rows without any pairing
+		if (!accessible1[i1]) {
+			continue;
+		}
+		for (size_t i2=0; i2<size2; i2++) {
+			if (accessible2[i2] && energy.areComplementary(from1+i1, from2+i2)) {
+				setBit( complementary, i1, i2 );
+				if (energy.isGU(from1+i1, from2+i2)) {
+					setBit( gu, i1, i2 );
+				}
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+PairingContext::
+clear()
+{
+	size1 = 0;
+	size2 = 0;
+	rowWords = 0;
+	accessible1.clear();
+	accessible2.clear();
+	complementary.clear();
+	gu.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
@@ -0,0 +1,335 @@
+
+#ifndef INTARNA_PAIRINGCONTEXT_H_
+#define INTARNA_PAIRINGCONTEXT_H_
+
+#include "IntaRNA/general.h"
+#include "IntaRNA/InteractionEnergy.h"
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+namespace IntaRNA {
+
+/**
+ * Precomputed pairing information of a prediction window, i.e. the
+ * accessibility of each position and the complementarity and base pair type
+ * (GU or not) of each intermolecular index pair.
+ *
+ * The context is filled once per window via init() and provides O(1) bit
+ * lookups for the base pair and loop checks done in each DP cell, which
+ * would otherwise be dispatched through several (virtual) layers of the
+ * energy function, its accessibility and sequence objects.
+ *
+ * All indices are given in the index space of the energy function used for
+ * init().
+ *
+ * @author Martin Mann
+ *
+ */
+class PairingContext {
+
+public:
+
+	/**
+	 * Creates an empty context that covers no index pair
+	 */
+	PairingContext();
+
+	/**
+	 * destruction
+	 */
+	virtual ~PairingContext();
+
+	/**
+	 * Fills the context for the given index window using the provided
+	 * energy function.
+	 *
+	 * @param energy the energy function to get the pairing information from
+	 * @param from1 the first index of the window in seq1
+	 * @param to1 the last index of the window in seq1 (truncated to the
+	 *        sequence length)
+	 * @param from2 the first index of the window in seq2
+	 * @param to2 the last index of the window in seq2 (truncated to the
+	 *        sequence length)
+	 */
+	void
+	init( const InteractionEnergy & energy
+			, const size_t from1, const size_t to1
+			, const size_t from2, const size_t to2 );
+
+	/**
+	 * Removes all information, such that no index pair is covered
+	 */
+	void
+	clear();
+
+	/**
+	 * Whether or not the index pair is within the window of this context
+	 * @param i1 index in seq1
+	 * @param i2 index in seq2
+	 * @return true if the index pair is covered by the context; false otherwise
+	 */
+	bool
+	covers( const size_t i1, const size_t i2 ) const;
+
+	/**
+	 * Whether or not position i is accessible for interaction in seq1
+	 * (see InteractionEnergy::isAccessible1())
+	 * @param i the position of interest (covered by the context)
+	 * @return true if the position is accessible; false otherwise
+	 */
+	bool
+	isAccessible1( const size_t i ) const;
+
+	/**
+	 * Whether or not position i is accessible for interaction in seq2
+	 * (see InteractionEnergy::isAccessible2())
+	 * @param i the position of interest (covered by the context)
+	 * @return true if the position is accessible; false otherwise
+	 */
+	bool
+	isAccessible2( const size_t i ) const;
+
+	/**
+	 * Whether or not the two positions can form an intermolecular base pair,
+	 * including their accessibility (see InteractionEnergy::areComplementary())
+	 * @param i1 index in seq1 (covered by the context)
+	 * @param i2 index in seq2 (covered by the context)
+	 * @return true if the positions can form a base pair; false otherwise
+	 */
+	bool
+	areComplementary( const size_t i1, const size_t i2 ) const;
+
+	/**
+	 * Whether or not the two positions form a GU base pair
+	 * (see InteractionEnergy::isGU())
+	 * @param i1 index in seq1 (covered by the context)
+	 * @param i2 index in seq2 (covered by the context)
+	 * @return true if the positions form a GU base pair; false otherwise
+	 */
+	bool
+	isGU( const size_t i1, const size_t i2 ) const;
+
+	/**
+	 * Checks whether or not the given indices mark a valid internal loop
+	 * (see InteractionEnergy::isValidInternalLoop())
+	 * @param i1 the index of the first sequence interacting with i2
+	 * @param j1 the index of the first sequence interacting with j2 with i1<=j1
+	 * @param i2 the index of the second sequence interacting with i1
+	 * @param j2 the index of the second sequence interacting with j1 with i2<=j2
+	 * @return true if the internal loop is valid; false otherwise
+	 */
+	bool
+	isValidInternalLoop( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const;
+
+	/**
+	 * Number of 64-bit words per row of the bit matrices, i.e. per index in
+	 * seq1
+	 * @return the number of words per row
+	 */
+	size_t
+	getRowWords() const;
+
+	/**
+	 * Direct access to the complementarity bits of a row, where bit (i2-from2)
+	 * (least significant bit first) is set if i1 and i2 are complementary
+	 * (see areComplementary())
+	 * @param i1 index in seq1 (covered by the context)
+	 * @return pointer to the getRowWords() words of the row
+	 */
+	const boost::uint64_t *
+	getComplementaryRow( const size_t i1 ) const;
+
+protected:
+
+	//! first covered index in seq1
+	size_t from1;
+
+	//! first covered index in seq2
+	size_t from2;
+
+	//! number of covered positions in seq1
+	size_t size1;
+
+	//! number of covered positions in seq2
+	size_t size2;
+
+	//! number of 64-bit words per row of the bit matrices
+	size_t rowWords;
+
+	//! accessibility bitset for seq1
+	std::vector<bool> accessible1;
+
+	//! accessibility bitset for seq2
+	std::vector<bool> accessible2;
+
+	//! row-major bit matrix of complementary (and accessible) index pairs
+	std::vector<boost::uint64_t> complementary;
+
+	//! row-major bit matrix of GU base pairs
+	std::vector<boost::uint64_t> gu;
+
+	//! maximal internal loop size in seq1
+	size_t maxInternalLoopSize1;
+
+	//! maximal internal loop size in seq2
+	size_t maxInternalLoopSize2;
+
+	//! whether or not GU base pairs are allowed within internal loops
+	bool internalLoopGU;
+
+	/**
+	 * Access to a bit of a bit matrix
+	 * @param bits the bit matrix to access
+	 * @param i1 index in seq1 (covered by the context)
+	 * @param i2 index in seq2 (covered by the context)
+	 * @return the bit of the index pair
+	 */
+	bool
+	getBit( const std::vector<boost::uint64_t> & bits, const size_t i1, const size_t i2 ) const;
+
+	/**
+	 * Sets a bit of a bit matrix
+	 * @param bits the bit matrix to alter
+	 * @param i1 index in seq1 relative to from1
+	 * @param i2 index in seq2 relative to from2
+	 */
+	void
+	setBit( std::vector<boost::uint64_t> & bits, const size_t i1, const size_t i2 );
+
+};
+
+////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+covers( const size_t i1, const size_t i2 ) const
+{
+	return i1 >= from1 && i1-from1 < size1
+		&& i2 >= from2 && i2-from2 < size2;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+isAccessible1( const size_t i ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (i < from1 || i-from1 >= size1)
+		throw std::runtime_error("PairingContext::isAccessible1("+toString(i)+") not covered");
+#endif
+	return accessible1[i-from1];
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+isAccessible2( const size_t i ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (i < from2 || i-from2 >= size2)
+		throw std::runtime_error("PairingContext::isAccessible2("+toString(i)+") not covered");
+#endif
+	return accessible2[i-from2];
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+getBit( const std::vector<boost::uint64_t> & bits, const size_t i1, const size_t i2 ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (!covers(i1,i2))
+		throw std::runtime_error("PairingContext::getBit("+toString(i1)+","+toString(i2)+") not covered");
+#endif
+	const size_t col = i2-from2;
+	return (bits[ (i1-from1)*rowWords + (col >> 6) ] >> (col & 63)) & 1;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+PairingContext::
+setBit( std::vector<boost::uint64_t> & bits, const size_t i1, const size_t i2 )
+{
+	bits[ i1*rowWords + (i2 >> 6) ] |= (boost::uint64_t(1) << (i2 & 63));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+areComplementary( const size_t i1, const size_t i2 ) const
+{
+	return getBit( complementary, i1, i2 );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+isGU( const size_t i1, const size_t i2 ) const
+{
+	return getBit( gu, i1, i2 );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+PairingContext::
+isValidInternalLoop( const size_t i1, const size_t j1, const size_t i2, const size_t j2 ) const
+{
+	// note: complementary positions are never 'N', such that the loop region
+	// check of InteractionEnergy::isAllowedLoopRegion() reduces to the loop size
+	return
+		   i1 < j1 && i2 < j2
+		&& (j1-i1) <= (1+maxInternalLoopSize1)
+		&& (j2-i2) <= (1+maxInternalLoopSize2)
+		&& areComplementary( i1, i2)
+		&& areComplementary( j1, j2)
+		&& ( internalLoopGU || (i1+1==j1 && i2+1==j2) || (!isGU(i1,i2) && !isGU(j1,j2)) ) // GU-allowed or stacking or no GU
+		;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+PairingContext::
+getRowWords() const
+{
+	return rowWords;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+const boost::uint64_t *
+PairingContext::
+getComplementaryRow( const size_t i1 ) const
+{
+#if INTARNA_IN_DEBUG_MODE
+	if (i1 < from1 || i1-from1 >= size1)
+		throw std::runtime_error("PairingContext::getComplementaryRow("+toString(i1)+") not covered");
+#endif
+	return &(complementary[ (i1-from1)*rowWords ]);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_PAIRINGCONTEXT_H_ */
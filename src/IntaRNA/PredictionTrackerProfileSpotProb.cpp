@@ -130,7 +130,7 @@ updateOptimumCalled( const size_t i1, const size_t j1
 							,j2 == RnaSequence::lastPos ? energy.size2()-1 : j2);
 
 	// get Boltzmann weight of this interaction energy
-	const Z_type bwE = energy.getBoltzmannWeight( curE );
+	const Z_type bwE = energy.getBoltzmannWeightScaled( curE );
 
 	// update overall partition function
 	overallZ += bwE;
@@ -147,7 +147,7 @@ updateOptimumCalled( const size_t i1, const size_t j1
 							,j2 == RnaSequence::lastPos ? energy.size2()-1 : j2);
 
 	// get Boltzmann weight of this interaction
-	const Z_type curBW = energy.getBoltzmannWeight( curE );
+	const Z_type curBW = energy.getBoltzmannWeightScaled( curE );
 	// update overall Z
 	overallZ += curBW;
 	// update spot information
@@ -105,7 +105,7 @@ updateOptimumCalled( const size_t i1_, const size_t j1_
 #endif
 
 	// get Boltzmann weight contribution of this interaction
-	Z_type curWeight = energy.getBoltzmannWeight( curE );
+	Z_type curWeight = energy.getBoltzmannWeightScaled( curE );
 
 	// update overall partition function
 	overallZ += curWeight;
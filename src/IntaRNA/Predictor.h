@@ -94,6 +94,18 @@ protected:
 	//! its value is updated by updateZ()
 	Z_type Zall;
 
+	//! screening : minimal ED of subsequences of the current window in seq1
+	//! with length >= l (index l-1), set by isScreeningPrunable(size1,size2)
+	std::vector<E_type> screeningMinED1;
+
+	//! screening : minimal ED of subsequences of the current window in seq2
+	//! with length >= l (index l-1), set by isScreeningPrunable(size1,size2)
+	std::vector<E_type> screeningMinED2;
+
+	//! screening : minimal sum of left and right end contributions (and the
+	//! energy shift) within the current window
+	E_type screeningMinEnds;
+
 
 	/**
 	 * Initializes the list of best solutions to be filled by updateOptima()
@@ -161,6 +173,58 @@ protected:
 	void
 	incrementZall( const Z_type partZ );
 
+	/**
+	 * Checks in screening mode whether or not the prediction for the current
+	 * window can be skipped, i.e. if either enough hits have already been
+	 * reported to the output handler or if an admissible lower bound of the
+	 * energy of all interactions within the window is not below the maximal
+	 * energy to report.
+	 *
+	 * The lower bound combines, for each possible number of base pairs n,
+	 * the initiation energy, (n-1) times the minimal loop energy, and the
+	 * minimal ED values of subsequences of length >= n, plus the minimal
+	 * dangling end and helix end contributions within the window.
+	 *
+	 * Note, the index offsets of the energy handler have to be set already.
+	 * The minimal ED and end contributions are stored for subsequent calls
+	 * of isScreeningPrunable(seedE,seedLength1,seedLength2) for this window.
+	 *
+	 * @param size1 the window length within the first sequence
+	 * @param size2 the window length within the second sequence
+	 *
+	 * @return true if screening mode is enabled and no further reportable
+	 *         interaction can be found within the window; false otherwise
+	 */
+	bool
+	isScreeningPrunable( const size_t size1, const size_t size2 );
+
+	/**
+	 * Checks in screening mode whether or not the extension of a seed
+	 * within the current window can be skipped, i.e. if either enough hits
+	 * have already been reported or if an admissible lower bound of the
+	 * energy of all interactions containing the seed is not below the
+	 * maximal energy to report.
+	 *
+	 * The lower bound combines, for each possible number n of base pairs
+	 * added to the seed, the initiation energy, the seed energy, n times the
+	 * minimal loop energy, and the minimal ED values of subsequences of
+	 * length >= seed length + n, plus the minimal end contributions.
+	 *
+	 * Note, isScreeningPrunable(size1,size2) has to be called for the
+	 * current window before.
+	 *
+	 * @param seedE the hybridization energy of the seed (without E_init)
+	 * @param seedLength1 the length of the seed in the first sequence
+	 * @param seedLength2 the length of the seed in the second sequence
+	 *
+	 * @return true if screening mode is enabled and no reportable
+	 *         interaction can contain the seed; false otherwise
+	 */
+	bool
+	isScreeningPrunable( const E_type seedE
+			, const size_t seedLength1
+			, const size_t seedLength2 ) const;
+
 };
 
 
@@ -177,6 +241,9 @@ Predictor::Predictor( const InteractionEnergy & energy
 	, output(output)
 	, predTracker(predTracker)
 	, Zall(0)
+	, screeningMinED1()
+	, screeningMinED2()
+	, screeningMinEnds(E_INF)
 {
 }
 
@@ -267,7 +334,7 @@ updateZall( const size_t i1, const size_t j1
 
 	// increment Zall with BW of overall energy
 	incrementZall(
-			energy.getBoltzmannWeight(
+			energy.getBoltzmannWeightScaled(
 					isHybridE ?
 							energy.getE( i1,j1, i2,j2, interE )
 							: interE
@@ -276,6 +343,137 @@ updateZall( const size_t i1, const size_t j1
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+bool
+Predictor::
+isScreeningPrunable( const size_t size1, const size_t size2 )
+{
+	const OutputConstraint & outConstraint = output.getOutputConstraint();
+
+	// pruning disabled or all interactions needed for partition function
+	if (!outConstraint.screening || outConstraint.needZall) {
+		return false;
+	}
+
+	// check if enough hits are already confirmed
+	if (output.reportedHits() >= outConstraint.reportMax) {
+		return true;
+	}
+
+	// check if any base pair is possible
+	if (size1 == 0 || size2 == 0) {
+		return true;
+	}
+
+	// minimal dangling end and helix end contributions for left and right ends
+	E_type minLeft = E_INF, minRight = E_INF;
+	for (size_t i1=0; i1<size1; i1++) {
+	for (size_t i2=0; i2<size2; i2++) {
+		if (!energy.areComplementary(i1,i2)) {
+			continue;
+		}
+		// dangles are weighted by probabilities within [0,1]
+		minLeft = std::min( minLeft, energy.getE_endLeft(i1,i2)
+				+ (energy.isEnergyWithDangles() ? std::min(E_type(0),energy.getE_danglingLeft(i1,i2)) : E_type(0)) );
+		minRight = std::min( minRight, energy.getE_endRight(i1,i2)
+				+ (energy.isEnergyWithDangles() ? std::min(E_type(0),energy.getE_danglingRight(i1,i2)) : E_type(0)) );
+	}}
+	// no base pair possible
+	if (E_isINF(minLeft) || E_isINF(minRight)) {
+		return true;
+	}
+
+	// maximal subsequence lengths within the window
+	const size_t maxL1 = (energy.getAccessibility1().getMaxLength() == 0) ? size1
+			: std::min( size1, energy.getAccessibility1().getMaxLength() );
+	const size_t maxL2 = (energy.getAccessibility2().getMaxLength() == 0) ? size2
+			: std::min( size2, energy.getAccessibility2().getMaxLength() );
+
+	// minimal ED of subsequences with length >= l (index l-1)
+	std::vector<E_type> & minED1 = screeningMinED1;
+	std::vector<E_type> & minED2 = screeningMinED2;
+	minED1.assign(maxL1, E_INF);
+	minED2.assign(maxL2, E_INF);
+	for (size_t l=1; l<=maxL1; l++) {
+		for (size_t i1=0; i1+l<=size1; i1++) {
+			minED1[l-1] = std::min( minED1[l-1], energy.getED1( i1, i1+l-1 ) );
+		}
+	}
+	for (size_t l=1; l<=maxL2; l++) {
+		for (size_t i2=0; i2+l<=size2; i2++) {
+			minED2[l-1] = std::min( minED2[l-1], energy.getED2( i2, i2+l-1 ) );
+		}
+	}
+	for (size_t l=maxL1-1; l-- > 0; ) {
+		minED1[l] = std::min( minED1[l], minED1[l+1] );
+	}
+	for (size_t l=maxL2-1; l-- > 0; ) {
+		minED2[l] = std::min( minED2[l], minED2[l+1] );
+	}
+
+	// minimal energy over all possible numbers of base pairs
+	const E_type bestLoopE = energy.getBestE_interLeft();
+	E_type minE = E_INF;
+	for (size_t bp=1; bp<=std::min(maxL1,maxL2); bp++) {
+		minE = std::min( minE, energy.getE_init()
+				+ (E_type)(bp-1)*bestLoopE
+				+ minED1[bp-1] + minED2[bp-1] );
+	}
+	screeningMinEnds = minLeft + minRight + energy.getEnergyAdd();
+	minE += screeningMinEnds;
+
+	// check if no interaction can reach the reporting threshold
+	return minE >= outConstraint.maxE;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+Predictor::
+isScreeningPrunable( const E_type seedE
+		, const size_t seedLength1
+		, const size_t seedLength2 ) const
+{
+	const OutputConstraint & outConstraint = output.getOutputConstraint();
+
+	// pruning disabled or all interactions needed for partition function
+	if (!outConstraint.screening || outConstraint.needZall) {
+		return false;
+	}
+
+	// check if enough hits have been confirmed in the meantime
+	if (output.reportedHits() >= outConstraint.reportMax) {
+		return true;
+	}
+
+	// check if seed exceeds the maximal subsequence lengths
+	if (seedLength1 == 0 || seedLength2 == 0
+		|| seedLength1 > screeningMinED1.size()
+		|| seedLength2 > screeningMinED2.size())
+	{
+		return true;
+	}
+
+	// minimal energy over all possible numbers of base pairs added to the seed
+	const E_type bestLoopE = energy.getBestE_interLeft();
+	const size_t maxAdd = std::min( screeningMinED1.size()-seedLength1
+									, screeningMinED2.size()-seedLength2 );
+	E_type minE = E_INF;
+	for (size_t add=0; add<=maxAdd; add++) {
+		minE = std::min( minE, energy.getE_init() + seedE
+				+ (E_type)add*bestLoopE
+				+ screeningMinED1[seedLength1+add-1]
+				+ screeningMinED2[seedLength2+add-1] );
+	}
+	minE += screeningMinEnds;
+
+	// check if no interaction containing the seed can reach the threshold
+	return minE >= outConstraint.maxE;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 } // namespace
 
 #endif /* PREDICTOR_H_ */
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfe.h"
+#include "IntaRNA/Profiler.h"
 
 #include <iostream>
 #include <algorithm>
@@ -17,6 +18,8 @@ PredictorMfe::PredictorMfe(
 	, mfeInteractions()
 	, mfe4leftEnd()
 	, reportedInteractions()
+	, pairing()
+	, snapshot(this->energy)
 {
 
 }
@@ -94,8 +97,8 @@ updateOptima( const size_t i1, const size_t j1
 
 	// check ED penalties
 	if (output.getOutputConstraint().maxED < Accessibility::ED_UPPER_BOUND
-			&& (energy.getED1(i1,j1) > output.getOutputConstraint().maxED
-					|| energy.getED2(i2,j2) > output.getOutputConstraint().maxED)
+			&& (snapshot.getED1(i1,j1) > output.getOutputConstraint().maxED
+					|| snapshot.getED2(i2,j2) > output.getOutputConstraint().maxED)
 			)
 	{
 		return;
@@ -111,7 +114,7 @@ updateOptima( const size_t i1, const size_t j1
 		// report call if needed
 		if (predTracker != NULL) {
 			// get final energy of current interaction
-			E_type curE = isHybridE ? energy.getE( i1,j1, i2,j2, interE ) : interE;
+			E_type curE = isHybridE ? snapshot.getE( i1,j1, i2,j2, interE ) : interE;
 			if (E_isNotINF(curE)) {
 				// inform about prediction
 				predTracker->updateOptimumCalled( i1 + (i1==RnaSequence::lastPos ? 0 : energy.getOffset1())
@@ -125,7 +128,7 @@ updateOptima( const size_t i1, const size_t j1
 	}
 
 	// get final energy of current interaction
-	E_type curE = isHybridE ? energy.getE( i1,j1, i2,j2, interE ) : interE;
+	E_type curE = isHybridE ? snapshot.getE( i1,j1, i2,j2, interE ) : interE;
 
 	// report call if needed
 	if (predTracker != NULL && E_isNotINF(curE)) {
@@ -231,6 +234,7 @@ reportOptima()
 			// report current best
 			if (outConstraint.needBPs) {
 				// fill interaction with according base pairs
+				Profiler::Timer profileTimer( Profiler::TRACEBACK );
 				traceBack( curBest );
 			}
 			// report mfe interaction
@@ -281,6 +285,7 @@ reportOptima()
 
 				if (outConstraint.needBPs) {
 					// fill mfe interaction with according base pairs
+					Profiler::Timer profileTimer( Profiler::TRACEBACK );
 					traceBack( *i );
 				}
 				// report mfe interaction
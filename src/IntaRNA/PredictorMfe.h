@@ -6,6 +6,8 @@
 #include "IntaRNA/Predictor.h"
 
 #include "IntaRNA/IndexRangeList.h"
+#include "IntaRNA/InteractionEnergySnapshot.h"
+#include "IntaRNA/PairingContext.h"
 
 #include <list>
 #include <utility>
@@ -107,6 +109,13 @@ protected:
 	//! NOTE: the indices for seq2 are reversed
 	std::pair< IndexRangeList, IndexRangeList > reportedInteractions;
 
+	//! precomputed pairing information of the current prediction window
+	//! (filled within predict() using window-relative indices)
+	PairingContext pairing;
+
+	//! flattened accessibility-based energy terms of the current prediction window
+	InteractionEnergySnapshot snapshot;
+
 	/**
 	 * Initializes the global energy minimum storage
 	 */
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfe2d.h"
+#include "IntaRNA/Profiler.h"
 
 #include <stdexcept>
 
@@ -58,21 +59,35 @@ predict( const IndexRange & r1
 				, std::min( energy.size2()
 						, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 ) );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridE_pq.size1(), hybridE_pq.size2() )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, hybridE_pq.size1()-1, 0, hybridE_pq.size2()-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridE_pq.size1(), hybridE_pq.size2() );
+
 	// initialize mfe interaction for updates
 	initOptima();
 
 	// for all right ends j1
 	for (size_t j1 = hybridE_pq.size1(); j1-- > 0; ) {
 		// check if j1 is accessible
-		if (!energy.isAccessible1(j1))
+		if (!pairing.isAccessible1(j1))
 			continue;
 		// iterate over all right ends j2
 		for (size_t j2 = hybridE_pq.size2(); j2-- > 0; ) {
 			// check if j2 is accessible
-			if (!energy.isAccessible2(j2))
+			if (!pairing.isAccessible2(j2))
 				continue;
 			// check if base pair (j1,j2) possible
-			if (!energy.areComplementary( j1, j2 ))
+			if (!pairing.areComplementary( j1, j2 ))
 				continue;
 
 			// fill matrix and store best interaction
@@ -93,8 +108,23 @@ fillHybridE( const size_t j1, const size_t j2
 			, const size_t i1init, const size_t i2init
 			, const bool callUpdateOptima )
 {
-	// temporary access
-	const OutputConstraint & outConstraint = output.getOutputConstraint();
+	// call implementation specialized for the output constraints
+	if (output.getOutputConstraint().noLP) {
+		fillHybridE_noLP<true>( j1, j2, i1init, i2init, callUpdateOptima );
+	} else {
+		fillHybridE_noLP<false>( j1, j2, i1init, i2init, callUpdateOptima );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template< bool noLP >
+void
+PredictorMfe2d::
+fillHybridE_noLP( const size_t j1, const size_t j2
+			, const size_t i1init, const size_t i2init
+			, const bool callUpdateOptima )
+{
 #if INTARNA_IN_DEBUG_MODE
 	if (i1init > j1)
 		throw std::runtime_error("PredictorMfe2d::fillHybridE() : i1init > j1 : "+toString(i1init)+" > "+toString(j1));
@@ -114,10 +144,14 @@ fillHybridE( const size_t j1, const size_t j2
 	size_t i1,i2,w1,w2,k1,k2;
 
 	// determine whether or not lonely base pairs are allowed or if we have to
-	// ensure a stacking to the right of the left boundary (i1,i2)
-	const size_t noLpShift = outConstraint.noLP ? 1 : 0;
+	// ensure a stacking to the right of the left boundary (i1,i2);
+	// compile time constant such that the unused branches are removed
+	const size_t noLpShift = noLP ? 1 : 0;
 	E_type iStackE = E_type(0);
 
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, (j1-i1start+1)*(j2-i2start+1) );
+
 	//////////  COMPUTE HYBRIDIZATION ENERGIES  ////////////
 
 	// iterate over all window starts i1 (seq1) and i2 (seq2)
@@ -131,16 +165,14 @@ fillHybridE( const size_t j1, const size_t j2
 			hybridE_pq(i1,i2) = E_INF;
 
 			// check if this cell is to be computed (!=E_INF)
-			if( energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& energy.areComplementary(i1,i2)
+			if( pairing.areComplementary(i1,i2)
 			)
 			{
 				// w2 = interaction width in seq2
 				w2 = j2-i2+1;
 
 				// reference access to cell value
-				E_type &curMinE = hybridE_pq(i1,i2);
+				E_storage_type & curMinE = hybridE_pq(i1,i2);
 
 				// either interaction initiation
 				if ( i1==j1 && i2==j2)  {
@@ -162,16 +194,14 @@ fillHybridE( const size_t j1, const size_t j2
 					} else {
 						// no lp allowed
 						// check if right-side stacking of (i1,i2) is possible
-						if (energy.isAccessible1(i1+noLpShift)
-							&& energy.isAccessible2(i2+noLpShift)
-							&& energy.areComplementary(i1+noLpShift,i2+noLpShift))
+						if (pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 						{
 							// get stacking term to avoid recomputation
 							iStackE = energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift);
 
 							// init with stacking only
 							// or stacking with right extension
-							curMinE = iStackE + ((w1==2&&w2==2) ? energy.getE_init() : hybridE_pq(i1+noLpShift, i2+noLpShift) );
+							curMinE = iStackE + ((w1==2&&w2==2) ? energy.getE_init() : E_type(hybridE_pq(i1+noLpShift, i2+noLpShift)) );
 						} else {
 							//
 							iStackE = E_INF;
@@ -185,7 +215,7 @@ fillHybridE( const size_t j1, const size_t j2
 							// check if (k1,k2) are valid left boundary
 							if ( E_isNotINF( hybridE_pq(k1,k2) ) ) {
 								// update minimal value
-								curMinE = std::min( curMinE,
+								curMinE = std::min<E_type>( curMinE,
 										( iStackE + energy.getE_interLeft(i1+noLpShift,k1,i2+noLpShift,k2)
 												+ hybridE_pq(k1,k2) )
 										);
@@ -4,6 +4,7 @@
 
 #include "IntaRNA/PredictorMfe.h"
 #include "IntaRNA/Interaction.h"
+#include "IntaRNA/NarrowEnergy.h"
 
 #include <boost/numeric/ublas/matrix.hpp>
 
@@ -21,7 +22,7 @@ class PredictorMfe2d: public PredictorMfe {
 protected:
 
 	//! matrix type to hold the mfe energies for interaction site starts
-	typedef boost::numeric::ublas::matrix<E_type> E2dMatrix;
+	typedef boost::numeric::ublas::matrix<E_storage_type> E2dMatrix;
 
 public:
 
@@ -87,6 +88,25 @@ protected:
 				, const bool callUpdateOptima
 				);
 
+	/**
+	 * Implementation of fillHybridE() specialized at compile time whether or
+	 * not lonely base pairs are to be avoided.
+	 *
+	 * @param j1 end of the interaction within seq 1
+	 * @param j2 end of the interaction within seq 2
+	 * @param i1init smallest value for i1
+	 * @param i2init smallest value for i2
+	 * @param callUpdateOptima whether or not updateOptima() is to be called
+	 *
+	 * @tparam noLP whether or not lonely base pairs are forbidden
+	 */
+	template< bool noLP >
+	void
+	fillHybridE_noLP( const size_t j1, const size_t j2
+				, const size_t i1init, const size_t i2init
+				, const bool callUpdateOptima
+				);
+
 	/**
 	 * Fills a given interaction (boundaries given) with the according
 	 * hybridizing base pairs.
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfe2dHelixBlockHeuristic.h"
+#include "IntaRNA/Profiler.h"
 
 namespace IntaRNA {
 
@@ -65,6 +66,20 @@ predict( const IndexRange & r1
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridEsize1, hybridEsize2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, hybridEsize1-1, 0, hybridEsize2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridEsize1, hybridEsize2 );
+
 	if (helixHandler.fillHelix( 0, hybridEsize1-1, 0, hybridEsize2-1 ) == 0) {
 		// trigger empty interaction reporting
 		initOptima();
@@ -85,9 +100,7 @@ predict( const IndexRange & r1
 	for (i2=0; i2<hybridE.size2(); i2++) {
 
 		// check if positions can form interaction
-		if (	energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& energy.areComplementary(i1,i2) )
+		if ( pairing.areComplementary(i1,i2) )
 		{
 			// set to interaction initiation with according boundary
 			hybridE(i1,i2) = BestInteractionE(energy.getE_init(), i1, i2);
@@ -123,6 +136,9 @@ fillHybridE()
 	size_t i1,i2,h1,h2,w1,w2;
 	BestInteractionE * curCell = NULL;
 	const BestInteractionE * rightExt = NULL;
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, hybridE.size1()*hybridE.size2() );
+
 	// iterate (decreasingly) over all left interaction starts
 	for (i1=hybridE.size1(); i1-- > 0;) {
 	for (i2=hybridE.size2(); i2-- > 0;) {
@@ -135,7 +151,7 @@ fillHybridE()
 		}
 
 		// E_init initialization
-		curCellEtotal = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+		curCellEtotal = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 
 		// check if helix is possible for this left boundary
 		if ( E_isNotINF( helixHandler.getHelixE(i1,i2) ) ) {
@@ -146,7 +162,7 @@ fillHybridE()
 			curE = helixHandler.getHelixE(i1,i2) + energy.getE_init();
 
 			// check if this combination yields better energy
-			curEtotal = energy.getE(i1, i1+h1, i2, i2+h2, curE);
+			curEtotal = snapshot.getE(i1, i1+h1, i2, i2+h2, curE);
 			if ( !E_equal(curEtotal,curCellEtotal) && curEtotal < curCellEtotal )
 			{
 				// TODO: Check this "right" boundary
@@ -189,7 +205,7 @@ fillHybridE()
 				// compute energy for this loop sizes
 				curE = helixHandler.getHelixE(i1,i2) + energy.getE_interLeft(i1+h1,i1+h1+w1,i2+h2,i2+h2+w2) + rightExt->val;
 				// check if this combination yields better energy
-				curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+				curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 				if ( !E_equal(curEtotal, curCellEtotal) && curEtotal < curCellEtotal )
 				{
 					// update current best for this left boundary
@@ -382,7 +398,7 @@ getNextBest( Interaction & curBest )
 				continue;
 			}
 			// get overall energy of the interaction
-			curCellE = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+			curCellE = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 			// or energy is too low to be considered
 			// or energy is higher than current best found so far
 			if (curCellE < curBestE || curCellE >= curBestCellE )
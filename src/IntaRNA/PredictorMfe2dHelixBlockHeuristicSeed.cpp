@@ -1,6 +1,8 @@
 
 #include "IntaRNA/PredictorMfe2dHelixBlockHeuristicSeed.h"
 
+#include "IntaRNA/Profiler.h"
+
 #include <stdexcept>
 
 namespace IntaRNA {
@@ -70,10 +72,27 @@ predict( const IndexRange & r1
 	const size_t hybridEsize2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridEsize1, hybridEsize2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
 	// resize matrix
 	hybridE.resize( hybridEsize1, hybridEsize2 );
 	hybridE_seed.resize( hybridE.size1(), hybridE.size2() );
 
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridE.size1()*hybridE.size2() );
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, hybridEsize1-1, 0, hybridEsize2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridEsize1, hybridEsize2 );
+
 	// Fill seed / helix and helixSeed Matrices, if one is empty trigger empty interaction reporting
 	if ((seedHandler.fillSeed(0, hybridEsize1-1, 0, hybridEsize2-1) == 0)
 		|| (helixHandler.fillHelix( 0, hybridEsize1-1, 0, hybridEsize2-1) == 0)
@@ -94,9 +113,7 @@ predict( const IndexRange & r1
 	for (i2=0; i2<hybridE.size2(); i2++) {
 
 		// check if positions can form interaction
-		if (	energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& energy.areComplementary(i1,i2) )
+		if ( pairing.areComplementary(i1,i2) )
 		{
 			// set to interaction initiation with according boundary
 			hybridE(i1,i2) = BestInteractionE(energy.getE_init(), i1, i2);
@@ -162,7 +179,7 @@ predict( const IndexRange & r1
 
 			curE = helixHandler.getHelixSeedE(i1,i2) + energy.getE_init();
 			// check if this combination yields better energy
-			curEtotal = energy.getE(i1,i1+h1, i2, i2+h2, curE);
+			curEtotal = snapshot.getE(i1,i1+h1, i2, i2+h2, curE);
 			if ( curEtotal < curCellEtotal )
 			{
 
@@ -205,7 +222,7 @@ predict( const IndexRange & r1
 				curE = helixHandler.getHelixSeedE(i1,i2) + energy.getE_interLeft(i1+h1,i1+h1+w1,i2+h2,i2+h2+w2) + rightExt->val;
 
 				// check if this combination yields better energy
-				curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+				curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 				if ( !E_equal(curEtotal, curCellEtotal) && curEtotal < curCellEtotal )
 				{
 					// update current best for this left boundary
@@ -258,7 +275,7 @@ predict( const IndexRange & r1
 				curE = helixHandler.getHelixE(i1,i2) + energy.getE_interLeft(i1+h1,i1+h1+w1,i2+h2,i2+h2+w2) + rightExt->val;
 
 				// check if this combination yields better energy
-				curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+				curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 				if ( curEtotal < curCellEtotal )
 				{
 					// update current best for this left boundary
@@ -510,7 +527,7 @@ getNextBest( Interaction & curBest )
 				continue;
 			}
 			// get overall energy of the interaction
-			curCellE = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+			curCellE = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 			// or energy is too low to be considered
 			// or energy is higher than current best found so far
 			if (curCellE < curBestE || curCellE >= curBestCellE )
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfe2dHeuristic.h"
+#include "IntaRNA/Profiler.h"
 
 #include <stdexcept>
 
@@ -59,6 +60,21 @@ predict( const IndexRange & r1
 				, std::min( energy.size2()
 						, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 ) );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridE.size1(), hybridE.size2() )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	// (including the next position for right-side stacking checks)
+	pairing.init( energy, 0, hybridE.size1(), 0, hybridE.size2() );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridE.size1(), hybridE.size2() );
+
 	// init mfe for later updates
 	initOptima();
 
@@ -77,20 +93,46 @@ void
 PredictorMfe2dHeuristic::
 fillHybridE()
 {
-	// temporary access
+	// call implementation specialized for the output constraints
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
+	if (outConstraint.noLP) {
+		if (outConstraint.noGUend) {
+			fillHybridE_noLP_noGUend<true,true>();
+		} else {
+			fillHybridE_noLP_noGUend<true,false>();
+		}
+	} else {
+		if (outConstraint.noGUend) {
+			fillHybridE_noLP_noGUend<false,true>();
+		} else {
+			fillHybridE_noLP_noGUend<false,false>();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template< bool noLP, bool noGUend >
+void
+PredictorMfe2dHeuristic::
+fillHybridE_noLP_noGUend()
+{
 	// compute entries
 	// current minimal value
 	E_type curE = E_INF, curEtotal = E_INF, curCellEtotal = E_INF;
 	size_t i1,i2,w1,w2;
 
 	// determine whether or not lonely base pairs are allowed or if we have to
-	// ensure a stacking to the right of the left boundary (i1,i2)
-	const size_t noLpShift = outConstraint.noLP ? 1 : 0;
+	// ensure a stacking to the right of the left boundary (i1,i2);
+	// compile time constant such that the unused branches are removed
+	const size_t noLpShift = noLP ? 1 : 0;
 	E_type iStackE = E_type(0);
 
 	BestInteractionE * curCell = NULL;
 	const BestInteractionE * rightExt = NULL;
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, hybridE.size1()*hybridE.size2() );
+
 	// iterate (decreasingly) over all left interaction starts
 	for (i1=hybridE.size1(); i1-- > 0;) {
 		for (i2=hybridE.size2(); i2-- > 0;) {
@@ -101,18 +143,14 @@ fillHybridE()
 			*curCell = BestInteractionE(E_INF, RnaSequence::lastPos, RnaSequence::lastPos);
 
 			// check if positions can form interaction
-			if (	energy.isAccessible1(i1)
-					&& energy.isAccessible2(i2)
-					&& energy.areComplementary(i1,i2) )
+			if ( pairing.areComplementary(i1,i2) )
 			{
 				// no LP allowed
-				if (outConstraint.noLP) {
+				if (noLP) {
 					// check if right-side stacking of (i1,i2) is possible
 					if ( i1+noLpShift < energy.size1()
 						&& i2+noLpShift < energy.size2()
-						&& energy.isAccessible1(i1+noLpShift)
-						&& energy.isAccessible2(i2+noLpShift)
-						&& energy.areComplementary(i1+noLpShift,i2+noLpShift))
+						&& pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 					{
 						// get stacking term to avoid recomputation
 						iStackE = energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift);
@@ -122,14 +160,17 @@ fillHybridE()
 					}
 				}
 
+				// no valid interaction for this cell so far
+				curCellEtotal = E_INF;
+
 				// set to interaction initiation with according boundary
 				// if valid right boundary
 				if (E_isNotINF(iStackE)
-						&& (!outConstraint.noGUend || !energy.isGU(i1+noLpShift,i2+noLpShift)))
+						&& (!noGUend || !pairing.isGU(i1+noLpShift,i2+noLpShift)))
 				{
 					*curCell = BestInteractionE(iStackE + energy.getE_init(), i1+noLpShift, i2+noLpShift);
 					// current best total energy value (covers to far E_init only)
-					curCellEtotal = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+					curCellEtotal = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 					// update Zall
 					updateZall( i1,curCell->j1,i2,curCell->j2, curCellEtotal, false );
 				}
@@ -137,7 +178,7 @@ fillHybridE()
 				/////////////////////////////////////////
 				// check direct extension to the right of the noLP stacking
 				/////////////////////////////////////////
-				if(outConstraint.noLP)
+				if(noLP)
 				{
 
 					// direct cell access (const)
@@ -151,7 +192,7 @@ fillHybridE()
 						// compute energy direct extension with stacking
 						curE = iStackE + rightExt->val;
 						// check if this combination yields better energy
-						curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+						curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 						// update best extension
 						if ( curEtotal < curCellEtotal )
 						{
@@ -186,7 +227,7 @@ fillHybridE()
 					// compute energy for this loop sizes
 					curE = iStackE + energy.getE_interLeft(i1+noLpShift,i1+noLpShift+w1,i2+noLpShift,i2+noLpShift+w2) + rightExt->val;
 					// check if this combination yields better energy
-					curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+					curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 					// update Zall
 					updateZall( i1,rightExt->j1,i2,rightExt->j2, curEtotal, false );
 					// update best extension
@@ -386,7 +427,7 @@ getNextBest( Interaction & curBest )
 				continue;
 			}
 			// get overall energy of the interaction
-			curCellE = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+			curCellE = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 			// or energy is too low to be considered
 			// or energy is higher than current best found so far
 			if (curCellE < curBestE || curCellE >= curBestCellE )
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfe2dHeuristicSeed.h"
+#include "IntaRNA/Profiler.h"
 
 #include <stdexcept>
 
@@ -59,6 +60,21 @@ predict( const IndexRange & r1
 	const size_t hybridEsize2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridEsize1, hybridEsize2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	// (including the next position for right-side stacking checks)
+	pairing.init( energy, 0, hybridEsize1, 0, hybridEsize2 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridEsize1, hybridEsize2 );
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, hybridEsize1-1, 0, hybridEsize2-1 ) == 0) {
@@ -91,8 +107,30 @@ void
 PredictorMfe2dHeuristicSeed::
 fillHybridE()
 {
-	// temporary access
+	// call implementation specialized for the output constraints
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
+	if (outConstraint.noLP) {
+		if (outConstraint.noGUend) {
+			fillHybridE_noLP_noGUend<true,true>();
+		} else {
+			fillHybridE_noLP_noGUend<true,false>();
+		}
+	} else {
+		if (outConstraint.noGUend) {
+			fillHybridE_noLP_noGUend<false,true>();
+		} else {
+			fillHybridE_noLP_noGUend<false,false>();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template< bool noLP, bool noGUend >
+void
+PredictorMfe2dHeuristicSeed::
+fillHybridE_noLP_noGUend()
+{
 	// compute entries
 	// current minimal value
 	E_type curE = E_INF, curEtotal = E_INF, curCellEtotal = E_INF;
@@ -101,12 +139,16 @@ fillHybridE()
 	size_t i1,i2,w1,w2;
 
 	// determine whether or not lonely base pairs are allowed or if we have to
-	// ensure a stacking to the right of the left boundary (i1,i2)
-	const size_t noLpShift = outConstraint.noLP ? 1 : 0;
+	// ensure a stacking to the right of the left boundary (i1,i2);
+	// compile time constant such that the unused branches are removed
+	const size_t noLpShift = noLP ? 1 : 0;
 	E_type iStackE = E_type(0);
 
 	BestInteractionE * curCell = NULL, *curCellSeed = NULL;
 	const BestInteractionE * rightExt = NULL;
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, hybridE.size1()*hybridE.size2() );
+
 	// iterate (decreasingly) over all left interaction starts
 	for (i1=hybridE.size1(); i1-- > 0;) {
 		for (i2=hybridE.size2(); i2-- > 0;) {
@@ -118,9 +160,7 @@ fillHybridE()
 			*curCellSeed = BestInteractionE(E_INF, RnaSequence::lastPos, RnaSequence::lastPos);
 
 			// check if positions can form interaction
-			if (	energy.isAccessible1(i1)
-					&& energy.isAccessible2(i2)
-					&& energy.areComplementary(i1,i2) )
+			if ( pairing.areComplementary(i1,i2) )
 			{
 
 				// no lp allowed
@@ -128,9 +168,7 @@ fillHybridE()
 					// check if right-side stacking of (i1,i2) is possible
 					if ( i1+noLpShift < energy.size1()
 						&& i2+noLpShift < energy.size2()
-						&& energy.isAccessible1(i1+noLpShift)
-						&& energy.isAccessible2(i2+noLpShift)
-						&& energy.areComplementary(i1+noLpShift,i2+noLpShift))
+						&& pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 					{
 						// get stacking term to avoid recomputation
 						iStackE = energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift);
@@ -140,15 +178,18 @@ fillHybridE()
 					}
 				}
 
+				// no valid interaction for this cell so far
+				curCellEtotal = E_INF;
+
 				// set to interaction initiation with according boundary
 				// if valid iStackE value
 				// if valid right boundary
 				if (E_isNotINF(iStackE)
-						&& (!outConstraint.noGUend || !energy.isGU(i1+noLpShift,i2+noLpShift)))
+						&& (!noGUend || !pairing.isGU(i1+noLpShift,i2+noLpShift)))
 				{
 					*curCell = BestInteractionE(iStackE+energy.getE_init(), i1+noLpShift, i2+noLpShift);
 					// current best total energy value (covers to far E_init only)
-					curCellEtotal = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+					curCellEtotal = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 				}
 
 				// no base case with seed so far
@@ -172,14 +213,14 @@ fillHybridE()
 							// get energy of seed only explicitly
 							curE = seedE + energy.getE_init();
 							// check if this combination yields better energy
-							curEseedtotal = energy.getE(i1,sj1,i2,sj2,curE);
+							curEseedtotal = snapshot.getE(i1,sj1,i2,sj2,curE);
 							// update Zall for seed only (if otherwise stacking enforced)
 							updateZall( i1,sj1,i2,sj2, curEseedtotal, false );
 						}
 
 						// for noLP : check for explicit interior loop after seed
 						// assumption: seed fulfills noLP
-						if (outConstraint.noLP) {
+						if (noLP) {
 							// update optimum
 							if ( curEseedtotal < curCellSeedEtotal )
 							{
@@ -208,7 +249,7 @@ fillHybridE()
 									curEloop = energy.getE_interLeft(sj1,sj1+w1,sj2,sj2+w2);
 									curE = seedE + curEloop + rightExt->val;
 									// check if this combination yields better energy
-									curEseedtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+									curEseedtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 									// update Zall
 									updateZall( i1,rightExt->j1,i2,rightExt->j2, curEseedtotal, false );
 									if ( curEseedtotal < curCellSeedEtotal )
@@ -232,7 +273,7 @@ fillHybridE()
 							// get energy of seed interaction with best right extension
 							curE = seedE + rightExt->val;
 							// check if this combination yields better energy
-							curEseedtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+							curEseedtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 							// update Zall (avoid duplicated consideration of seed-only)
 							if (sj1 < rightExt->j1) {
 								updateZall( i1,rightExt->j1,i2,rightExt->j2, curEseedtotal, false );
@@ -256,7 +297,7 @@ fillHybridE()
 				// if !noLP or stacking bp possible
 				if (E_isNotINF(iStackE))  {
 
-					if (outConstraint.noLP) {
+					if (noLP) {
 						/////////////////////////////////////////
 						// check direct extension to the right of the noLP stacking
 						/////////////////////////////////////////
@@ -277,7 +318,7 @@ fillHybridE()
 							// compute energy for direct stack extension
 							curE = iStackE + rightExt->val;
 							// check if this combination yields better energy
-							curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+							curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 							if ( curEtotal < curCellEtotal )
 							{
 								// update current best for this left boundary
@@ -305,7 +346,7 @@ fillHybridE()
 							// compute energy for direct stack extension
 							curE = iStackE + rightExt->val;
 							// check if this combination yields better energy
-							curEseedtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+							curEseedtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 							if ( curEseedtotal < curCellSeedEtotal )
 							{
 								// update current best for this left boundary
@@ -346,7 +387,7 @@ fillHybridE()
 							curEloop = energy.getE_interLeft(i1+noLpShift,i1+noLpShift+w1,i2+noLpShift,i2+noLpShift+w2);
 							curE = iStackE + curEloop + rightExt->val;
 							// check if this combination yields better energy
-							curEtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+							curEtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 							if ( curEtotal < curCellEtotal )
 							{
 								// update current best for this left boundary
@@ -378,7 +419,7 @@ fillHybridE()
 							// compute energy for this loop sizes
 							curE = iStackE + curEloop + rightExt->val;
 							// check if this combination yields better energy
-							curEseedtotal = energy.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
+							curEseedtotal = snapshot.getE(i1,rightExt->j1,i2,rightExt->j2,curE);
 							if ( curEseedtotal < curCellSeedEtotal )
 							{
 								// update current best for this left boundary
@@ -535,7 +576,7 @@ traceBack( Interaction & interaction )
 			interaction.setSeedRange(
 							energy.getBasePair(i1,i2),
 							energy.getBasePair(k1,k2),
-							energy.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
+							snapshot.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
 			// traceback seed base pairs (excludes right most = (k1,k2))
 			seedHandler.traceBackSeed( interaction, i1, i2 );
 			// check if seed only
@@ -658,7 +699,7 @@ getNextBest( Interaction & curBest )
 				continue;
 			}
 			// get overall energy of the interaction
-			curCellE = energy.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
+			curCellE = snapshot.getE(i1,curCell->j1,i2,curCell->j2,curCell->val);
 			// or energy is too low to be considered
 			// or energy is higher than current best found so far
 			if (curCellE < curBestE || curCellE >= curBestCellE )
@@ -102,6 +102,19 @@ protected:
 	void
 	fillHybridE();
 
+	/**
+	 * Implementation of fillHybridE() specialized at compile time whether or
+	 * not lonely base pairs are to be avoided and whether or not GU base pairs
+	 * are allowed at interaction ends.
+	 *
+	 * @tparam noLP whether or not lonely base pairs are forbidden
+	 * @tparam noGUend whether or not GU base pairs are forbidden at the
+	 *         interaction ends
+	 */
+	template< bool noLP, bool noGUend >
+	void
+	fillHybridE_noLP_noGUend();
+
 
 	/**
 	 * Identifies the next best interaction (containing a seed)
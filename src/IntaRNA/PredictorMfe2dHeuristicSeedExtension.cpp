@@ -1,6 +1,8 @@
 
 #include "IntaRNA/PredictorMfe2dHeuristicSeedExtension.h"
 
+#include "IntaRNA/Profiler.h"
+
 namespace IntaRNA {
 
 //////////////////////////////////////////////////////////////////////////
@@ -57,9 +59,23 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 	const size_t range_size2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( range_size1, range_size2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
 	// initialize mfe interaction for updates
 	initOptima();
 
+	// precompute pairing information of the window
+	pairing.init( energy, 0, range_size1-1, 0, range_size2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( range_size1, range_size2 );
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, range_size1-1, 0, range_size2-1 ) == 0) {
@@ -84,6 +100,10 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 		// check if seed fits into interaction range
 		if (sj1 > range_size1 || sj2 > range_size2)
 			continue;
+		// screening : skip seed if no reportable interaction can contain it
+		if (isScreeningPrunable( seedE, sl1, sl2 )) {
+			continue;
+		}
 
 		// init optimal right boundaries
 		j1opt = sj1;
@@ -95,7 +115,7 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 		fillHybridE_right(sj1, sj2, si1, si2);
 
 		// ensure there is a valid right-extension
-		if (!output.getOutputConstraint().noGUend || (!E_isINF(E_right_opt) || !energy.isGU(sj1,sj2))) {
+		if (!output.getOutputConstraint().noGUend || (!E_isINF(E_right_opt) || !pairing.isGU(sj1,sj2))) {
 			// EL
 			hybridE_left.resize( std::min(si1+1, maxMatrixLen1), std::min(si2+1, maxMatrixLen2) );
 			fillHybridE_left(si1, si2);
@@ -115,6 +135,9 @@ PredictorMfe2dHeuristicSeedExtension::
 fillHybridE_right( const size_t sj1, const size_t sj2
 			, const size_t si1, const size_t si2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridE_right.size1()*hybridE_right.size2() );
+
 	// temporary access
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
 
@@ -137,26 +160,22 @@ fillHybridE_right( const size_t sj1, const size_t sj2
 		for (j2=sj2; j2-sj2 < hybridE_right.size2(); j2++) {
 
 			// referencing cell access
-			E_type & curMinE = hybridE_right(j1-sj1,j2-sj2);
+			E_storage_type & curMinE = hybridE_right(j1-sj1,j2-sj2);
 
 			// init current cell (0 if just left (i1,i2) base pair)
 			curMinE = (sj1==j1 && sj2==j2) ? 0 : E_INF;
 
 			// skip if not accessible
 			// check if complementary
-			if ( energy.isAccessible1(j1)
-				&& energy.isAccessible2(j2)
-				&& sj1<j1
+			if ( sj1<j1
 				&& sj2<j2
-				&& energy.areComplementary(j1,j2) )
+				&& pairing.areComplementary(j1,j2) )
 			{
 
 				// left-stacking of j if no-LP
 				if (outConstraint.noLP) {
 					// skip if no stacking possible
-					if (  !energy.areComplementary(j1-noLpShift,j2-noLpShift)
-						| !energy.isAccessible1(j1-noLpShift)
-						| !energy.isAccessible2(j2-noLpShift))
+					if (  !pairing.areComplementary(j1-noLpShift,j2-noLpShift))
 					{
 						continue;
 					}
@@ -164,7 +183,7 @@ fillHybridE_right( const size_t sj1, const size_t sj2
 					iStackE = energy.getE_interLeft(j1-noLpShift,j1,j2-noLpShift,j2);
 					// check just stacked seed extension
 					if (j1-noLpShift==sj1 && j2-noLpShift==sj2) {
-						curMinE = std::min( curMinE, iStackE + hybridE_right(0,0) );
+						curMinE = std::min<E_type>( curMinE, iStackE + hybridE_right(0,0) );
 					}
 				}
 
@@ -177,7 +196,7 @@ fillHybridE_right( const size_t sj1, const size_t sj2
 						if (j2-noLpShift-k2 > energy.getMaxInternalLoopSize2()+1) break;
 						// check if (k1,k2) are valid left boundary
 						if ( E_isNotINF( hybridE_right(k1-sj1,k2-sj2) ) ) {
-							curMinE = std::min( curMinE,
+							curMinE = std::min<E_type>( curMinE,
 									(hybridE_right(k1-sj1,k2-sj2) // left part
 									+ energy.getE_interLeft(k1,j1-noLpShift,k2,j2-noLpShift) // loop
 									+ iStackE) // right stack if no-LP
@@ -205,6 +224,9 @@ void
 PredictorMfe2dHeuristicSeedExtension::
 fillHybridE_left( const size_t si1, const size_t si2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridE_left.size1()*hybridE_left.size2() );
+
 	// temporary access
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
 
@@ -237,30 +259,26 @@ fillHybridE_left( const size_t si1, const size_t si2 )
 			i2 = si2-l2;
 
 			// referencing cell access
-			E_type & curMinE = hybridE_left(l1,l2);
+			E_storage_type & curMinE = hybridE_left(l1,l2);
 			// init cell
 			curMinE = (i1==si1 && i2==si2) ? energy.getE_init() : E_INF;
 			// skip if not accessible
 			// check if complementary
-			if (energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& i1<si1
+			if (i1<si1
 				&& i2<si2
-				&& energy.areComplementary(i1,i2) )
+				&& pairing.areComplementary(i1,i2) )
 			{
 				// left-stacking of j if no-LP
 				if (outConstraint.noLP) {
 					// skip if no stacking possible
-					if (  !energy.areComplementary(i1+noLpShift,i2+noLpShift)
-						| !energy.isAccessible1(i1+noLpShift)
-						| !energy.isAccessible2(i2+noLpShift))
+					if (  !pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 					{
 						continue;
 					}
 					// get stacking energy to avoid recomputation in recursion below
 					iStackE = energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift);
 					// check just stacked
-					curMinE = std::min( curMinE, iStackE + hybridE_left(l1-noLpShift,l2-noLpShift));
+					curMinE = std::min<E_type>( curMinE, iStackE + hybridE_left(l1-noLpShift,l2-noLpShift));
 				}
 
 				// check all combinations of decompositions into (i1,i2)..(k1,k2)-(j1,j2)
@@ -272,7 +290,7 @@ fillHybridE_left( const size_t si1, const size_t si2 )
 					if (k2-i2-noLpShift > energy.getMaxInternalLoopSize2()+1) break;
 					// check if (k1,k2) are valid left boundary
 					if ( E_isNotINF( hybridE_left(si1-k1,si2-k2) ) ) {
-						curMinE = std::min( curMinE,
+						curMinE = std::min<E_type>( curMinE,
 								(iStackE // i stacking if no-LP
 										+ energy.getE_interLeft(i1+noLpShift,k1,i2+noLpShift,k2) // loop
 										+ hybridE_left(si1-k1,si2-k2) ) // right part up to seed
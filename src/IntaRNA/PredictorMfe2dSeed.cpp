@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfe2dSeed.h"
+#include "IntaRNA/Profiler.h"
 
 namespace IntaRNA {
 
@@ -57,6 +58,20 @@ predict( const IndexRange & r1, const IndexRange & r2  )
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridE_pqsize1, hybridE_pqsize2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, hybridE_pqsize1-1, 0, hybridE_pqsize2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridE_pqsize1, hybridE_pqsize2 );
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, hybridE_pqsize1-1, 0, hybridE_pqsize2-1 ) == 0) {
@@ -77,15 +92,15 @@ predict( const IndexRange & r1, const IndexRange & r2  )
 	// for all right ends j1
 	for (size_t j1 = hybridE_pq.size1(); j1-- > 0; ) {
 		// check if j1 is accessible
-		if (!energy.isAccessible1(j1))
+		if (!pairing.isAccessible1(j1))
 			continue;
 		// iterate over all right ends j2
 		for (size_t j2 = hybridE_pq.size2(); j2-- > 0; ) {
 			// check if j2 is accessible
-			if (!energy.isAccessible2(j2))
+			if (!pairing.isAccessible2(j2))
 				continue;
 			// check if base pair (j1,j2) possible
-			if (!energy.areComplementary( j1, j2 ))
+			if (!pairing.areComplementary( j1, j2 ))
 				continue;
 
 			// compute both hybridE_pq and hybridE_pq_seed and update mfe
@@ -106,8 +121,23 @@ fillHybridE( const size_t j1, const size_t j2
 		, const size_t i1min, const size_t i2min
 		, const bool callUpdateOptima)
 {
-	// temporary access
-	const OutputConstraint & outConstraint = output.getOutputConstraint();
+	// call implementation specialized for the output constraints
+	if (output.getOutputConstraint().noLP) {
+		fillHybridE_noLP<true>( j1, j2, i1min, i2min, callUpdateOptima );
+	} else {
+		fillHybridE_noLP<false>( j1, j2, i1min, i2min, callUpdateOptima );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+template< bool noLP >
+void
+PredictorMfe2dSeed::
+fillHybridE_noLP( const size_t j1, const size_t j2
+		, const size_t i1min, const size_t i2min
+		, const bool callUpdateOptima)
+{
 
 #if INTARNA_IN_DEBUG_MODE
 	if (i1min > j1)
@@ -133,10 +163,14 @@ fillHybridE( const size_t j1, const size_t j2
 	size_t i1,i2,k1,k2,j1c,j2c, w1,w2;
 
 	// determine whether or not lonely base pairs are allowed or if we have to
-	// ensure a stacking to the right of the left boundary (i1,i2)
-	const size_t noLpShift = outConstraint.noLP ? 1 : 0;
+	// ensure a stacking to the right of the left boundary (i1,i2);
+	// compile time constant such that the unused branches are removed
+	const size_t noLpShift = noLP ? 1 : 0;
 	E_type iStackE = E_type(0);
 
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, (j1-i1start+1)*(j2-i2start+1) );
+
 	//////////  COMPUTE HYBRIDIZATION ENERGIES (WITHOUT AND WITH SEED)  ////////////
 
 	// current minimal value
@@ -153,17 +187,15 @@ fillHybridE( const size_t j1, const size_t j2
 			hybridE_pq_seed(i1,i2) = E_INF;
 
 			// check if this cell is to be computed (!=E_INF)
-			if( energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& energy.areComplementary(i1,i2))
+			if( pairing.areComplementary(i1,i2))
 			{
 
 				// w2 = interaction width in seq2
 				w2 = j2-i2+1;
 
 				// reference access to cell value
-				E_type &curMinE = hybridE_pq(i1,i2);
-				E_type &curMinEseed = hybridE_pq_seed(i1,i2);
+				E_storage_type & curMinE = hybridE_pq(i1,i2);
+				E_storage_type & curMinEseed = hybridE_pq_seed(i1,i2);
 
 				// either interaction initiation
 				if ( i1==j1 && i2==j2 )  {
@@ -184,16 +216,14 @@ fillHybridE( const size_t j1, const size_t j2
 					} else {
 						// no lp allowed
 						// check if right-side stacking of (i1,i2) is possible
-						if (energy.isAccessible1(i1+noLpShift)
-							&& energy.isAccessible2(i2+noLpShift)
-							&& energy.areComplementary(i1+noLpShift,i2+noLpShift))
+						if (pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 						{
 							// get stacking term to avoid recomputation
 							iStackE = energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift);
 
 							// init with stacking only
 							// or stacking with right extension
-							curMinE = iStackE + ((w1==2&&w2==2) ? energy.getE_init() : hybridE_pq(i1+noLpShift, i2+noLpShift) );
+							curMinE = iStackE + ((w1==2&&w2==2) ? energy.getE_init() : E_type(hybridE_pq(i1+noLpShift, i2+noLpShift)) );
 						} else {
 							//
 							iStackE = E_INF;
@@ -212,15 +242,15 @@ fillHybridE( const size_t j1, const size_t j2
 							// init = seed + something without seed
 							if ( E_isNotINF(hybridE_pq(k1,k2)) ) {
 								// Note: noLP-handling via hybridE_pq recursion
-								curMinEseed = std::min( curMinEseed, seedHandler.getSeedE(i1,i2) + hybridE_pq(k1,k2) );
+								curMinEseed = std::min<E_type>( curMinEseed, seedHandler.getSeedE(i1,i2) + hybridE_pq(k1,k2) );
 							} else
 							// just the seed up to right boundary (explicit noLP handling)
 							// ensure minimal seed length in noLP mode
 							if (k1 == j1 && k2 == j2 && k1>=i1+noLpShift) {
-								curMinEseed = std::min( curMinEseed, seedHandler.getSeedE(i1,i2) + energy.getE_init() );
+								curMinEseed = std::min<E_type>( curMinEseed, seedHandler.getSeedE(i1,i2) + energy.getE_init() );
 							}
 							// handle interior loops after seeds in noLP-mode
-							if ( outConstraint.noLP) {
+							if (noLP) {
 								// multi-bp seed can be followed directly by interior loop
 								// check all combinations of decompositions into (k1,k2)..(l1,l2)-(j1,j2)
 								if (k1 > i1 && j1-k1 > 2 && j2-k2 > 2) {
@@ -231,7 +261,7 @@ fillHybridE( const size_t j1, const size_t j2
 											// get loop energy
 											curEloop = energy.getE_interLeft(k1,l1,k2,l2);
 											// update minimal value
-											curMinEseed = std::min( curMinEseed, (seedHandler.getSeedE(i1,i2) + curEloop + hybridE_pq(l1,l2) ) );
+											curMinEseed = std::min<E_type>( curMinEseed, (seedHandler.getSeedE(i1,i2) + curEloop + hybridE_pq(l1,l2) ) );
 										}
 									}
 									}
@@ -241,9 +271,9 @@ fillHybridE( const size_t j1, const size_t j2
 					}
 
 					// handle direct left-stacking in noLP-mode
-					if ( outConstraint.noLP) {
+					if (noLP) {
 						if ( E_isNotINF( hybridE_pq_seed(i1+noLpShift,i2+noLpShift) ) ) {
-							curMinEseed = std::min( curMinEseed, (iStackE + hybridE_pq_seed(i1+noLpShift,i2+noLpShift) ) );
+							curMinEseed = std::min<E_type>( curMinEseed, (iStackE + hybridE_pq_seed(i1+noLpShift,i2+noLpShift) ) );
 						}
 					}
 
@@ -256,10 +286,10 @@ fillHybridE( const size_t j1, const size_t j2
 								// get loop energy
 								curEloop = energy.getE_interLeft(i1+noLpShift,k1,i2+noLpShift,k2);
 								// update minimal value
-								curMinE = std::min( curMinE, (iStackE + curEloop + hybridE_pq(k1,k2) ) );
+								curMinE = std::min<E_type>( curMinE, (iStackE + curEloop + hybridE_pq(k1,k2) ) );
 								// check if (k1,k2) are valid left boundaries including a seed
 								if ( E_isNotINF( hybridE_pq_seed(k1,k2) ) ) {
-									curMinEseed = std::min( curMinEseed, (iStackE + curEloop + hybridE_pq_seed(k1,k2) ) );
+									curMinEseed = std::min<E_type>( curMinEseed, (iStackE + curEloop + hybridE_pq_seed(k1,k2) ) );
 								}
 							}
 						}
@@ -379,7 +409,7 @@ traceBack( Interaction & interaction )
 					interaction.setSeedRange(
 									energy.getBasePair(i1,i2),
 									energy.getBasePair(k1,k2),
-									energy.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
+									snapshot.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
 					// trace back seed base pairs
 					seedHandler.traceBackSeed( interaction, i1, i2 );
 					seedNotTraced = false;
@@ -392,7 +422,7 @@ traceBack( Interaction & interaction )
 					interaction.setSeedRange(
 									energy.getBasePair(i1,i2),
 									energy.getBasePair(k1,k2),
-									energy.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
+									snapshot.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
 					// trace back seed base pairs
 					seedHandler.traceBackSeed( interaction, i1, i2 );
 					seedNotTraced = false;
@@ -419,7 +449,7 @@ traceBack( Interaction & interaction )
 								interaction.setSeedRange(
 												energy.getBasePair(i1,i2),
 												energy.getBasePair(k1,k2),
-												energy.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
+												snapshot.getE(i1,k1,i2,k2,seedE)+energy.getE_init());
 								// trace back seed base pairs
 								seedHandler.traceBackSeed( interaction, i1, i2 );
 								seedNotTraced = false;
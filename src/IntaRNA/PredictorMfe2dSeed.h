@@ -114,6 +114,25 @@ protected:
 				, const bool callUpdateOptima
 				);
 
+	/**
+	 * Implementation of fillHybridE() specialized at compile time whether or
+	 * not lonely base pairs are to be avoided.
+	 *
+	 * @param j1 end of the interaction within seq 1
+	 * @param j2 end of the interaction within seq 2
+	 * @param i1init smallest value for i1
+	 * @param i2init smallest value for i2
+	 * @param callUpdateOptima whether or not to call updateOptima()
+	 *
+	 * @tparam noLP whether or not lonely base pairs are forbidden
+	 */
+	template< bool noLP >
+	void
+	fillHybridE_noLP( const size_t j1, const size_t j2
+				, const size_t i1init, const size_t i2init
+				, const bool callUpdateOptima
+				);
+
 	/**
 	 * Fills a given interaction (boundaries given) with the according
 	 * hybridizing base pairs using hybridE_seed.
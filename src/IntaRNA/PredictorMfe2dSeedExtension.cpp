@@ -1,6 +1,8 @@
 
 #include "IntaRNA/PredictorMfe2dSeedExtension.h"
 
+#include "IntaRNA/Profiler.h"
+
 namespace IntaRNA {
 
 //////////////////////////////////////////////////////////////////////////
@@ -57,6 +59,20 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 	const size_t range_size2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( range_size1, range_size2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, range_size1-1, 0, range_size2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( range_size1, range_size2 );
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, range_size1-1, 0, range_size2-1 ) == 0) {
@@ -84,6 +100,10 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 		// check if seed fits into interaction range
 		if (sj1 > range_size1 || sj2 > range_size2)
 			continue;
+		// screening : skip seed if no reportable interaction can contain it
+		if (isScreeningPrunable( seedE, sl1, sl2 )) {
+			continue;
+		}
 		const size_t maxMatrixLen1 = energy.getAccessibility1().getMaxLength()-sl1+1;
 		const size_t maxMatrixLen2 = energy.getAccessibility2().getMaxLength()-sl2+1;
 
@@ -128,6 +148,9 @@ void
 PredictorMfe2dSeedExtension::
 fillHybridE_left( const size_t si1, const size_t si2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridE_left.size1()*hybridE_left.size2() );
+
 	// temporary access
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
 #if INTARNA_IN_DEBUG_MODE
@@ -153,31 +176,27 @@ fillHybridE_left( const size_t si1, const size_t si2 )
 			i2 = si2-l2;
 
 			// referencing cell access
-			E_type & curE = hybridE_left(l1,l2);
+			E_storage_type & curE = hybridE_left(l1,l2);
 			// init current cell (e_init if just left (i1,i2) base pair; assuming seed is internally stacked on the left end if noLP)
 			curE = (i1==si1 && i2==si2) ? energy.getE_init() : E_INF;
 			// skip if not accessible
 			// check if complementary
-			if (energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& i1<si1
+			if (i1<si1
 				&& i2<si2
-				&& energy.areComplementary(i1,i2) )
+				&& pairing.areComplementary(i1,i2) )
 			{
 
 				// right-stacking of i if no-LP
 				if (outConstraint.noLP) {
 					// skip if no stacking possible
-					if (  !energy.areComplementary(i1+noLpShift,i2+noLpShift)
-						| !energy.isAccessible1(i1+noLpShift)
-						| !energy.isAccessible2(i2+noLpShift))
+					if (  !pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 					{
 						continue;
 					}
 					// get stacking energy to avoid recomputation in recursion below
 					iStackE = energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift);
 					// check just stacked
-					curE = std::min( curE, iStackE + hybridE_left(l1-noLpShift,l2-noLpShift));
+					curE = std::min<E_type>( curE, iStackE + hybridE_left(l1-noLpShift,l2-noLpShift));
 				}
 
 				// check all combinations of decompositions into (i1,i2)..(k1,k2)-(si1,si2)
@@ -188,9 +207,9 @@ fillHybridE_left( const size_t si1, const size_t si2 )
 						// ensure maximal loop length
 						if (k2-i2-noLpShift > energy.getMaxInternalLoopSize2()+1) break;
 						// check if (k1,k2) are valid left boundary
-		if ( energy.isAccessible1(k1) && energy.isAccessible2(k2) )
+		if ( pairing.isAccessible1(k1) && pairing.isAccessible2(k2) )
 						if ( E_isNotINF( hybridE_left(si1-k1,si2-k2) ) ) {
-							curE = std::min( curE,
+							curE = std::min<E_type>( curE,
 									(iStackE
 											+ energy.getE_interLeft(i1+noLpShift,k1,i2+noLpShift,k2)
 											+ hybridE_left(si1-k1,si2-k2) )
@@ -210,6 +229,9 @@ void
 PredictorMfe2dSeedExtension::
 fillHybridE_right( const size_t sj1, const size_t sj2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridE_right.size1()*hybridE_right.size2() );
+
 	// temporary access
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
 #if INTARNA_IN_DEBUG_MODE
@@ -232,25 +254,21 @@ fillHybridE_right( const size_t sj1, const size_t sj2 )
 		for (j2=sj2; j2-sj2 < hybridE_right.size2(); j2++) {
 
 			// referencing access to cell
-			E_type & curE = hybridE_right(j1-sj1,j2-sj2);
+			E_storage_type & curE = hybridE_right(j1-sj1,j2-sj2);
 			// init current cell (0 if just left (i1,i2) base pair)
 			curE = (sj1==j1 && sj2==j2) ? 0 : E_INF;
 
 			// skip if not accessible
 			// check if complementary
-			if (energy.isAccessible1(j1)
-				&& energy.isAccessible2(j2)
-				&& sj1<j1
+			if (sj1<j1
 				&& sj2<j2
-				&& energy.areComplementary(j1,j2) )
+				&& pairing.areComplementary(j1,j2) )
 			{
 
 				// left-stacking of j if no-LP
 				if (outConstraint.noLP) {
 					// skip if no stacking possible
-					if (!energy.areComplementary(j1-noLpShift,j2-noLpShift)
-						| !energy.isAccessible1(j1-noLpShift)
-						| !energy.isAccessible2(j2-noLpShift))
+					if (!pairing.areComplementary(j1-noLpShift,j2-noLpShift))
 					{
 						continue;
 					}
@@ -258,7 +276,7 @@ fillHybridE_right( const size_t sj1, const size_t sj2 )
 					iStackE = energy.getE_interLeft(j1-noLpShift,j1,j2-noLpShift,j2);
 					// check just stacked seed extension
 					if (j1-noLpShift==sj1 && j2-noLpShift==sj2) {
-						curE = std::min( curE, iStackE + hybridE_right(0,0) );
+						curE = std::min<E_type>( curE, iStackE + hybridE_right(0,0) );
 					}
 				}
 
@@ -270,9 +288,9 @@ fillHybridE_right( const size_t sj1, const size_t sj2 )
 					// ensure maximal loop length
 					if (j2-noLpShift-k2 > energy.getMaxInternalLoopSize2()+1) break;
 					// check if (k1,k2) are valid left boundary
-if ( energy.isAccessible1(k1) && energy.isAccessible2(k2) )
+if ( pairing.isAccessible1(k1) && pairing.isAccessible2(k2) )
 					if ( E_isNotINF( hybridE_right(k1-sj1,k2-sj2) ) ) {
-						curE = std::min( curE,
+						curE = std::min<E_type>( curE,
 								(hybridE_right(k1-sj1,k2-sj2)
 										+ energy.getE_interLeft(k1,j1-noLpShift,k2,j2-noLpShift)
 										+ iStackE )
@@ -369,7 +387,7 @@ traceBack( Interaction & interaction )
 			fillHybridE_right( sj1, sj2 );
 
 			if ( E_equal( fullE,
-					(energy.getE(i1, j1, i2, j2, seedE + hybridE_left( si1-i1, si2-i2 ) + hybridE_right( j1-sj1, j2-sj2 )))))
+					(snapshot.getE(i1, j1, i2, j2, seedE + hybridE_left( si1-i1, si2-i2 ) + hybridE_right( j1-sj1, j2-sj2 )))))
 			{
 				// found seed -> traceback
 				// the currently traced value for i1-si1, i2-si2
@@ -63,6 +63,15 @@ predict( const IndexRange & r1, const IndexRange & r2  )
 	const size_t interaction_size2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( interaction_size1, interaction_size2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, interaction_size1-1, 0, interaction_size2-1 ) == 0) {
@@ -89,6 +98,10 @@ predict( const IndexRange & r1, const IndexRange & r2  )
 		// check if seed fits into interaction range
 		if (sj1 > interaction_size1 || sj2 > interaction_size2)
 			continue;
+		// screening : skip seed if no reportable interaction can contain it
+		if (isScreeningPrunable( seedE, sl1, sl2 )) {
+			continue;
+		}
 
 		ExtendedSeed extension;
 		extension.i1 = si1;
@@ -50,13 +50,13 @@ updateZ( const size_t i1, const size_t j1
 	Z_type partZ_withED = 0, partZ_noED = 0;
 	if (isHybridZ) {
 #if INTARNA_IN_DEBUG_MODE
-		if ( (std::numeric_limits<Z_type>::max() - (partZ*energy.getBoltzmannWeight(energy.getE(i1,j1,i2,j2, E_type(0))))) <= Zall) {
+		if ( (std::numeric_limits<Z_type>::max() - (partZ*energy.getBoltzmannWeight(snapshot.getE(i1,j1,i2,j2, E_type(0))))) <= Zall) {
 			LOG(WARNING) <<"PredictorMfeEns::updateZ() : partition function overflow! Recompile with larger partition function data type!";
 		}
 #endif
 		// add ED penalties etc.
 		partZ_noED = partZ;
-		partZ_withED = partZ*energy.getBoltzmannWeight(energy.getE(i1,j1,i2,j2, E_type(0)));
+		partZ_withED = partZ*energy.getBoltzmannWeight(snapshot.getE(i1,j1,i2,j2, E_type(0)));
 	} else {
 #if INTARNA_IN_DEBUG_MODE
 		if ( (std::numeric_limits<Z_type>::max() - partZ) <= Zall) {
@@ -64,7 +64,7 @@ updateZ( const size_t i1, const size_t j1
 		}
 #endif
 		// remove ED
-		partZ_noED = partZ / energy.getBoltzmannWeight(energy.getE(i1,j1,i2,j2, E_type(0)));;
+		partZ_noED = partZ / energy.getBoltzmannWeight(snapshot.getE(i1,j1,i2,j2, E_type(0)));;
 		partZ_withED = partZ;
 	}
 
@@ -93,7 +93,7 @@ updateOptimaUsingZ()
 	{
 		// if partition function is > 0
 		if (Z_isNotINF(it->second) && it->second > 0) {
-			PredictorMfe::updateOptima( it->first.i1, it->first.j1, it->first.i2, it->first.j2, energy.getE(it->second), true, false );
+			PredictorMfe::updateOptima( it->first.i1, it->first.j1, it->first.i2, it->first.j2, energy.getE_scaled(it->second), true, false );
 		}
 	}
 }
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfeEns2d.h"
+#include "IntaRNA/Profiler.h"
 
 #include <stdexcept>
 
@@ -57,6 +58,20 @@ predict( const IndexRange & r1
 				, std::min( energy.size2()
 						, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 ) );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridZ.size1(), hybridZ.size2() )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, hybridZ.size1()-1, 0, hybridZ.size2()-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridZ.size1(), hybridZ.size2() );
+
 	// initialize mfe interaction for updates
 	initOptima();
 	// initialize overall partition function for updates
@@ -65,15 +80,15 @@ predict( const IndexRange & r1
 	// for all right ends j1
 	for (size_t j1 = hybridZ.size1(); j1-- > 0; ) {
 		// check if j1 is accessible
-		if (!energy.isAccessible1(j1))
+		if (!pairing.isAccessible1(j1))
 			continue;
 		// iterate over all right ends j2
 		for (size_t j2 = hybridZ.size2(); j2-- > 0; ) {
 			// check if j2 is accessible
-			if (!energy.isAccessible2(j2))
+			if (!pairing.isAccessible2(j2))
 				continue;
 			// check if base pair (j1,j2) possible
-			if (!energy.areComplementary( j1, j2 ))
+			if (!pairing.areComplementary( j1, j2 ))
 				continue;
 
 			// fill matrix and store best interaction
@@ -115,6 +130,9 @@ fillHybridZ( const size_t j1, const size_t j2
 	const size_t noLpShift = outConstraint.noLP ? 1 : 0;
 	Z_type iStackZ = Z_type(1);
 
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, (j1-i1start+1)*(j2-i2start+1) );
+
 	//////////  COMPUTE HYBRIDIZATION ENERGIES  ////////////
 
 	// iterate over all window starts i1 (seq1) and i2 (seq2)
@@ -128,9 +146,7 @@ fillHybridZ( const size_t j1, const size_t j2
 			hybridZ(i1,i2) = Z_type(0.0);
 
 			// check if this cell is to be computed (!=E_INF)
-			if( energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& energy.areComplementary(i1,i2)
+			if( pairing.areComplementary(i1,i2)
 			)
 			{
 				// w2 = interaction width in seq2
@@ -143,7 +159,7 @@ fillHybridZ( const size_t j1, const size_t j2
 				if ( i1==j1 && i2==j2)  {
 					if (noLpShift == 0) {
 						// single base pair
-						curZ = energy.getBoltzmannWeight(energy.getE_init());
+						curZ = energy.getBoltzmannWeightScaled(energy.getE_init());
 					}
 				}
 				else
@@ -159,15 +175,13 @@ fillHybridZ( const size_t j1, const size_t j2
 					} else {
 						// no lp allowed
 						// check if right-side stacking of (i1,i2) is possible
-						if (energy.isAccessible1(i1+noLpShift)
-							&& energy.isAccessible2(i2+noLpShift)
-							&& energy.areComplementary(i1+noLpShift,i2+noLpShift))
+						if (pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 						{
 							// get stacking term to avoid recomputation
 							iStackZ = energy.getBoltzmannWeight(energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift));
 
 							// init with stacking only
-							curZ = iStackZ * ((w1==2&&w2==2) ? energy.getBoltzmannWeight(energy.getE_init()) : hybridZ(i1+noLpShift, i2+noLpShift) );
+							curZ = iStackZ * ((w1==2&&w2==2) ? energy.getBoltzmannWeightScaled(energy.getE_init()) : hybridZ(i1+noLpShift, i2+noLpShift) );
 						} else {
 							//
 							iStackZ = Z_INF;
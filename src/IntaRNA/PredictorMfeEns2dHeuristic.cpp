@@ -1,5 +1,6 @@
 
 #include "IntaRNA/PredictorMfeEns2dHeuristic.h"
+#include "IntaRNA/Profiler.h"
 
 #include <stdexcept>
 
@@ -58,6 +59,21 @@ predict( const IndexRange & r1
 				, std::min( energy.size2()
 						, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 ) );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( hybridZ.size1(), hybridZ.size2() )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	// (including the next position for right-side stacking checks)
+	pairing.init( energy, 0, hybridZ.size1(), 0, hybridZ.size2() );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( hybridZ.size1(), hybridZ.size2() );
+
 	// init mfe for later updates
 	initOptima();
 	// initialize overall partition function for updates
@@ -93,6 +109,9 @@ fillHybridZ()
 
 	BestInteractionZ * curCell = NULL;
 	const BestInteractionZ * rightExt = NULL;
+	// count DP cells to be computed
+	Profiler::count( Profiler::DP_CELLS, hybridZ.size1()*hybridZ.size2() );
+
 	// iterate (decreasingly) over all left interaction starts
 	for (i1=hybridZ.size1(); i1-- > 0;) {
 		for (i2=hybridZ.size2(); i2-- > 0;) {
@@ -103,18 +122,14 @@ fillHybridZ()
 			*curCell = BestInteractionZ(0.0, RnaSequence::lastPos, RnaSequence::lastPos);
 
 			// check if positions can form interaction
-			if (	energy.isAccessible1(i1)
-					&& energy.isAccessible2(i2)
-					&& energy.areComplementary(i1,i2) )
+			if ( pairing.areComplementary(i1,i2) )
 			{
 				// no lp allowed
 				if (noLpShift != 0) {
 					// check if right-side stacking of (i1,i2) is possible
 					if ( i1+noLpShift < energy.size1()
 						&& i2+noLpShift < energy.size2()
-						&& energy.isAccessible1(i1+noLpShift)
-						&& energy.isAccessible2(i2+noLpShift)
-						&& energy.areComplementary(i1+noLpShift,i2+noLpShift))
+						&& pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 					{
 						// get stacking term to avoid recomputation
 						iStackZ = energy.getBoltzmannWeight(energy.getE_interLeft(i1,i1+noLpShift,i2,i2+noLpShift));
@@ -125,12 +140,12 @@ fillHybridZ()
 				}
 
 				// if valid right boundary
-				if (!outConstraint.noGUend || !energy.isGU(i1+noLpShift,i2+noLpShift))
+				if (!outConstraint.noGUend || !pairing.isGU(i1+noLpShift,i2+noLpShift))
 				{
 					// set to interaction initiation with according boundary
-					*curCell = BestInteractionZ(iStackZ * energy.getBoltzmannWeight(energy.getE_init()), i1+noLpShift, i2+noLpShift);
+					*curCell = BestInteractionZ(iStackZ * energy.getBoltzmannWeightScaled(energy.getE_init()), i1+noLpShift, i2+noLpShift);
 					// current best total energy value (covers to far E_init only)
-					curCellEtotal = energy.getE(i1,i1+noLpShift, i2,i2+noLpShift ,energy.getE(curCell->val));
+					curCellEtotal = snapshot.getE(i1,i1+noLpShift, i2,i2+noLpShift ,energy.getE_scaled(curCell->val));
 					// update overall partition function information for initial bps only
 					updateZ( i1,curCell->j1, i2,curCell->j2, curCell->val, true );
 
@@ -159,7 +174,7 @@ fillHybridZ()
 						updateZ( i1,rightExt->j1, i2,rightExt->j2, curZ, true );
 
 						// check if this combination yields better energy
-						curEtotal = energy.getE(i1,rightExt->j1, i2,rightExt->j2, energy.getE(curZ));
+						curEtotal = snapshot.getE(i1,rightExt->j1, i2,rightExt->j2, energy.getE_scaled(curZ));
 
 						// update best right extension for (i1,i2) in curCell
 						if ( curEtotal < curCellEtotal )
@@ -199,7 +214,7 @@ fillHybridZ()
 					updateZ( i1,rightExt->j1, i2,rightExt->j2, curZ, true );
 
 					// check if this combination yields better energy
-					curEtotal = energy.getE(i1,rightExt->j1, i2,rightExt->j2, energy.getE(curZ));
+					curEtotal = snapshot.getE(i1,rightExt->j1, i2,rightExt->j2, energy.getE_scaled(curZ));
 
 					// update best right extension for (i1,i2) in curCell
 					if ( curEtotal < curCellEtotal )
@@ -260,7 +275,7 @@ getNextBest( Interaction & curBest )
 				continue;
 			}
 			// get overall energy of the interaction
-			curCellE = energy.getE(curCell->val);
+			curCellE = energy.getE_scaled(curCell->val);
 			// or energy is too low to be considered
 			// or energy is higher than current best found so far
 			if (curCellE < curBestE || curCellE >= curBestCellE )
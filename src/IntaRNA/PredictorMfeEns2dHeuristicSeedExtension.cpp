@@ -1,5 +1,7 @@
 #include "IntaRNA/PredictorMfeEns2dHeuristicSeedExtension.h"
 
+#include "IntaRNA/Profiler.h"
+
 namespace IntaRNA {
 
 //////////////////////////////////////////////////////////////////////////
@@ -56,6 +58,20 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 	const size_t range_size2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( range_size1, range_size2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, range_size1-1, 0, range_size2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( range_size1, range_size2 );
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, range_size1-1, 0, range_size2-1 ) == 0) {
@@ -97,7 +113,7 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 		fillHybridZ_right(sj1, sj2, si1, si2);
 
 		// ensure there is a valid right-extension
-		if (!output.getOutputConstraint().noGUend || (!E_isINF(E_right_opt) || !energy.isGU(sj1,sj2))) {
+		if (!output.getOutputConstraint().noGUend || (!E_isINF(E_right_opt) || !pairing.isGU(sj1,sj2))) {
 			// EL
 			hybridZ_left.resize( std::min(si1+1, maxMatrixLen1), std::min(si2+1, maxMatrixLen2) );
 			fillHybridZ_left(si1, si2);
@@ -118,10 +134,13 @@ PredictorMfeEns2dHeuristicSeedExtension::
 fillHybridZ_right( const size_t sj1, const size_t sj2
 			, const size_t si1, const size_t si2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridZ_right.size1()*hybridZ_right.size2() );
+
 
 	// static data
 	const Z_type seedZ = energy.getBoltzmannWeight(seedHandler.getSeedE(si1, si2));
-	const Z_type initZ = energy.getBoltzmannWeight(energy.getE_init());
+	const Z_type initZ = energy.getBoltzmannWeightScaled(energy.getE_init());
 
 	// compute right-extensions of current seed
 	PredictorMfeEns2dSeedExtension::fillHybridZ_right(sj1,sj2);
@@ -136,7 +155,7 @@ fillHybridZ_right( const size_t sj1, const size_t sj2
 			// update overall partition function
 			if (!Z_equal(rightExtZ,Z_type(0))) {
 				// update optimal right extension if needed
-				updateOptRightZ( si1,sj1+r1,si2,sj2+r2, energy.getE(seedZ * rightExtZ * initZ) );
+				updateOptRightZ( si1,sj1+r1,si2,sj2+r2, energy.getE_scaled(seedZ * rightExtZ * initZ) );
 				// update overall partition function information for true right-extensions of the current seed
 				// seed only not covered due to min-val of r1,r2
 				updateZ(si1, sj1+r1, si2, sj2+r2, seedZ * rightExtZ * initZ, true);
@@ -153,6 +172,9 @@ void
 PredictorMfeEns2dHeuristicSeedExtension::
 fillHybridZ_left( const size_t si1, const size_t si2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridZ_left.size1()*hybridZ_left.size2() );
+
 	// static data
 	const Z_type seedZ = energy.getBoltzmannWeight(seedHandler.getSeedE(si1, si2));
 	const size_t sj1 = si1 + seedHandler.getSeedLength1(si1,si2) -1;
@@ -1,6 +1,8 @@
 
 #include "IntaRNA/PredictorMfeEns2dSeedExtension.h"
 
+#include "IntaRNA/Profiler.h"
+
 namespace IntaRNA {
 
 //////////////////////////////////////////////////////////////////////////
@@ -57,6 +59,20 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 	const size_t range_size2 = std::min( energy.size2()
 			, (r2.to==RnaSequence::lastPos?energy.size2()-1:r2.to)-r2.from+1 );
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( range_size1, range_size2 )) {
+		// trigger empty interaction reporting
+		initOptima();
+		reportOptima();
+		// stop computation
+		return;
+	}
+
+	// precompute pairing information of the window
+	pairing.init( energy, 0, range_size1-1, 0, range_size2-1 );
+	// flatten the accessibility-based energy terms of the window
+	snapshot.init( range_size1, range_size2 );
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, range_size1-1, 0, range_size2-1 ) == 0) {
@@ -181,6 +197,9 @@ void
 PredictorMfeEns2dSeedExtension::
 fillHybridZ_left( const size_t si1, const size_t si2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridZ_left.size1()*hybridZ_left.size2() );
+
 	// temporary access
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
 #if INTARNA_IN_DEBUG_MODE
@@ -207,22 +226,18 @@ fillHybridZ_left( const size_t si1, const size_t si2 )
 			Z_type & curZ = hybridZ_left(si1-i1,si2-i2);
 
 			// init current cell (0 if not just right-most (j1,j2) base pair)
-			curZ = (i1==si1 && i2==si2) ? energy.getBoltzmannWeight(energy.getE_init()) : 0.0;
+			curZ = (i1==si1 && i2==si2) ? energy.getBoltzmannWeightScaled(energy.getE_init()) : 0.0;
 
 			// check if complementary (use global sequence indexing)
 			if( i1<si1
 				&& i2<si2
-				&& energy.isAccessible1(i1)
-				&& energy.isAccessible2(i2)
-				&& energy.areComplementary(i1,i2) )
+				&& pairing.areComplementary(i1,i2) )
 			{
 
 				// right-stacking of i if no-LP
 				if (outConstraint.noLP) {
 					// skip if no stacking possible
-					if (!energy.areComplementary(i1+noLpShift,i2+noLpShift)
-						| !energy.isAccessible1(i1+noLpShift)
-						| !energy.isAccessible2(i2+noLpShift) )
+					if (!pairing.areComplementary(i1+noLpShift,i2+noLpShift))
 					{
 						continue;
 					}
@@ -346,6 +361,9 @@ void
 PredictorMfeEns2dSeedExtension::
 fillHybridZ_right( const size_t sj1, const size_t sj2 )
 {
+	// count filled cells
+	Profiler::count( Profiler::DP_CELLS, hybridZ_right.size1()*hybridZ_right.size2() );
+
 	// temporary access
 	const OutputConstraint & outConstraint = output.getOutputConstraint();
 #if INTARNA_IN_DEBUG_MODE
@@ -375,17 +393,13 @@ fillHybridZ_right( const size_t sj1, const size_t sj2 )
 			// check if complementary free base pair
 			if( sj1<j1
 				&& sj2<j2
-				&& energy.isAccessible1(j1)
-				&& energy.isAccessible2(j2)
-				&& energy.areComplementary(j1,j2) )
+				&& pairing.areComplementary(j1,j2) )
 			{
 
 				// left-stacking of j if no-LP
 				if (outConstraint.noLP) {
 					// skip if no stacking possible
-					if (!energy.areComplementary(j1-noLpShift,j2-noLpShift)
-						| !energy.isAccessible1(j1-noLpShift)
-						| !energy.isAccessible2(j2-noLpShift) )
+					if (!pairing.areComplementary(j1-noLpShift,j2-noLpShift))
 					{
 						continue;
 					}
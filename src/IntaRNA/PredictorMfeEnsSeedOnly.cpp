@@ -61,6 +61,14 @@ predict( const IndexRange & r1, const IndexRange & r2 )
 	initOptima();
 	initZ();
 
+	// screening : stop if no further reportable interaction is possible
+	if (isScreeningPrunable( seedLastPos1+1, seedLastPos2+1 )) {
+		// trigger empty interaction reporting
+		reportOptima();
+		// stop computation
+		return;
+	}
+
 	// compute seed interactions for whole range
 	// and check if any seed possible
 	if (seedHandler.fillSeed( 0, seedLastPos1, 0, seedLastPos2 ) == 0) {
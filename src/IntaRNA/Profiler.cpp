@@ -0,0 +1,298 @@
+
+#include "IntaRNA/Profiler.h"
+
+#include <algorithm>
+
+namespace IntaRNA {
+
+////////////////////////////////////////////////////////////////////////////
+
+bool Profiler::enabled = false;
+
+std::vector< Profiler::ThreadData* > Profiler::threadData;
+
+std::vector< Profiler::PairRecord > Profiler::pairRecords;
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::Record::
+Record()
+{
+	std::fill( timeNs, timeNs+PHASE_NUMBER, 0 );
+	std::fill( calls, calls+PHASE_NUMBER, 0 );
+	std::fill( counter, counter+COUNTER_NUMBER, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::Record &
+Profiler::Record::
+operator+= ( const Record & r )
+{
+	for (size_t i=0; i<PHASE_NUMBER; i++) {
+		timeNs[i] += r.timeNs[i];
+		calls[i] += r.calls[i];
+	}
+	for (size_t i=0; i<COUNTER_NUMBER; i++) {
+		counter[i] += r.counter[i];
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::Record &
+Profiler::Record::
+operator-= ( const Record & r )
+{
+	for (size_t i=0; i<PHASE_NUMBER; i++) {
+		timeNs[i] -= r.timeNs[i];
+		calls[i] -= r.calls[i];
+	}
+	for (size_t i=0; i<COUNTER_NUMBER; i++) {
+		counter[i] -= r.counter[i];
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::ThreadData::
+ThreadData()
+	: record()
+	, curPhase(PHASE_NONE)
+	, phaseStart(Clock::now())
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::ThreadData &
+Profiler::
+getThreadData()
+{
+	static thread_local ThreadData * data = NULL;
+	if (data == NULL) {
+		data = new ThreadData();
+#if INTARNA_MULITHREADING
+		#pragma omp critical(intarna_omp_profiler)
+#endif
+		{
+			threadData.push_back( data );
+		}
+	}
+	return *data;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::Phase
+Profiler::
+switchPhase( const Phase phase, const bool isCall )
+{
+	ThreadData & data = getThreadData();
+	const Clock::time_point now = Clock::now();
+	// account time to active phase
+	data.record.timeNs[data.curPhase] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - data.phaseStart).count();
+	if (isCall) {
+		data.record.calls[phase]++;
+	}
+	// switch phase
+	const Phase lastPhase = data.curPhase;
+	data.curPhase = phase;
+	data.phaseStart = now;
+	return lastPhase;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::Record
+Profiler::
+getThreadRecord()
+{
+	if (!enabled) {
+		return Record();
+	}
+	// account time of the active phase so far
+	const ThreadData & data = getThreadData();
+	switchPhase( data.curPhase, false );
+	return data.record;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Profiler::Record
+Profiler::
+getTotal()
+{
+	Record total;
+	if (!enabled) {
+		return total;
+	}
+	// account time of the active phase of the calling thread so far
+	getThreadRecord();
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_profiler)
+#endif
+	{
+		for (const ThreadData * data : threadData) {
+			total += data->record;
+		}
+	}
+	return total;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+Profiler::
+addPair( const std::string & target
+		, const std::string & query
+		, const Record & record )
+{
+	if (!enabled) {
+		return;
+	}
+	PairRecord pair = { target, query, record };
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_profiler)
+#endif
+	{
+		pairRecords.push_back( pair );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+const char *
+Profiler::
+getName( const Phase phase )
+{
+	switch (phase) {
+	case PHASE_NONE : return "other";
+	case FASTA_PARSING : return "fastaParsing";
+	case ACCESSIBILITY : return "accessibility";
+	case ES_COMPUTATION : return "esComputation";
+	case SEED_FILL : return "seedFill";
+	case DP_FILL : return "dpFill";
+	case TRACEBACK : return "traceback";
+	case OUTPUT_FORMATTING : return "outputFormatting";
+	case OUTPUT_IO : return "outputIO";
+	default : return "unknown";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+const char *
+Profiler::
+getName( const Counter counter )
+{
+	switch (counter) {
+	case DP_CELLS : return "dpCells";
+	case SEEDS : return "seeds";
+	case INTERACTIONS : return "interactions";
+	case PREFILTER_POSITIONS : return "prefilterPositions";
+	case PREFILTER_PRUNED : return "prefilterPruned";
+	default : return "unknown";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+Profiler::
+writeJson( std::ostream & out, const Record & record )
+{
+	out <<"{ \"time_s\": {";
+	for (size_t p=0; p<PHASE_NUMBER; p++) {
+		out <<(p==0?" ":", ") <<'"'<<getName(Phase(p))<<"\": "<<(double(record.timeNs[p])/1e9);
+	}
+	out <<" }, \"calls\": {";
+	for (size_t p=0; p<PHASE_NUMBER; p++) {
+		out <<(p==0?" ":", ") <<'"'<<getName(Phase(p))<<"\": "<<record.calls[p];
+	}
+	out <<" }, \"counters\": {";
+	for (size_t c=0; c<COUNTER_NUMBER; c++) {
+		out <<(c==0?" ":", ") <<'"'<<getName(Counter(c))<<"\": "<<record.counter[c];
+	}
+	out <<" } }";
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+Profiler::
+writeJson( std::ostream & out )
+{
+	out <<"{\n  \"total\": ";
+	writeJson( out, getTotal() );
+	out <<",\n  \"threads\": [";
+	for (size_t t=0; t<threadData.size(); t++) {
+		out <<(t==0?"\n    ":",\n    ");
+		writeJson( out, threadData.at(t)->record );
+	}
+	out <<"\n  ],\n  \"pairs\": [";
+	for (size_t i=0; i<pairRecords.size(); i++) {
+		out <<(i==0?"\n    ":",\n    ")
+			<<"{ \"target\": \""<<pairRecords.at(i).target<<"\""
+			<<", \"query\": \""<<pairRecords.at(i).query<<"\""
+			<<", \"profile\": ";
+		writeJson( out, pairRecords.at(i).record );
+		out <<" }";
+	}
+	out <<"\n  ]\n}\n";
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+Profiler::
+writeCsv( std::ostream & out, const Record & record )
+{
+	for (size_t p=0; p<PHASE_NUMBER; p++) {
+		out <<';'<<(double(record.timeNs[p])/1e9);
+	}
+	for (size_t p=0; p<PHASE_NUMBER; p++) {
+		out <<';'<<record.calls[p];
+	}
+	for (size_t c=0; c<COUNTER_NUMBER; c++) {
+		out <<';'<<record.counter[c];
+	}
+	out <<'\n';
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+Profiler::
+writeCsv( std::ostream & out )
+{
+	// header
+	out <<"scope;target;query";
+	for (size_t p=0; p<PHASE_NUMBER; p++) {
+		out <<";time_"<<getName(Phase(p));
+	}
+	for (size_t p=0; p<PHASE_NUMBER; p++) {
+		out <<";calls_"<<getName(Phase(p));
+	}
+	for (size_t c=0; c<COUNTER_NUMBER; c++) {
+		out <<';'<<getName(Counter(c));
+	}
+	out <<'\n';
+	// data
+	out <<"total;;";
+	writeCsv( out, getTotal() );
+	for (size_t t=0; t<threadData.size(); t++) {
+		out <<"thread"<<t<<";;";
+		writeCsv( out, threadData.at(t)->record );
+	}
+	for (const PairRecord & pair : pairRecords) {
+		out <<"pair;"<<pair.target<<';'<<pair.query;
+		writeCsv( out, pair.record );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
@@ -0,0 +1,327 @@
+
+#ifndef INTARNA_PROFILER_H_
+#define INTARNA_PROFILER_H_
+
+#include "IntaRNA/general.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+namespace IntaRNA {
+
+/**
+ * Low overhead collection of per-thread phase timings and counters of the
+ * prediction pipeline.
+ *
+ * Profiling is disabled by default. If enabled, each thread accumulates its
+ * own Record, such that no synchronization is needed within the
+ * computations. Phase timings are exclusive, i.e. the time of a nested phase
+ * (e.g. seed fill within DP fill) is not accounted for the enclosing phase.
+ *
+ * If disabled, each timer or counter update is a single flag check.
+ *
+ * @author Martin Mann
+ *
+ */
+class Profiler {
+
+public:
+
+	//! the timed phases of the prediction pipeline
+	enum Phase {
+		PHASE_NONE = 0, //!< time not covered by any phase
+		FASTA_PARSING, //!< sequence input parsing
+		ACCESSIBILITY, //!< accessibility computation per sequence
+		ES_COMPUTATION, //!< ensemble energy of intramolecular structures
+		SEED_FILL, //!< seed computation
+		DP_FILL, //!< interaction recursion
+		TRACEBACK, //!< traceback of optimal interactions
+		OUTPUT_FORMATTING, //!< formatting of reported interactions
+		OUTPUT_IO, //!< writing output to files/streams
+		PHASE_NUMBER //!< number of phases
+	};
+
+	//! counters of the prediction pipeline
+	enum Counter {
+		DP_CELLS = 0, //!< number of DP cells filled
+		SEEDS, //!< number of seeds enumerated
+		INTERACTIONS, //!< number of reported interactions
+		PREFILTER_POSITIONS, //!< number of sequence positions screened by the accessibility pre-filter
+		PREFILTER_PRUNED, //!< number of sequence positions removed by the accessibility pre-filter
+		COUNTER_NUMBER //!< number of counters
+	};
+
+	//! the timings and counters of a single thread or a summary
+	struct Record {
+		//! accumulated time per phase in nanoseconds
+		boost::uint64_t timeNs[PHASE_NUMBER];
+		//! number of calls per phase
+		boost::uint64_t calls[PHASE_NUMBER];
+		//! counter values
+		boost::uint64_t counter[COUNTER_NUMBER];
+
+		//! zero-initialized record
+		Record();
+
+		//! adds all values of the given record
+		Record & operator+= ( const Record & r );
+
+		//! subtracts all values of the given record
+		Record & operator-= ( const Record & r );
+	};
+
+	/**
+	 * Scoped timer that accounts its life time to a given phase.
+	 * The timing of the enclosing phase is suspended meanwhile.
+	 */
+	class Timer {
+	public:
+		/**
+		 * Starts the timing of the given phase if profiling is enabled
+		 * @param phase the phase to account the time to
+		 */
+		Timer( const Phase phase );
+
+		/**
+		 * Stops the timing and restores the enclosing phase
+		 */
+		~Timer();
+
+	protected:
+		//! the phase active before this timer or PHASE_NUMBER if disabled
+		Phase parent;
+	};
+
+public:
+
+	/**
+	 * Whether or not profiling is enabled
+	 * @return true if timings and counters are collected
+	 */
+	static
+	bool
+	isEnabled();
+
+	/**
+	 * Enables or disables profiling; should be called before any
+	 * computation starts.
+	 * @param enabled whether or not to collect timings and counters
+	 */
+	static
+	void
+	setEnabled( const bool enabled );
+
+	/**
+	 * Increases a counter of the calling thread
+	 * @param counter the counter to increase
+	 * @param value the value to add
+	 */
+	static
+	void
+	count( const Counter counter, const size_t value = 1 );
+
+	/**
+	 * Provides a copy of the current record of the calling thread
+	 * @return the record of the calling thread
+	 */
+	static
+	Record
+	getThreadRecord();
+
+	/**
+	 * Provides the sum of the records of all threads. Note, the records of
+	 * other threads are read without synchronization, i.e. they should not
+	 * be busy when calling this function.
+	 * @return the summed record of all threads
+	 */
+	static
+	Record
+	getTotal();
+
+	/**
+	 * Stores the profile of a query-target combination to be reported
+	 * @param target the target sequence id
+	 * @param query the query sequence id
+	 * @param record the profile of the combination
+	 */
+	static
+	void
+	addPair( const std::string & target
+			, const std::string & query
+			, const Record & record );
+
+	/**
+	 * Writes the profile summary in JSON format, i.e. the total, the
+	 * per-thread and the per query-target combination records
+	 * @param out the stream to write to
+	 */
+	static
+	void
+	writeJson( std::ostream & out );
+
+	/**
+	 * Writes the profile summary in CSV format with one line for the total,
+	 * each thread and each query-target combination
+	 * @param out the stream to write to
+	 */
+	static
+	void
+	writeCsv( std::ostream & out );
+
+	/**
+	 * Provides the name of a phase
+	 * @param phase the phase of interest
+	 * @return the name of the phase
+	 */
+	static
+	const char *
+	getName( const Phase phase );
+
+	/**
+	 * Provides the name of a counter
+	 * @param counter the counter of interest
+	 * @return the name of the counter
+	 */
+	static
+	const char *
+	getName( const Counter counter );
+
+protected:
+
+	//! clock used for timing
+	typedef std::chrono::steady_clock Clock;
+
+	//! the data of a single thread
+	struct ThreadData {
+		//! the accumulated record
+		Record record;
+		//! the currently active phase
+		Phase curPhase;
+		//! the time point when the current phase was (re)started
+		Clock::time_point phaseStart;
+		//! init with PHASE_NONE active
+		ThreadData();
+	};
+
+	//! the profile of a query-target combination
+	struct PairRecord {
+		//! the target id
+		std::string target;
+		//! the query id
+		std::string query;
+		//! the profile
+		Record record;
+	};
+
+	//! whether or not profiling is enabled
+	static bool enabled;
+
+	//! the data of all threads (never deleted to be available at exit)
+	static std::vector< ThreadData* > threadData;
+
+	//! the profiles of all query-target combinations
+	static std::vector< PairRecord > pairRecords;
+
+	/**
+	 * Access to the data of the calling thread, which is registered on first
+	 * access
+	 * @return the data of the calling thread
+	 */
+	static
+	ThreadData &
+	getThreadData();
+
+	/**
+	 * Switches the active phase of the calling thread and accounts the time
+	 * since the last switch to the previously active phase
+	 * @param phase the phase to activate
+	 * @param isCall whether or not the phase is newly entered (and not
+	 *        resumed) such that its call count is to be increased
+	 * @return the previously active phase
+	 */
+	static
+	Phase
+	switchPhase( const Phase phase, const bool isCall );
+
+	/**
+	 * Writes a record in JSON format
+	 * @param out the stream to write to
+	 * @param record the record to write
+	 */
+	static
+	void
+	writeJson( std::ostream & out, const Record & record );
+
+	/**
+	 * Writes a record as CSV columns (starting with separator)
+	 * @param out the stream to write to
+	 * @param record the record to write
+	 */
+	static
+	void
+	writeCsv( std::ostream & out, const Record & record );
+
+};
+
+////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+Profiler::
+isEnabled()
+{
+	return enabled;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+Profiler::
+setEnabled( const bool enabled_ )
+{
+	enabled = enabled_;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+void
+Profiler::
+count( const Counter counter, const size_t value )
+{
+	if (enabled) {
+		getThreadData().record.counter[counter] += value;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+Profiler::Timer::
+Timer( const Phase phase )
+ : parent( enabled ? switchPhase( phase, true ) : PHASE_NUMBER )
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+Profiler::Timer::
+~Timer()
+{
+	if (parent != PHASE_NUMBER) {
+		switchPhase( parent, false );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+
+#endif /* INTARNA_PROFILER_H_ */
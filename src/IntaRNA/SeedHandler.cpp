@@ -11,15 +11,21 @@ bool
 SeedHandler::
 isFeasibleSeedBasePair( const size_t i1, const size_t i2, const bool atEndOfSeed ) const
 {
+	if (i1 >= energy.size1() || i2 >= energy.size2()) {
+		return false;
+	}
+	// use precomputed pairing information if available
+	const bool covered = pairing.covers(i1,i2);
+	// check complementarity (including accessibility)
+	if (!(covered ? pairing.areComplementary(i1,i2) : energy.areComplementary(i1,i2))) {
+		return false;
+	}
+	const bool isGU = covered ? pairing.isGU(i1,i2) : energy.isGU(i1,i2);
 
-	return		i1 < energy.size1() && i2 < energy.size2()
-			&&	energy.isAccessible1(i1)
-			&&	energy.isAccessible2(i2)
-			&&	energy.areComplementary(i1,i2)
-			&&	seedConstraint.getMaxED() >= energy.getED1( i1,i1 )
+	return		seedConstraint.getMaxED() >= energy.getED1( i1,i1 )
 			&&	seedConstraint.getMaxED() >= energy.getED2( i2,i2 )
-			&&  (seedConstraint.isGUallowed() || (!energy.isGU( i1, i2 ))) // check for GU bp constraint
-			&&  (!atEndOfSeed || (seedConstraint.isGUendAllowed() || (!energy.isGU( i1, i2 )))) // check for GU ends
+			&&  (seedConstraint.isGUallowed() || !isGU) // check for GU bp constraint
+			&&  (!atEndOfSeed || (seedConstraint.isGUendAllowed() || !isGU)) // check for GU ends
 			&&	(seedConstraint.getRanges1().empty() || seedConstraint.getRanges1().covers(i1))
 			&&	(seedConstraint.getRanges2().empty() || seedConstraint.getRanges2().covers(i2))
 			;
@@ -3,6 +3,7 @@
 #define INTARNA_SEEDHANDLER_H_
 
 #include "IntaRNA/InteractionEnergy.h"
+#include "IntaRNA/PairingContext.h"
 #include "IntaRNA/SeedConstraint.h"
 
 #include <boost/multi_array.hpp>
@@ -202,6 +203,10 @@ protected:
 	//! the seed constraint to be applied
 	const SeedConstraint & seedConstraint;
 
+	//! precomputed pairing information of the last fillSeed() range to speed
+	//! up isFeasibleSeedBasePair() (empty if not filled by the subclass)
+	PairingContext pairing;
+
 
 
 };
@@ -220,6 +225,7 @@ SeedHandler::SeedHandler(
 	:
 		energy(energy)
 		, seedConstraint(seedConstraint)
+		, pairing()
 {
 }
 
@@ -1,5 +1,6 @@
 
 #include "IntaRNA/SeedHandlerMfe.h"
+#include "IntaRNA/Profiler.h"
 
 namespace IntaRNA {
 
@@ -18,6 +19,10 @@ fillSeed( const size_t i1min, const size_t i1max, const size_t i2min, const size
 #endif
 	// measure timing
 	TIMED_FUNC_IF(timerObj,VLOG_IS_ON(9));
+	Profiler::Timer profileTimer( Profiler::SEED_FILL );
+
+	// precompute pairing information of the range
+	pairing.init( energy, i1min, i1max, i2min, i2max );
 
 	// resize matrizes
 	seed.resize( i1max-i1min+1, i2max-i2min+1 );
@@ -219,6 +224,7 @@ fillSeed( const size_t i1min, const size_t i1max, const size_t i2min, const size
 	{ VLOG(2) <<"valid seeds = "<<seedCountNotInf <<" ("<<(seedCountNotInf/seedCount)<<"% of start index combinations)"; }
 
 	// return final number of valid seeds
+	Profiler::count( Profiler::SEEDS, seedCountNotInf );
 	return seedCountNotInf;
 }
 
@@ -5,6 +5,7 @@
 #include "IntaRNA/InteractionEnergy.h"
 #include "IntaRNA/SeedConstraint.h"
 #include "IntaRNA/SeedHandler.h"
+#include "IntaRNA/NarrowEnergy.h"
 
 #include <boost/multi_array.hpp>
 
@@ -28,7 +29,7 @@ public:
 	//! bpInbetween = the number of base pairs enclosed by left and right base pair, ie. == (bp-2)
 	//! u1/u2 = the number of unpaired positions within the seed,
 	//! using the index [i1][i2][bpInbetween][u1][u2] or a SeedIndex object
-	typedef boost::multi_array<E_type,5> SeedRecMatrix;
+	typedef boost::multi_array<E_storage_type,5> SeedRecMatrix;
 
 	//! defines the seed data {{ i1, i2, bpInbetween, u1, u2 }} to access elements of
 	//! the SeedRecMatrix
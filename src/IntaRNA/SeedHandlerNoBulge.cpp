@@ -1,5 +1,6 @@
 
 #include "IntaRNA/SeedHandlerNoBulge.h"
+#include "IntaRNA/Profiler.h"
 
 namespace IntaRNA {
 
@@ -18,6 +19,10 @@ fillSeed( const size_t i1min, const size_t i1max, const size_t i2min, const size
 #endif
 	// measure timing
 	TIMED_FUNC_IF(timerObj,VLOG_IS_ON(9));
+	Profiler::Timer profileTimer( Profiler::SEED_FILL );
+
+	// precompute pairing information of the range
+	pairing.init( energy, i1min, i1max, i2min, i2max );
 
 	// reset data
 	seedForLeftEnd.clear();
@@ -130,6 +135,7 @@ fillSeed( const size_t i1min, const size_t i1max, const size_t i2min, const size
 	{ VLOG(2) <<"valid seeds = "<<seedForLeftEnd.size(); }
 
 	// get final number of identified seeds
+	Profiler::count( Profiler::SEEDS, seedForLeftEnd.size() );
 	return seedForLeftEnd.size();
 }
 
@@ -14,7 +14,7 @@ namespace IntaRNA {
 /////////////////////////////////////////////////////////////////////
 
 std::ostream *
-newOutputStream( const std::string & out )
+newOutputStream( const std::string & out, const bool append )
 {
 	// check if empty or whitespace string
 	if (boost::regex_match( out, boost::regex(R"(^\s*$)"), boost::match_perl)) {
@@ -40,6 +40,11 @@ newOutputStream( const std::string & out )
 			fopenmode = BOOST_IOS::out | BOOST_IOS::binary;
 		}
 
+		// append to existing file
+		if (append) {
+			fopenmode = fopenmode | BOOST_IOS::app;
+		}
+
 		// register final file
 		fstream->push( bio::file_descriptor_sink( out, fopenmode ) );
 
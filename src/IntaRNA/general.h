@@ -189,12 +189,14 @@ namespace IntaRNA {
  *
  * @param outName the name of the output to open. use STDOUT/STDERR for the
  *        respective output stream or otherwise a filename to be created.
+ * @param append whether or not output is to be appended to an existing file
+ *        instead of overwriting it
  *
  * @return the open output stream, or NULL in error case
  *
  */
 std::ostream *
-newOutputStream( const std::string & outName );
+newOutputStream( const std::string & outName, const bool append = false );
 
 
 /**
@@ -7,6 +7,8 @@
 #include <stdexcept>
 #include <fstream>
 #include <cstdio>
+#include <algorithm>
+#include <unordered_map>
 
 #if INTARNA_MULITHREADING
 	#include <omp.h>
@@ -28,6 +30,7 @@ extern "C" {
 #include "IntaRNA/AccessibilityConstraint.h"
 
 #include "IntaRNA/AccessibilityDisabled.h"
+#include "IntaRNA/AccessibilityFromIndex.h"
 #include "IntaRNA/AccessibilityFromStream.h"
 #include "IntaRNA/AccessibilityVrna.h"
 #include "IntaRNA/AccessibilityBasePair.h"
@@ -69,9 +72,12 @@ extern "C" {
 #include "IntaRNA/OutputStreamHandlerSortedCsv.h"
 
 #include "IntaRNA/OutputHandlerCsv.h"
+#include "IntaRNA/OutputHandlerBinary.h"
 #include "IntaRNA/OutputHandlerEnsemble.h"
 #include "IntaRNA/OutputHandlerText.h"
 
+#include "IntaRNA/Profiler.h"
+
 
 using namespace IntaRNA;
 
@@ -119,6 +125,8 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 	qRegionString(""),
 	qRegion(),
 	qRegionLenMax("qRegionLenMax", 0, 99999, 0),
+	qRegionMaxED("qRegionMaxED", 0.0, 999.0, 999.0),
+	qRegionMaxEDapplied(),
 	qShape(""),
 	qShapeMethod("Zb0.89"),
 	qShapeConversion("Os1.6i-2.29"),
@@ -126,6 +134,8 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 
 	targetArg(""),
 	target(),
+	tIndex(NULL),
+	tIndexRecord(),
 	tIdxPos0("tIdxPos0",-2000000000,2000000000,1),
 	tSet(),
 	tSetString(""),
@@ -139,6 +149,8 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 	tRegionString(""),
 	tRegion(),
 	tRegionLenMax("tRegionLenMax", 0, 99999, 0),
+	tRegionMaxED("tRegionMaxED", 0.0, 999.0, 999.0),
+	tRegionMaxEDapplied(),
 	tShape(""),
 	tShapeMethod("Zb0.89"),
 	tShapeConversion("Os1.6i-2.29"),
@@ -188,6 +200,7 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 	energy("energy","BV",'V'),
 	energyFile(""),
 	energyAdd("energyAdd",-999,+999,0),
+	energyPfShift("energyPfShift",-9999,0,0),
 	energyNoDangles(false),
 
 	accNoLP(false),
@@ -195,7 +208,7 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 
 	out(),
 	outPrefix2streamName(),
-	outMode("outMode", "NDCE", 'N' ),
+	outMode("outMode", "NDCEB", 'N' ),
 	outNumber("outNumber", 0, 1000, 1),
 	outOverlap("outOverlap", "NTQB", 'B' ),
 	outDeltaE("outDeltaE", 0.0, 100.0, 100.0),
@@ -204,15 +217,31 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 	outBestSeedOnly(false),
 	outNoLP(false),
 	outNoGUend(false),
+	outScreening(false),
 	outSep(";"),
 	outCsvCols(outCsvCols_default),
+	outBinaryCompress(false),
 	outPerRegion(false),
 	outPairwise(false),
+	pvalue("pvalue", 0, 100000, 0),
+	pvalueShuffle("pvalueShuffle", "QTB", 'Q'),
+	pvalueSeed("pvalueSeed", 0, 999999999, 0),
+	outFuse(false),
 	outSpotProbSpots(""),
 	outNeedsZall(false),
 	outNeedsBPs(true),
 
 	logFileName(""),
+	profileFileName(""),
+	buildIndexFile(""),
+	serve(false),
+	pairsArg(""),
+	pairs(),
+	checkpointFile(""),
+	resume(false),
+	resumed(false),
+	checkpointed(),
+	checkpointStream(NULL),
 	configFileName(""),
 
 	vrnaHandler(),
@@ -369,12 +398,12 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 	opts_query.add_options()
 		("query,q"
 			, value<std::string>(&queryArg)
-				->required()
 				->notifier(boost::bind(&CommandLineParsing::validate_sequenceArgument,this,"query",_1))
 			, "either an RNA sequence or the stream/file name from where to read"
 				" the query sequences (should be the shorter sequences to increase efficiency);"
 				" use 'STDIN' to read from standard input stream; sequences have to use"
-				" IUPAC nucleotide encoding; output alias is [seq2]")
+				" IUPAC nucleotide encoding; output alias is [seq2];"
+				" mandatory unless --buildIndex is given")
 		;
 	opts_cmdline_short.add(opts_query);
 	opts_query.add_options()
@@ -471,6 +500,17 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 					" (arg in range ["+toString(qRegionLenMax.min)+","+toString(qRegionLenMax.max)+"];"
 					" 0 defaults to no automatic range detection)"
 					).c_str())
+		(qRegionMaxED.name.c_str()
+			, value<E_kcal_type>(&(qRegionMaxED.val))
+				->default_value(qRegionMaxED.def)
+				->notifier(boost::bind(&CommandLineParsing::validate_numberArgument<E_kcal_type>,this,qRegionMaxED,_1))
+			, std::string("interaction site : accessibility pre-filter that restricts the query regions"
+					" to the maximal subregions covered by sites of length '--seedBP' with an ED value"
+					" (in kcal/mol) below or equal to the given bound."
+					" Thus, interaction sites with a higher ED are partially or fully excluded."
+					" (arg in range ["+toString(qRegionMaxED.min)+","+toString(qRegionMaxED.max)+"];"
+					" "+toString(qRegionMaxED.max)+" disables the pre-filter)"
+					).c_str())
 		(qPfScale.name.c_str()
 			, value<double>(&(qPfScale.val))
 				->default_value(qPfScale.def)
@@ -489,7 +529,8 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 			, value<std::string>(&targetArg)
 				->required()
 				->notifier(boost::bind(&CommandLineParsing::validate_sequenceArgument,this,"target",_1))
-				, "either an RNA sequence or the stream/file name from where to read the target sequences (should be the longer sequences to increase efficiency); use 'STDIN' to read from standard input stream; sequences have to use IUPAC nucleotide encoding; output alias is [seq1]")
+				, "either an RNA sequence or the stream/file name from where to read the target sequences (should be the longer sequences to increase efficiency); use 'STDIN' to read from standard input stream; sequences have to use IUPAC nucleotide encoding;"
+					" alternatively the name of an index file created via --buildIndex, which provides the target sequences and their accessibilities without recomputation; output alias is [seq1]")
 		;
 	opts_cmdline_short.add(opts_target);
 	opts_target.add_options()
@@ -586,6 +627,17 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 					" (arg in range ["+toString(tRegionLenMax.min)+","+toString(tRegionLenMax.max)+"];"
 					" 0 defaults to no automatic range detection)"
 					).c_str())
+		(tRegionMaxED.name.c_str()
+			, value<E_kcal_type>(&(tRegionMaxED.val))
+				->default_value(tRegionMaxED.def)
+				->notifier(boost::bind(&CommandLineParsing::validate_numberArgument<E_kcal_type>,this,tRegionMaxED,_1))
+			, std::string("interaction site : accessibility pre-filter that restricts the target regions"
+					" to the maximal subregions covered by sites of length '--seedBP' with an ED value"
+					" (in kcal/mol) below or equal to the given bound."
+					" Thus, interaction sites with a higher ED are partially or fully excluded."
+					" (arg in range ["+toString(tRegionMaxED.min)+","+toString(tRegionMaxED.max)+"];"
+					" "+toString(tRegionMaxED.max)+" disables the pre-filter)"
+					).c_str())
 		(tPfScale.name.c_str()
 			, value<double>(&(tPfScale.val))
 				->default_value(tPfScale.def)
@@ -881,6 +933,18 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 			, std::string("energy computation :"
 					" if provided, this term is added to compute the overall energy of an interaction."
 					" This is useful to incorporate the energy shift of applied accessibility constraints.").c_str())
+		(energyPfShift.name.c_str()
+			, value<E_kcal_type>(&(energyPfShift.val))
+				->default_value(energyPfShift.def)
+				->notifier(boost::bind(&CommandLineParsing::validate_numberArgument<E_kcal_type>,this,energyPfShift,_1))
+			, std::string("partition function computation :"
+					" energy (kcal/mol) used to scale the Boltzmann weights of interactions to avoid partition function overflows"
+					" without the need of a multiprecision build."
+					" If 0, the shift is automatically set to the minimal hybridization energy"
+					" if the partition functions of the given sequences might overflow and no scaling is done otherwise."
+					" A fixed shift should be close to the expected minimal interaction energy."
+					" Reported partition functions (Zall) are scaled by exp(energyPfShift/RT) while energies and probabilities are unaffected"
+					" (arg in range ["+toString(energyPfShift.min)+","+toString(energyPfShift.max)+"])").c_str())
 		(temperature.name.c_str()
 			, value<Z_type>(&(temperature.val))
 				->default_value(temperature.def)
@@ -941,7 +1005,8 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 					"\n 'N' normal output (ASCII char + energy),"
 					"\n 'D' detailed output (ASCII char + energy/position details),"
 					"\n 'C' CSV output (see --outCsvCols),"
-					"\n 'E' ensemble information"
+					"\n 'E' ensemble information,"
+					"\n 'B' binary columnar output of the --outCsvCols columns (convert to CSV via IntaRNAbinary2csv)"
 					).c_str())
 	    ((outNumber.name+",n").c_str()
 			, value<int>(&(outNumber.val))
@@ -994,11 +1059,18 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 				->default_value(outNoGUend)
 				->implicit_value(true)
 			, std::string("if given (or true), no GU inter-molecular base pairs are allowed at interaction ends and interior loops (helix ends)").c_str())
+	    ("outScreening"
+			, value<bool>(&(outScreening))
+				->default_value(outScreening)
+				->implicit_value(true)
+			, std::string("if given (or true), screening mode is used: predictions of a query-target combination stop once --outNumber interactions with E < --outMaxE are found"
+					" and windows or seed extensions are skipped if a lower bound of their interaction energies is not below --outMaxE."
+					" Thus, reported interactions are not necessarily optimal. Ignored if the overall partition function is needed for output.").c_str())
 		("outCsvCols"
 			, value<std::string>(&(outCsvCols))
 				->default_value(outCsvCols,"see text")
 				->notifier(boost::bind(&CommandLineParsing::validate_outCsvCols,this,_1))
-			, std::string("output : comma separated list of CSV column IDs to print if outMode=C."
+			, std::string("output : comma separated list of CSV column IDs to print if outMode=C (or to store if outMode=B)."
 					" Using '*' or an empty argument ('') prints all possible columns from the following available ID list: "
 					+ OutputHandlerCsv::list2string(OutputHandlerCsv::string2list(""),", ")+"."
 					+ "\nDefault = '"+outCsvCols+"'."
@@ -1007,6 +1079,11 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 			, value<std::string>(&(outCsvSort))
 				->notifier(boost::bind(&CommandLineParsing::validate_outCsvSort,this,_1))
 			, std::string("output : column ID from [outCsvCols] to be used for CSV row sorting if outMode=C.").c_str())
+	    ("outBinaryCompress"
+	    		, value<bool>(&outBinaryCompress)
+						->default_value(outBinaryCompress)
+						->implicit_value(true)
+	    		, "output : if given (or true), the row groups of the binary output (outMode=B) are zlib compressed")
 	    ("outPerRegion"
 	    		, value<bool>(&outPerRegion)
 						->default_value(outPerRegion)
@@ -1019,8 +1096,76 @@ CommandLineParsing::CommandLineParsing( const Personality personality  )
 						->implicit_value(true)
 	    		, "output : if given (or true), interactions are only computed for each corresponding query-target pair (same index) "
 	    				"instead of all-vs-all")
+	    (pvalue.name.c_str()
+			, value<int>(&(pvalue.val))
+				->default_value(pvalue.def)
+				->notifier(boost::bind(&CommandLineParsing::validate_numberArgument<int>,this,pvalue,_1))
+			, std::string("output : number of dinucleotide-preserving shuffles used to estimate p-values of the reported interaction energies"
+					" for each query-target combination (0 = disabled)."
+					" The p-values are reported via the CSV columns pvalEmp, pvalGauss and pvalGumbel (added if none is part of --outCsvCols)."
+					" (arg in range ["+toString(pvalue.min)+","+toString(pvalue.max)+"])").c_str())
+	    (pvalueShuffle.name.c_str()
+			, value<char>(&(pvalueShuffle.val))
+				->default_value(pvalueShuffle.def)
+				->notifier(boost::bind(&CommandLineParsing::validate_charArgument,this,pvalueShuffle,_1))
+			, std::string("output : sequences to be shuffled for p-value estimation (see --pvalue) :"
+					"\n 'Q' the query only (target accessibility is reused),"
+					"\n 'T' the target only (query accessibility is reused),"
+					"\n 'B' both sequences").c_str())
+	    (pvalueSeed.name.c_str()
+			, value<int>(&(pvalueSeed.val))
+				->default_value(pvalueSeed.def)
+				->notifier(boost::bind(&CommandLineParsing::validate_numberArgument<int>,this,pvalueSeed,_1))
+			, std::string("output : seed of the random number generator used for the sequence shuffling of --pvalue"
+					" (arg in range ["+toString(pvalueSeed.min)+","+toString(pvalueSeed.max)+"])").c_str())
+	    ("outFuse"
+	    		, value<bool>(&outFuse)
+						->default_value(outFuse)
+						->implicit_value(true)
+	    		, "output : if given (or true), for each reported suboptimal interaction, the mfe interaction is predicted"
+	    				" with its interacting sites blocked. If this constrained mfe overlaps the (unconstrained) mfe interaction in both sequences,"
+	    				" both interactions are compatible and the energy of the fused interaction is reported."
+	    				" Reported via the CSV columns Efuse and hybridDPfuse (added if not part of --outCsvCols).")
 	    ("verbose,v", "verbose output") // handled via easylogging++
 	    ("default-log-file", value<std::string>(&(logFileName)), "file to be used for log output (INFO, WARNING, VERBOSE, DEBUG)")
+	    ("profile", value<std::string>(&(profileFileName))
+	    	, "file to write runtime profiling information to, i.e. the time spent in each phase of the computation and"
+	    		" according counters in total, per thread and per query-target combination."
+	    		" Use STDOUT/STDERR to write to the respective stream."
+	    		" If the file name ends with '.csv', CSV output is produced, JSON otherwise.")
+	    ("buildIndex", value<std::string>(&(buildIndexFile))
+	    	, "file to write a binary index of all target sequences and their accessibilities (ED values) to."
+	    		" No prediction is done and no query is needed."
+	    		" The index can be used via --target for subsequent predictions"
+	    		" to skip sequence parsing and accessibility computation."
+	    		" Note, the ED values are stored for all subsequences up to the maximal interaction length, see --tAccW and --tIntLenMax.")
+	    ("serve"
+	    		, value<bool>(&serve)
+						->default_value(serve)
+						->implicit_value(true)
+	    		, "if given (or true), IntaRNA runs as persistent prediction server:"
+	    			" all parameters, the target sequences and their accessibilities are kept"
+	    			" while the query sequences are read request-wise from STDIN (no --query)."
+	    			" A request is a block of lines, one query sequence per line (optionally preceded by a whitespace-separated id),"
+	    			" terminated by an empty line. The output of each request is terminated by a line '#END'.")
+	    ("pairs", value<std::string>(&pairsArg)
+	    	, "file/stream of the query-target combinations to be predicted instead of all-vs-all"
+	    		" (use 'STDIN' to read from standard input stream)."
+	    		" Each line provides the ids of a target and a query sequence (separated by whitespace or ';');"
+	    		" empty lines and lines starting with '#' are ignored, duplicates are predicted once."
+	    		" The largest combinations are processed first and each accessibility is computed only once"
+	    		" and released as soon as no remaining combination needs it.")
+	    ("checkpoint", value<std::string>(&checkpointFile)
+	    	, "file to record each query-target combination in, once its output is completely written (requires --out to be a file)."
+	    		" Use --resume to continue an interrupted run.")
+	    ("resume"
+	    		, value<bool>(&resume)
+						->default_value(resume)
+						->implicit_value(true)
+	    		, "if given (or true), the query-target combinations recorded in the --checkpoint file are skipped"
+	    			" and the output is appended to the existing --out file, from which incomplete output is removed."
+	    			" Starts from scratch if the checkpoint file does not exist yet."
+	    			" The call has to use the same input and parameters as the interrupted run.")
 	    ;
 
 	////  GENERAL OPTIONS  ////////////////////////////////////
@@ -1060,6 +1205,8 @@ CommandLineParsing::~CommandLineParsing() {
 	INTARNA_CLEANUP(helixConstraint);
 	INTARNA_CLEANUP(seedConstraint);
 	INTARNA_CLEANUP(outStreamHandler);
+	INTARNA_CLEANUP(tIndex);
+	deleteOutputStream(checkpointStream);
 
 }
 
@@ -1201,10 +1348,32 @@ parse(int argc, char** argv)
 			// parsing escape literals
 			outSep = unescaped_string<std::string::const_iterator>::getUnescaped( outSep );
 
+			// check checkpointing
+			std::vector< std::vector< std::string > > checkpointRecords;
+			if (resume && checkpointFile.empty()) {
+				throw error("--resume requires --checkpoint");
+			}
+			if (!checkpointFile.empty()) {
+				const std::string & outName = outPrefix2streamName.at(OutPrefixCode::OP_EMPTY);
+				if (boost::iequals(outName,"STDOUT") || boost::iequals(outName,"STDERR")
+						|| (outName.size()>3 && boost::iequals(outName.substr(outName.size()-3,3),".gz")))
+				{
+					throw error("--checkpoint requires --out to be an uncompressed file");
+				}
+				if (outMode.val == 'B') { throw error("--checkpoint does not support outMode="+toString(outMode.val)); }
+				if (!outCsvSort.empty()) { throw error("--checkpoint does not support --outCsvSort"); }
+				if (isServeMode()) { throw error("--serve does not support --checkpoint"); }
+				if (isBuildIndex()) { throw error("--checkpoint and --buildIndex are mutually exclusive"); }
+				// restore progress of the previous run if needed
+				if (resume) {
+					readCheckpoint( checkpointRecords );
+				}
+			}
+
 			// open output stream
 			{
-				// open according stream
-				std::ostream* outStream = newOutputStream( outPrefix2streamName.at(OutPrefixCode::OP_EMPTY) );
+				// open according stream (continue output of a previous run if needed)
+				std::ostream* outStream = newOutputStream( outPrefix2streamName.at(OutPrefixCode::OP_EMPTY), resumed );
 				// check success
 				if (outStream == NULL) {
 					throw error("could not open output --out='"+toString(outPrefix2streamName.at(OutPrefixCode::OP_EMPTY))+ "' for writing");
@@ -1213,15 +1382,59 @@ parse(int argc, char** argv)
 				outStreamHandler = new OutputStreamHandler(outStream);
 			}
 
+			// enable runtime profiling if requested
+			Profiler::setEnabled( !profileFileName.empty() );
+
 			// parse the sequences
-			parseSequences("query",qId,queryArg,query,qSet,qIdxPos0.val);
-			parseSequences("target",tId,targetArg,target,tSet,tIdxPos0.val);
+			if (!queryArg.empty()) {
+				parseSequences("query",qId,queryArg,query,qSet,qIdxPos0.val);
+			} else if (!isBuildIndex() && !isServeMode()) {
+				throw error("mandatory option 'query' not provided");
+			}
+			if (AccessibilityIndex::isIndexFile(targetArg)) {
+				if (isBuildIndex()) {
+					throw error("--buildIndex requires target sequences but an index was given via --target");
+				}
+				parseTargetIndex();
+			} else {
+				parseSequences("target",tId,targetArg,target,tSet,tIdxPos0.val);
+			}
+
+			// check server mode
+			if (isServeMode()) {
+				if (!queryArg.empty()) { throw error("--serve reads the query sequences from STDIN, i.e. --query is not supported"); }
+				if (isBuildIndex()) { throw error("--serve and --buildIndex are mutually exclusive"); }
+				if (outPairwise) { throw error("--serve does not support --outPairwise"); }
+				if (outMode.val == 'E' || outMode.val == 'B') { throw error("--serve does not support outMode="+toString(outMode.val)); }
+				if (!outCsvSort.empty()) { throw error("--serve does not support --outCsvSort"); }
+				if (vm.count("qAccConstr") > 0) { throw error("--serve does not support --qAccConstr"); }
+				// requests are read from STDIN
+				setStdinUsed();
+			}
 
 			// check if same number if pairwise mode
 			if (outPairwise && query.size() != target.size()) {
 				throw error("--outPairwise requires same number of query and target sequences");
 			}
 
+			// parse explicit list of query-target combinations
+			if (!pairsArg.empty()) {
+				if (outPairwise) { throw error("--pairs and --outPairwise are mutually exclusive"); }
+				if (isServeMode()) { throw error("--serve does not support --pairs"); }
+				if (isBuildIndex()) { throw error("--pairs and --buildIndex are mutually exclusive"); }
+				if (boost::iequals(pairsArg,"STDIN") && !setStdinUsed()) { throw error("--pairs : STDIN already used as input"); }
+				parsePairs();
+			}
+
+			// setup checkpointing (requires parsed sequences)
+			if (!checkpointFile.empty()) {
+				validateCheckpoint( checkpointRecords );
+				checkpointStream = newOutputStream( checkpointFile, resumed );
+				if (checkpointStream == NULL) {
+					throw error("could not open --checkpoint='"+checkpointFile+"' for writing");
+				}
+			}
+
 			// validate accessibility input from file (requires parsed sequences)
 			validate_qAccFile( qAccFile, qSet );
 			validate_tAccFile( tAccFile, tSet );
@@ -1367,7 +1580,7 @@ parse(int argc, char** argv)
 					// report error
 					INTARNA_NOT_IMPLEMENTED("--qAccConstr only supported for single sequence input");
 				}
-			} else {
+			} else if (!query.empty()) {
 				// generate empty constraint
 				qAccConstr = std::string(query.at(0).size(),'.');
 			}
@@ -1463,9 +1676,56 @@ parse(int argc, char** argv)
 				break;
 			}
 
+			// check p-value estimation
+			if (pvalue.val > 0) {
+				if (outMode.val != 'C' && outMode.val != 'B') {
+					throw error("--pvalue requires outMode C or B ("+toString(outMode.val)+")");
+				}
+				// shuffled sequences require accessibility computation
+				if (pvalueShuffle.val != 'Q' && (tIndex != NULL || tAcc.val == 'E' || tAcc.val == 'P')) {
+					throw error("--pvalue : accessibility of shuffled targets can not be read from file or index (use --pvalueShuffle=Q or --tAcc=C)");
+				}
+				if (pvalueShuffle.val != 'T' && (qAcc.val == 'E' || qAcc.val == 'P')) {
+					throw error("--pvalue : accessibility of shuffled queries can not be read from file (use --pvalueShuffle=T or --qAcc=C)");
+				}
+				// ensure p-values are reported
+				const OutputHandlerCsv::ColTypeList csvCols = OutputHandlerCsv::string2list( outCsvCols );
+				if ( std::find( csvCols.begin(), csvCols.end(), OutputHandlerCsv::pvalEmp ) == csvCols.end()
+					&& std::find( csvCols.begin(), csvCols.end(), OutputHandlerCsv::pvalGauss ) == csvCols.end()
+					&& std::find( csvCols.begin(), csvCols.end(), OutputHandlerCsv::pvalGumbel ) == csvCols.end() )
+				{
+					outCsvCols += ",pvalEmp,pvalGauss,pvalGumbel";
+				}
+			}
+
+			// check fusion of suboptimal interactions
+			if (outFuse) {
+				if (outMode.val != 'C' && outMode.val != 'B') {
+					throw error("--outFuse requires outMode C or B ("+toString(outMode.val)+")");
+				}
+				// blocked accessibilities have to be computed
+				if (tIndex != NULL || (tAcc.val != 'N' && tAcc.val != 'C') || (qAcc.val != 'N' && qAcc.val != 'C')) {
+					throw error("--outFuse : accessibility can not be read from file or index (use --tAcc/qAcc=C or N)");
+				}
+				if (energy.val != 'V' && (tAcc.val == 'C' || qAcc.val == 'C')) {
+					throw error("--outFuse : accessibility constraints are only supported for --energy=V (or use --tAcc/qAcc=N)");
+				}
+				// ensure fusions are reported
+				const OutputHandlerCsv::ColTypeList csvCols = OutputHandlerCsv::string2list( outCsvCols );
+				if ( std::find( csvCols.begin(), csvCols.end(), OutputHandlerCsv::Efuse ) == csvCols.end() ) {
+					outCsvCols += ",Efuse";
+				}
+				if ( std::find( csvCols.begin(), csvCols.end(), OutputHandlerCsv::hybridDPfuse ) == csvCols.end() ) {
+					outCsvCols += ",hybridDPfuse";
+				}
+			}
+
 			// check CSV stuff
-			if (outCsvCols != outCsvCols_default && outMode.val != 'C') {
-				throw error("outCsvCols set but outMode != C ("+toString(outMode.val)+")");
+			if (outCsvCols != outCsvCols_default && outMode.val != 'C' && outMode.val != 'B') {
+				throw error("outCsvCols set but outMode != C or B ("+toString(outMode.val)+")");
+			}
+			if (outBinaryCompress && outMode.val != 'B') {
+				throw error("outBinaryCompress set but outMode != B ("+toString(outMode.val)+")");
 			}
 			if (!outCsvSort.empty()) {
 				if (outMode.val != 'C') {
@@ -1862,6 +2122,72 @@ getQueryNumberForTarget( const size_t targetIndex ) const
 
 ////////////////////////////////////////////////////////////////////////////
 
+const std::vector< std::pair< size_t, size_t > > &
+CommandLineParsing::
+getPairs() const
+{
+	checkIfParsed();
+	return pairs;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool
+CommandLineParsing::
+isCheckpointed( const size_t targetNumber, const size_t queryNumber ) const
+{
+	checkIfParsed();
+	return !checkpointed.empty() && checkpointed.count( std::make_pair( targetNumber, queryNumber ) ) > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool
+CommandLineParsing::
+isCheckpointed( const size_t targetNumber ) const
+{
+	checkIfParsed();
+	if (checkpointed.empty()) {
+		return false;
+	}
+	// check if all queries of this target are completed
+	for (size_t i=0; i<getQueryNumberForTarget(targetNumber); i++) {
+		if (!isCheckpointed( targetNumber, getQueryIndexForTarget(i,targetNumber) )) {
+			return false;
+		}
+	}
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+writeCheckpoint( const size_t targetNumber, const size_t queryNumber ) const
+{
+	checkIfParsed();
+	if (checkpointStream == NULL) {
+		return;
+	}
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_outputStreamUpdate)
+#endif
+	{
+		// ensure the output is written before the combination is recorded
+		outStreamHandler->getOutStream().flush();
+		// record combination and the according output size
+		(*checkpointStream)
+			<<(targetNumber+1)
+			<<'\t'<<(queryNumber+1)
+			<<'\t'<<boost::filesystem::file_size( outPrefix2streamName.at(OutPrefixCode::OP_EMPTY) )
+			<<'\t'<<target.at(targetNumber).getId()
+			<<'\t'<<query.at(queryNumber).getId()
+			<<std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 const CommandLineParsing::RnaSequenceVec &
 CommandLineParsing::
 getTargetSequences() const
@@ -1896,6 +2222,8 @@ CommandLineParsing::
 getQueryAccessibility( const size_t sequenceNumber ) const
 {
 	checkIfParsed();
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::ACCESSIBILITY );
 	// input check
 	if (sequenceNumber >= getQuerySequences().size()) {
 		throw std::runtime_error("CommandLineParsing::getQueryAccessibility : sequence number "+toString(sequenceNumber)+" is out of range (<"+toString(getQuerySequences().size())+")");
@@ -1972,11 +2300,19 @@ CommandLineParsing::
 getTargetAccessibility( const size_t sequenceNumber ) const
 {
 	checkIfParsed();
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::ACCESSIBILITY );
 	// input check
 	if (sequenceNumber >= getTargetSequences().size()) {
 		throw std::runtime_error("CommandLineParsing::getTargetAccessibility : sequence number "+toString(sequenceNumber)+" is out of range (<"+toString(getTargetSequences().size())+")");
 	}
 	const RnaSequence& seq = getTargetSequences().at(sequenceNumber);
+
+	// check if precomputed within index
+	if (tIndex != NULL) {
+		return new AccessibilityFromIndex( seq, tIntLenMax.val, *tIndex, tIndexRecord.at(sequenceNumber) );
+	}
+
 	// create temporary constraint object (will be copied)
 	AccessibilityConstraint accConstraint(seq.size(), 0, "","","");
 	try {
@@ -2041,6 +2377,106 @@ getTargetAccessibility( const size_t sequenceNumber ) const
 
 ////////////////////////////////////////////////////////////////////////////
 
+Accessibility*
+CommandLineParsing::
+getShuffledAccessibility( const RnaSequence & seq, const bool isTarget ) const
+{
+	checkIfParsed();
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::ACCESSIBILITY );
+
+	const size_t intLenMax = isTarget ? tIntLenMax.val : qIntLenMax.val;
+	const size_t accW = isTarget ? tAccW.val : qAccW.val;
+
+	// only the maximal base pair span is applicable
+	AccessibilityConstraint accConstraint( seq.size(), isTarget ? tAccL.val : qAccL.val, "", "", "" );
+
+	switch( isTarget ? tAcc.val : qAcc.val ) {
+
+	case 'N' : // no accessibility
+		return new AccessibilityDisabled( seq, intLenMax, &accConstraint );
+
+	case 'C' : // compute accessibilities
+		switch( energy.val ) {
+
+		case 'B' : // base-pair based accessibility
+			return new AccessibilityBasePair(
+								seq
+								, std::min( intLenMax == 0 ? seq.size() : intLenMax
+										, accW == 0 ? seq.size() : accW )
+								, &accConstraint
+								);
+
+		case 'V' : // VRNA-based accessibilities
+			return new AccessibilityVrna(
+								seq
+								, std::min( intLenMax == 0 ? seq.size() : intLenMax
+										, accW == 0 ? seq.size() : accW )
+								, &accConstraint
+								, vrnaHandler
+								, accW
+								, isTarget ? tPfScale.val : qPfScale.val
+								);
+		default :
+			INTARNA_NOT_IMPLEMENTED("accessibility computation not implemented for energy = '"+toString(energy.val)+"'");
+		} break;
+	default :
+		INTARNA_NOT_IMPLEMENTED("CommandLineParsing::getShuffledAccessibility : accessibility of shuffled sequences can not be read from file");
+	}
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Accessibility*
+CommandLineParsing::
+getBlockedAccessibility( const Accessibility & acc, const IndexRange & blocked, const bool isTarget ) const
+{
+	checkIfParsed();
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::ACCESSIBILITY );
+
+	const RnaSequence & seq = acc.getSequence();
+	const AccessibilityConstraint & origConstraint = acc.getAccConstraint();
+
+	// extend the constraint by the blocked region
+	std::string dotBracket( seq.size(), AccessibilityConstraint::dotBracket_unconstrained );
+	for (size_t i=0; i<seq.size(); i++) {
+		if (blocked.from <= i && i <= blocked.to) {
+			dotBracket[i] = AccessibilityConstraint::dotBracket_blocked;
+		} else if (origConstraint.isMarkedBlocked(i)) {
+			dotBracket[i] = AccessibilityConstraint::dotBracket_blocked;
+		} else if (origConstraint.isMarkedAccessible(i)) {
+			dotBracket[i] = AccessibilityConstraint::dotBracket_accessible;
+		} else if (origConstraint.isMarkedPaired(i)) {
+			dotBracket[i] = AccessibilityConstraint::dotBracket_paired;
+		}
+	}
+	const AccessibilityConstraint accConstraint( seq, dotBracket, origConstraint.getMaxBpSpan()
+			, origConstraint.getShapeFile(), origConstraint.getShapeMethod(), origConstraint.getShapeConversion() );
+
+	switch( isTarget ? tAcc.val : qAcc.val ) {
+
+	case 'N' : // no accessibility
+		return new AccessibilityDisabled( seq, isTarget ? tIntLenMax.val : qIntLenMax.val, &accConstraint );
+
+	case 'C' : // derive accessibilities
+		if (energy.val == 'V') {
+			const AccessibilityVrna * accVrna = dynamic_cast< const AccessibilityVrna * >( &acc );
+			if (accVrna != NULL) {
+				return new AccessibilityVrna( seq, *accVrna, blocked, &accConstraint, vrnaHandler );
+			}
+		}
+		INTARNA_NOT_IMPLEMENTED("CommandLineParsing::getBlockedAccessibility : accessibility constraints not supported for energy = '"+toString(energy.val)+"'");
+		break;
+	default :
+		INTARNA_NOT_IMPLEMENTED("CommandLineParsing::getBlockedAccessibility : accessibility with blocked regions can not be read from file");
+	}
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 InteractionEnergy*
 CommandLineParsing::
 getEnergyHandler( const Accessibility& accTarget, const ReverseAccessibility& accQuery ) const
@@ -2050,21 +2486,59 @@ getEnergyHandler( const Accessibility& accTarget, const ReverseAccessibility& ac
 	// check whether to compute ES values (for multi-site predictions)
 	const bool initES = std::string("M").find(model.val) != std::string::npos;
 
+	InteractionEnergy * energyHandler = NULL;
 	switch( energy.val ) {
-	case 'B' : return new InteractionEnergyBasePair( accTarget, accQuery
+	case 'B' : energyHandler = new InteractionEnergyBasePair( accTarget, accQuery
 						, tIntLoopMax.val, qIntLoopMax.val
 						, initES, Z_type(1.0), Ekcal_2_E(-1), 3
 						, Ekcal_2_E(energyAdd.val), !energyNoDangles, !outNoGUend );
-	case 'V' : return new InteractionEnergyVrna( accTarget, accQuery, vrnaHandler, tIntLoopMax.val, qIntLoopMax.val, initES, Ekcal_2_E(energyAdd.val), !energyNoDangles, !outNoGUend );
+				break;
+	case 'V' : energyHandler = new InteractionEnergyVrna( accTarget, accQuery, vrnaHandler, tIntLoopMax.val, qIntLoopMax.val, initES, Ekcal_2_E(energyAdd.val), !energyNoDangles, !outNoGUend );
+				break;
 	default :
 		INTARNA_NOT_IMPLEMENTED("CommandLineParsing::getEnergyHandler : energy = '"+toString(energy.val)+"' is not supported");
 	}
-	return NULL;
+
+	// set partition function scaling
+	if (energyPfShift.val < 0) {
+		energyHandler->setEnsembleShift( Ekcal_2_E(energyPfShift.val) );
+	} else
+	if (needsPartitionFunction()) {
+		// automatic scaling if overflows are possible
+		energyHandler->setEnsembleShift( energyHandler->getEnsembleShiftAuto() );
+		if (energyHandler->getEnsembleShift() != 0) {
+			LOG(INFO) <<"partition function scaling : using energy shift "<<E_2_Ekcal(energyHandler->getEnsembleShift())<<" kcal/mol"
+					<<" for target '"<<accTarget.getSequence().getId()<<"' and query '"<<accQuery.getSequence().getId()<<"'";
+		}
+	}
+
+	return energyHandler;
 
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
+bool
+CommandLineParsing::
+needsPartitionFunction() const
+{
+	// ensemble-based prediction or overall partition function output
+	if (model.val == 'P' || outNeedsZall || outMode.val == 'E') {
+		return true;
+	}
+	// output columns based on partition functions
+	if ((outMode.val == 'C' || outMode.val == 'B') && OutputHandlerCsv::needsZall(OutputHandlerCsv::string2list( outCsvCols ))) {
+		return true;
+	}
+	// probability-based prediction trackers
+	return !outPrefix2streamName.at(OutPrefixCode::OP_tSpotProb).empty()
+		|| !outPrefix2streamName.at(OutPrefixCode::OP_qSpotProb).empty()
+		|| !outPrefix2streamName.at(OutPrefixCode::OP_spotProb).empty()
+		|| !outPrefix2streamName.at(OutPrefixCode::OP_spotProbAll).empty();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 OutputConstraint
 CommandLineParsing::
 getOutputConstraint( const InteractionEnergy & energy )  const
@@ -2089,6 +2563,7 @@ getOutputConstraint( const InteractionEnergy & energy )  const
 			, outNeedsZall
 			, outNeedsBPs
 			, (outMinPu.val>0 ? std::min<E_type>(Accessibility::ED_UPPER_BOUND, energy.getE( outMinPu.val )) : Accessibility::ED_UPPER_BOUND)
+			, outScreening
 			);
 }
 
@@ -2104,6 +2579,9 @@ parseSequences(const std::string & paramName,
 					const long idxPos0 )
 {
 
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::FASTA_PARSING );
+
 	// clear sequence container
 	sequences.clear();
 
@@ -2160,6 +2638,212 @@ parseSequences(const std::string & paramName,
 }
 
 
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+parseTargetIndex()
+{
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::FASTA_PARSING );
+
+	// clear sequence container
+	target.clear();
+	tIndexRecord.clear();
+
+	try {
+		// map index file
+		INTARNA_CLEANUP(tIndex);
+		tIndex = new AccessibilityIndex( targetArg );
+		// setup sequences for all records to be considered
+		for (size_t r=0; r<tIndex->size(); r++) {
+			if (tSet.empty() || tSet.covers(r+1)) {
+				target.push_back( RnaSequence( tId+tIndex->getId(r), tIndex->getSequence(r), tIdxPos0.val, r+1 ) );
+				tIndexRecord.push_back(r);
+			}
+		}
+	} catch (std::exception & ex) {
+		LOG(ERROR) <<"error while parsing target index : "<<ex.what();
+		updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+		return;
+	}
+
+	// inform user about ignored accessibility setup
+	if (tAcc.isSet() || !tAccConstr.empty() || !tShape.empty()) {
+		LOG(INFO) <<"target accessibilities are taken from index '"<<targetArg<<"'; target accessibility parameters are ignored";
+	}
+
+	// ensure at least one sequence was parsed
+	validateSequenceNumber("target", target, 1, 999999)
+	// validate alphabet
+		&& validateSequenceAlphabet("target", target);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+parsePairs()
+{
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::FASTA_PARSING );
+
+	pairs.clear();
+
+	// setup id lookup, which requires unique ids
+	std::unordered_map< std::string, size_t > targetIdx, queryIdx;
+	for (size_t t=0; t<target.size(); t++) {
+		if (!targetIdx.insert( std::make_pair( target.at(t).getId(), t ) ).second) {
+			LOG(ERROR) <<"--pairs requires unique target ids but '"<<target.at(t).getId()<<"' is used more than once";
+			updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+			return;
+		}
+	}
+	for (size_t q=0; q<query.size(); q++) {
+		if (!queryIdx.insert( std::make_pair( query.at(q).getId(), q ) ).second) {
+			LOG(ERROR) <<"--pairs requires unique query ids but '"<<query.at(q).getId()<<"' is used more than once";
+			updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+			return;
+		}
+	}
+
+	// open file handle
+	std::istream * infile = newInputStream( pairsArg );
+	if (infile == NULL) {
+		LOG(ERROR) <<"--pairs : could not open file '"<<pairsArg<<"'";
+		updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+		return;
+	}
+
+	// read linewise
+	std::string line;
+	size_t lineNumber = 0;
+	std::vector< std::string > ids;
+	while( std::getline( *infile, line ) ) {
+		lineNumber++;
+		boost::trim( line );
+		// ignore empty and comment lines
+		if (line.empty() || line.at(0) == '#') {
+			continue;
+		}
+		boost::split( ids, line, boost::is_any_of(" \t;"), boost::token_compress_on );
+		if (ids.size() != 2) {
+			LOG(ERROR) <<"--pairs : line "<<lineNumber<<" does not provide a target and a query id : '"<<line<<"'";
+			updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+			break;
+		}
+		const auto t = targetIdx.find( ids.at(0) );
+		const auto q = queryIdx.find( ids.at(1) );
+		if (t == targetIdx.end() || q == queryIdx.end()) {
+			LOG(ERROR) <<"--pairs : line "<<lineNumber<<" : unknown "
+					<<(t == targetIdx.end() ? "target id '"+ids.at(0) : "query id '"+ids.at(1))<<"'";
+			updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+			break;
+		}
+		pairs.push_back( std::make_pair( t->second, q->second ) );
+	}
+
+	// close stream
+	deleteInputStream( infile );
+
+	// remove duplicates
+	std::sort( pairs.begin(), pairs.end() );
+	pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+
+	if (parsingCode != ReturnCode::STOP_PARSING_ERROR && pairs.empty()) {
+		LOG(ERROR) <<"--pairs : no query-target combination given in '"<<pairsArg<<"'";
+		updateParsingCode( ReturnCode::STOP_PARSING_ERROR );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+readCheckpoint( std::vector< std::vector< std::string > > & records )
+{
+	records.clear();
+	resumed = false;
+
+	// start from scratch if there is no checkpoint yet
+	if (!boost::filesystem::exists( checkpointFile )) {
+		LOG(INFO) <<"--resume : checkpoint '"<<checkpointFile<<"' not found, starting from scratch";
+		return;
+	}
+
+	std::ifstream in( checkpointFile.c_str() );
+	if (!in.good()) {
+		throw std::runtime_error("--resume : could not read checkpoint '"+checkpointFile+"'");
+	}
+
+	// read all completely written records
+	uintmax_t outputSize = 0, checkpointSize = 0;
+	std::string line;
+	while( std::getline( in, line ) ) {
+		// ignore last record if incomplete, i.e. not terminated by a newline
+		if (in.eof()) {
+			break;
+		}
+		checkpointSize += line.size()+1;
+		records.push_back( std::vector< std::string >() );
+		boost::split( records.back(), line, boost::is_any_of("\t") );
+		try {
+			if (records.back().size() != 5) {
+				throw boost::bad_lexical_cast();
+			}
+			outputSize = boost::lexical_cast<uintmax_t>( records.back().at(2) );
+		} catch (boost::bad_lexical_cast & ex) {
+			throw std::runtime_error("--resume : invalid line "+toString(records.size())+" in checkpoint '"+checkpointFile+"'");
+		}
+	}
+
+	in.close();
+	// remove incomplete last record
+	boost::filesystem::resize_file( checkpointFile, checkpointSize );
+
+	// nothing recorded yet
+	if (records.empty()) {
+		return;
+	}
+
+	// remove output of unfinished combinations
+	const std::string & outName = outPrefix2streamName.at(OutPrefixCode::OP_EMPTY);
+	if (!boost::filesystem::exists( outName ) || boost::filesystem::file_size( outName ) < outputSize) {
+		throw std::runtime_error("--resume : output '"+outName+"' of the interrupted run is missing or incomplete");
+	}
+	boost::filesystem::resize_file( outName, outputSize );
+	resumed = true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+validateCheckpoint( const std::vector< std::vector< std::string > > & records )
+{
+	checkpointed.clear();
+	for (size_t r=0; r<records.size(); r++) {
+		// ensure the same input is used as for the interrupted run
+		size_t targetNumber = 0, queryNumber = 0;
+		try {
+			targetNumber = boost::lexical_cast<size_t>( records.at(r).at(0) )-1;
+			queryNumber = boost::lexical_cast<size_t>( records.at(r).at(1) )-1;
+		} catch (boost::bad_lexical_cast & ex) {
+			throw std::runtime_error("--resume : invalid line "+toString(r+1)+" in checkpoint '"+checkpointFile+"'");
+		}
+		if ( targetNumber >= target.size() || query.size() <= queryNumber
+			|| target.at(targetNumber).getId() != records.at(r).at(3)
+			|| query.at(queryNumber).getId() != records.at(r).at(4) )
+		{
+			throw std::runtime_error("--resume : line "+toString(r+1)+" of checkpoint '"+checkpointFile+"' does not match the input sequences");
+		}
+		checkpointed.insert( std::make_pair( targetNumber, queryNumber ) );
+	}
+	if (!checkpointed.empty()) {
+		LOG(INFO) <<"--resume : skipping "<<checkpointed.size()<<" query-target combinations completed according to '"<<checkpointFile<<"'";
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////
 
 void
@@ -2319,9 +3003,9 @@ getTemperature() const {
 
 ////////////////////////////////////////////////////////////////////////////
 
-Predictor*
+PredictionTracker*
 CommandLineParsing::
-getPredictor( const InteractionEnergy & energy, OutputHandler & output ) const
+getPredictionTracker( const InteractionEnergy & energy ) const
 {
 	// set up hub for prediction tracking (if needed)
 	PredictionTrackerHub * predTracker = new PredictionTrackerHub();
@@ -2395,9 +3079,20 @@ getPredictor( const InteractionEnergy & energy, OutputHandler & output ) const
 	if (predTracker->empty()) {
 		// cleanup to avoid overhead
 		 INTARNA_CLEANUP(predTracker);
-		predTracker == NULL;
 	}
 
+	return predTracker;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+Predictor*
+CommandLineParsing::
+getPredictor( const InteractionEnergy & energy, OutputHandler & output, const bool trackPrediction ) const
+{
+	// set up hub for prediction tracking (if needed)
+	PredictionTracker * predTracker = trackPrediction ? getPredictionTracker( energy ) : NULL;
+
 	if (noSeedRequired) {
 		// predictors without seed constraint
 		switch( model.val ) {
@@ -2486,12 +3181,19 @@ void
 CommandLineParsing::
 initOutputHandler()
 {
+	// no initial output if the output of a previous run is continued
+	if (resumed) {
+		return;
+	}
 	// check if initial output needed
 	switch (outMode.val) {
 	case 'C' :
 		outStreamHandler->getOutStream()
 		<<OutputHandlerCsv::getHeader( OutputHandlerCsv::string2list( outCsvCols ), outSep )
 		; break;
+	case 'B' :
+		OutputHandlerBinary::writeHeader( outStreamHandler->getOutStream(), OutputHandlerCsv::string2list( outCsvCols ), outBestSeedOnly );
+		break;
 	}
 
 }
@@ -2520,6 +3222,13 @@ getOutputHandler( const InteractionEnergy & energy ) const
 		outNeedsBPs = OutputHandlerCsv::needBPs(OutputHandlerCsv::string2list( outCsvCols ));;
 		// create output handler
 		return new OutputHandlerCsv( getOutputConstraint(energy), outStreamHandler->getOutStream(), energy, OutputHandlerCsv::string2list( outCsvCols ), outSep, false, outCsvLstSep );
+	case 'B' :
+		// ensure that Zall is computed if needed
+		outNeedsZall = outNeedsZall || OutputHandlerCsv::needsZall(OutputHandlerCsv::string2list( outCsvCols ));
+		// check whether interaction details are needed
+		outNeedsBPs = OutputHandlerCsv::needBPs(OutputHandlerCsv::string2list( outCsvCols ));
+		// create output handler
+		return new OutputHandlerBinary( getOutputConstraint(energy), outStreamHandler->getOutStream(), energy, OutputHandlerCsv::string2list( outCsvCols ), outBinaryCompress );
 	default :
 		INTARNA_NOT_IMPLEMENTED("Output mode "+toString(outMode.val)+" not implemented yet");
 	}
@@ -2637,6 +3346,33 @@ getQueryRanges( const InteractionEnergy & energy, const size_t sequenceNumber, c
 		acc.decomposeByMaxED( qRegion[sequenceNumber], energy.getE( outMinPu.val ), (noSeedRequired ? RnaSequence::lastPos : seedBP.val ) );
 	}
 
+	if (qRegionMaxED.val < qRegionMaxED.max) {
+#if INTARNA_MULITHREADING
+		#pragma omp critical(intarna_omp_regionPrefilter)
+#endif
+		{
+		// apply the pre-filter only once per sequence
+		if (qRegionMaxEDapplied.size() < qRegion.size()) {
+			qRegionMaxEDapplied.resize( qRegion.size(), false );
+		}
+		if (!qRegionMaxEDapplied.at(sequenceNumber)) {
+			qRegionMaxEDapplied[sequenceNumber] = true;
+			// number of positions before pre-filtering
+			size_t positions = 0;
+			for (const IndexRange & r : qRegion.at(sequenceNumber)) {
+				positions += r.to - r.from + 1;
+			}
+			// restrict ranges to subregions covered by accessible (seed) sites
+			const size_t pruned = acc.decomposeByMaxSiteED( qRegion[sequenceNumber], Ekcal_2_E(qRegionMaxED.val), (noSeedRequired ? 1 : seedBP.val ) );
+			Profiler::count( Profiler::PREFILTER_POSITIONS, positions );
+			Profiler::count( Profiler::PREFILTER_PRUNED, pruned );
+			// report statistics
+			LOG(INFO) <<"accessibility pre-filter for query '"<<getQuerySequences().at(sequenceNumber).getId()<<"' : pruned "
+					<<pruned<<" of "<<positions<<" positions ("<<(positions == 0 ? 0 : 100*pruned/positions)<<"%), remaining regions : "<<qRegion.at(sequenceNumber);
+		}
+		} // omp critical(intarna_omp_regionPrefilter)
+	}
+
 	return qRegion.at(sequenceNumber);
 }
 
@@ -2671,6 +3407,33 @@ getTargetRanges( const InteractionEnergy & energy, const size_t sequenceNumber,
 		acc.decomposeByMaxED( tRegion[sequenceNumber], energy.getE( outMinPu.val ), (noSeedRequired ? RnaSequence::lastPos : seedBP.val ) );
 	}
 
+	if (tRegionMaxED.val < tRegionMaxED.max) {
+#if INTARNA_MULITHREADING
+		#pragma omp critical(intarna_omp_regionPrefilter)
+#endif
+		{
+		// apply the pre-filter only once per sequence
+		if (tRegionMaxEDapplied.size() < tRegion.size()) {
+			tRegionMaxEDapplied.resize( tRegion.size(), false );
+		}
+		if (!tRegionMaxEDapplied.at(sequenceNumber)) {
+			tRegionMaxEDapplied[sequenceNumber] = true;
+			// number of positions before pre-filtering
+			size_t positions = 0;
+			for (const IndexRange & r : tRegion.at(sequenceNumber)) {
+				positions += r.to - r.from + 1;
+			}
+			// restrict ranges to subregions covered by accessible (seed) sites
+			const size_t pruned = acc.decomposeByMaxSiteED( tRegion[sequenceNumber], Ekcal_2_E(tRegionMaxED.val), (noSeedRequired ? 1 : seedBP.val ) );
+			Profiler::count( Profiler::PREFILTER_POSITIONS, positions );
+			Profiler::count( Profiler::PREFILTER_PRUNED, pruned );
+			// report statistics
+			LOG(INFO) <<"accessibility pre-filter for target '"<<getTargetSequences().at(sequenceNumber).getId()<<"' : pruned "
+					<<pruned<<" of "<<positions<<" positions ("<<(positions == 0 ? 0 : 100*pruned/positions)<<"%), remaining regions : "<<tRegion.at(sequenceNumber);
+		}
+		} // omp critical(intarna_omp_regionPrefilter)
+	}
+
 	return tRegion.at(sequenceNumber);
 }
 
@@ -2683,6 +3446,9 @@ writeAccessibility( const Accessibility& acc, const std::string & fileOrStream,
 	if (fileOrStream.empty())
 		return;
 
+	// measure timing
+	Profiler::Timer profileTimer( Profiler::OUTPUT_IO );
+
 	// setup output stream
 	std::ostream * out = newOutputStream( fileOrStream );
 	if (out == NULL) {
@@ -2702,6 +3468,134 @@ writeAccessibility( const Accessibility& acc, const std::string & fileOrStream,
 
 ////////////////////////////////////////////////////////////////////////////
 
+void
+CommandLineParsing::
+writeProfile() const
+{
+	if (profileFileName.empty())
+		return;
+
+	// setup output stream
+	std::ostream * out = newOutputStream( profileFileName );
+	if (out == NULL) {
+		throw std::runtime_error("could not open output file '"+profileFileName +"' for profile output");
+	}
+
+	// write data to stream
+	if (boost::iends_with( profileFileName, ".csv" )) {
+		Profiler::writeCsv( *out );
+	} else {
+		Profiler::writeJson( *out );
+	}
+
+	// clean up
+	deleteOutputStream( out );
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+writeTargetIndex() const
+{
+	checkIfParsed();
+	if (!isBuildIndex())
+		return;
+
+	// setup binary output stream
+	std::ofstream out( buildIndexFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+	if (!out.good()) {
+		throw std::runtime_error("could not open output file '"+buildIndexFile +"' for index output");
+	}
+
+	AccessibilityIndex::writeHeader( out );
+	// compute and store accessibility of each target
+	for (size_t t=0; t<getTargetSequences().size(); t++) {
+		VLOG(1) <<"computing accessibility for target '"<<getTargetSequences().at(t).getId()<<"'...";
+		Accessibility * acc = getTargetAccessibility( t );
+		INTARNA_CHECK_NOT_NULL(acc,"target initialization failed");
+		{
+			Profiler::Timer profileTimer( Profiler::OUTPUT_IO );
+			AccessibilityIndex::writeRecord( out, *acc );
+		}
+		INTARNA_CLEANUP(acc);
+	}
+	out.close();
+	if (out.fail()) {
+		throw std::runtime_error("writing index to file '"+buildIndexFile +"' failed");
+	}
+	VLOG(1) <<"index of "<<getTargetSequences().size()<<" target sequences written to '"<<buildIndexFile<<"'";
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool
+CommandLineParsing::
+readServeRequest( std::istream & in )
+{
+	checkIfParsed();
+
+	query.clear();
+	bool requestStarted = false;
+	std::string line;
+	while( std::getline( in, line ) ) {
+		boost::trim( line );
+		// empty line closes a non-empty request
+		if (line.empty()) {
+			if (requestStarted) {
+				break;
+			}
+			continue;
+		}
+		requestStarted = true;
+		// split into optional id and sequence
+		std::vector<std::string> fields;
+		boost::split( fields, line, boost::is_any_of(" \t"), boost::token_compress_on );
+		if (fields.size() > 2 || !RnaSequence::isValidSequenceIUPAC( fields.back() )) {
+			LOG(ERROR) <<"--serve : ignoring invalid request line '"<<line<<"'";
+			continue;
+		}
+		const std::string id = fields.size() == 2 ? fields.front() : (qId.empty() ? "query" : qId);
+		// ensure seed is possible
+		if (!noSeedRequired && fields.back().size() < seedBP.val) {
+			LOG(ERROR) <<"--serve : ignoring query "<<id<<" with length below minimal number of seed base pairs (seedBP="<<seedBP.val<<")";
+			continue;
+		}
+		query.push_back( RnaSequence( id, fields.back(), qIdxPos0.val, query.size()+1 ) );
+	}
+
+	// check if end of input reached
+	if (!requestStarted) {
+		return false;
+	}
+
+	// update query-specific data
+	try {
+		parseRegion( "qRegion", qRegionString, query, qRegion );
+		qRegionMaxEDapplied.clear();
+	} catch (std::exception & ex) {
+		LOG(ERROR) <<"--serve : "<<ex.what()<<" : request ignored";
+		query.clear();
+		qRegion.clear();
+	}
+	// generate empty constraint
+	qAccConstr = query.empty() ? "" : std::string(query.at(0).size(),'.');
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+void
+CommandLineParsing::
+writeServeRequestEnd() const
+{
+	checkIfParsed();
+	outStreamHandler->getOutStream() <<"#END" <<std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 CommandLineParsing::Personality
 CommandLineParsing::
 getPersonality( int argc, char ** argv )
@@ -13,8 +13,10 @@
 
 #include <iostream>
 #include <cstdarg>
+#include <set>
 
 #include "IntaRNA/Accessibility.h"
+#include "IntaRNA/AccessibilityIndex.h"
 #include "IntaRNA/InteractionEnergy.h"
 #include "IntaRNA/HelixConstraint.h"
 #include "IntaRNA/HelixHandler.h"
@@ -177,6 +179,42 @@ public:
 	 */
 	const size_t getQueryIndexForTarget( const size_t i, const size_t targetIndex ) const;
 
+	/**
+	 * Provides the explicit list of query-target combinations to be
+	 * predicted (see --pairs).
+	 * @return the list of (target index, query index) pairs wrt.
+	 *         getTargetSequences() and getQuerySequences() without duplicates;
+	 *         empty if all combinations are to be predicted
+	 */
+	const std::vector< std::pair< size_t, size_t > > & getPairs() const;
+
+	/**
+	 * Whether or not a query-target combination was completed by a previous
+	 * run according to the checkpoint file (see --resume)
+	 * @param targetNumber the index of the target wrt. getTargetSequences()
+	 * @param queryNumber the index of the query wrt. getQuerySequences()
+	 * @return true if the combination is to be skipped; false otherwise
+	 */
+	bool isCheckpointed( const size_t targetNumber, const size_t queryNumber ) const;
+
+	/**
+	 * Whether or not all query-target combinations of a target were completed
+	 * by a previous run according to the checkpoint file (see --resume)
+	 * @param targetNumber the index of the target wrt. getTargetSequences()
+	 * @return true if the target is to be skipped; false otherwise
+	 */
+	bool isCheckpointed( const size_t targetNumber ) const;
+
+	/**
+	 * Records the completion of a query-target combination in the checkpoint
+	 * file (see --checkpoint) after flushing the output, if checkpointing is
+	 * enabled. Has to be called once the output of the combination is complete
+	 * and must not run concurrently with output of other combinations.
+	 * @param targetNumber the index of the target wrt. getTargetSequences()
+	 * @param queryNumber the index of the query wrt. getQuerySequences()
+	 */
+	void writeCheckpoint( const size_t targetNumber, const size_t queryNumber ) const;
+
 	/**
 	 * Parses the target parameter and returns all parsed sequences.
 	 * @return the set of parsed target sequences
@@ -268,11 +306,14 @@ public:
 	 * parameters
 	 * @param energy the interaction energy handler to be used
 	 * @param output the output handler to be used
+	 * @param trackPrediction whether or not the additional prediction output
+	 *        requested via --out prefixes is to be generated
 	 * @return the newly allocated Predictor object to be deleted by the calling
 	 * function
 	 */
 	Predictor* getPredictor( const InteractionEnergy & energy
-			, OutputHandler & output ) const;
+			, OutputHandler & output
+			, const bool trackPrediction = true ) const;
 
 	/**
 	 * Provides the seed constraint according to the user settings
@@ -329,6 +370,121 @@ public:
 	void
 	writeTargetAccessibility( const Accessibility & acc ) const;
 
+	/**
+	 * Writes the runtime profile (phase timings and counters) to file/stream
+	 * if requested via --profile
+	 */
+	void
+	writeProfile() const;
+
+	/**
+	 * Whether or not only a target index is to be built via
+	 * writeTargetIndex() instead of running a prediction
+	 * @return true if --buildIndex was provided; false otherwise
+	 */
+	bool
+	isBuildIndex() const;
+
+	/**
+	 * Computes the accessibility of all target sequences and writes them
+	 * together with the sequences to the file given by --buildIndex.
+	 * The resulting index can be used as target input via --target
+	 * to avoid sequence parsing and accessibility computation.
+	 */
+	void
+	writeTargetIndex() const;
+
+	/**
+	 * Whether or not IntaRNA runs as a persistent prediction server that
+	 * reads the query sequences request-wise from STDIN (see --serve)
+	 * @return true if --serve was provided; false otherwise
+	 */
+	bool
+	isServeMode() const;
+
+	/**
+	 * Reads the next server request from the given stream and replaces the
+	 * query sequences accordingly. A request is a block of non-empty lines
+	 * terminated by an empty line or the end of the stream. Each line
+	 * provides a query sequence, optionally preceded by its id (whitespace
+	 * separated). Invalid lines are reported and ignored.
+	 *
+	 * @param in the stream to read the request from
+	 * @return true if a request was read; false if the stream ended
+	 */
+	bool
+	readServeRequest( std::istream & in );
+
+	/**
+	 * Marks the end of the output of the current server request within the
+	 * output stream and flushes it.
+	 */
+	void
+	writeServeRequestEnd() const;
+
+	/**
+	 * Number of shuffled sequence pairs to be predicted for each query-target
+	 * combination to estimate p-values of the reported interactions
+	 * (see --pvalue)
+	 * @return the number of shuffles or 0 if no p-values are to be estimated
+	 */
+	size_t
+	getPValueSamples() const;
+
+	/**
+	 * Which sequences are to be shuffled for p-value estimation
+	 * @return 'Q' (query), 'T' (target) or 'B' (both)
+	 */
+	char
+	getPValueShuffle() const;
+
+	/**
+	 * Seed of the random number generator used for sequence shuffling
+	 * @return the seed to be used
+	 */
+	unsigned int
+	getPValueSeed() const;
+
+	/**
+	 * Provides a newly allocated accessibility object for a shuffled version
+	 * of a query or target sequence for p-value estimation. Sequence-specific
+	 * accessibility constraints and SHAPE data are not applicable and thus
+	 * ignored.
+	 * @param seq the shuffled sequence (has to exist as long as the returned
+	 *        object)
+	 * @param isTarget whether the target (true) or query (false) accessibility
+	 *        parameters are to be used
+	 * @return the newly allocated Accessibility object to be deleted by the
+	 *        calling function
+	 */
+	Accessibility*
+	getShuffledAccessibility( const RnaSequence & seq, const bool isTarget ) const;
+
+	/**
+	 * Whether or not fusion partners of the reported suboptimal interactions
+	 * are to be computed (see --outFuse)
+	 * @return true if fusion partners are to be computed; false otherwise
+	 */
+	bool
+	isOutFuse() const;
+
+	/**
+	 * Provides a newly allocated accessibility object for a sequence with an
+	 * additionally blocked region, i.e. the region is unpaired and not
+	 * available for interaction. If possible, the ED values are derived
+	 * from the given accessibility data and only the neighborhood of the
+	 * blocked region is recomputed.
+	 * @param acc the accessibility of the unblocked sequence (has to exist as
+	 *        long as the returned object)
+	 * @param blocked the region to be blocked
+	 * @param isTarget whether the target (true) or query (false) accessibility
+	 *        parameters are to be used
+	 * @return the newly allocated Accessibility object to be deleted by the
+	 *        calling function
+	 */
+	Accessibility*
+	getBlockedAccessibility( const Accessibility & acc, const IndexRange & blocked, const bool isTarget ) const;
+
 	/**
 	 * Whether or not output is to be written for each region combination
 	 * @return true if output is to be written for each region combination;
@@ -556,6 +712,12 @@ protected:
 	//! maximal length of automatically detected highly accessible regions for
 	//! for query sequences; if 0, no automatic detection is done
 	NumberParameter<int> qRegionLenMax;
+	//! maximal ED of seed-length sites covering the query regions to be
+	//! considered (accessibility pre-filter); max value disables the filter
+	NumberParameter<E_kcal_type> qRegionMaxED;
+	//! whether or not the accessibility pre-filter was already applied to the
+	//! ranges of the according query sequence
+	mutable std::vector<bool> qRegionMaxEDapplied;
 	//! optional file name that contains structure probing reactivity data for
 	//! the query sequence (e.g. SHAPE data) to guide accessibility prediction
 	std::string qShape;
@@ -572,6 +734,10 @@ protected:
 	std::string targetArg;
 	//! the container holding all target sequences
 	RnaSequenceVec target;
+	//! the index target sequences and accessibilities are read from (or NULL)
+	AccessibilityIndex * tIndex;
+	//! the index record of each target sequence if read from tIndex
+	std::vector<size_t> tIndexRecord;
 	//! the id (prefix) to be used for target naming
 	std::string tId;
 	//! in/output index of pos 0 (of all targets)
@@ -601,6 +767,12 @@ protected:
 	//! maximal length of automatically detected highly accessible regions for
 	//! for target sequences; if 0, no automatic detection is done
 	NumberParameter<int> tRegionLenMax;
+	//! maximal ED of seed-length sites covering the target regions to be
+	//! considered (accessibility pre-filter); max value disables the filter
+	NumberParameter<E_kcal_type> tRegionMaxED;
+	//! whether or not the accessibility pre-filter was already applied to the
+	//! ranges of the according target sequence
+	mutable std::vector<bool> tRegionMaxEDapplied;
 	//! optional file name that contains structure probing reactivity data for
 	//! the target sequence (e.g. SHAPE data) to guide accessibility prediction
 	std::string tShape;
@@ -697,6 +869,9 @@ protected:
 
 	//! the energy shift to be applied
 	NumberParameter<E_kcal_type> energyAdd;
+	//! the energy used to scale partition functions of interactions
+	//! (0 = automatic scaling if needed)
+	NumberParameter<E_kcal_type> energyPfShift;
 	//! whether or not the overall energy covers dangling end contributions
 	bool energyNoDangles;
 
@@ -724,6 +899,8 @@ protected:
 	bool outNoLP;
 	//! whether or not GU base pairs are allowed at interaction and helix ends
 	bool outNoGUend;
+	//! whether or not screening mode is used (early stop and window pruning)
+	bool outScreening;
 	//! the column separator to be used for tabular output
 	std::string outSep;
 	//! the list separator within individual columns of tabular output
@@ -734,6 +911,8 @@ protected:
 	std::string outCsvSort;
 	//! the CSV column selection
 	static const std::string outCsvCols_default;
+	//! whether or not binary output row groups are compressed
+	bool outBinaryCompress;
 	//! whether or not best interaction output should be provided independently
 	//! for all region combinations or only the best for each query-target
 	//! combination
@@ -741,6 +920,14 @@ protected:
 	//! whether or not each query-target combinations should be considered pairwise
 	//! instead of all-vs-all
 	bool outPairwise;
+	//! number of shuffled sequence pairs used for p-value estimation (0 = disabled)
+	NumberParameter<int> pvalue;
+	//! which sequences are shuffled for p-value estimation
+	CharParameter pvalueShuffle;
+	//! seed of the random number generator used for sequence shuffling
+	NumberParameter<int> pvalueSeed;
+	//! whether or not fusion partners of suboptimal interactions are computed
+	bool outFuse;
 	//! for SpotProb output : spots to be tracked
 	std::string outSpotProbSpots;
 	//! whether or not Zall is needed for output generation
@@ -750,6 +937,26 @@ protected:
 
 	//! (optional) file name for log output
 	std::string logFileName;
+	//! (optional) file name for runtime profile output
+	std::string profileFileName;
+	//! (optional) file name to write the target index to (no prediction done)
+	std::string buildIndexFile;
+	//! whether or not to run as persistent prediction server (--serve)
+	bool serve;
+	//! (optional) file/stream of the query-target combinations to predict (--pairs)
+	std::string pairsArg;
+	//! the query-target combinations to predict as (target, query) index pairs
+	std::vector< std::pair< size_t, size_t > > pairs;
+	//! (optional) file to record completed query-target combinations (--checkpoint)
+	std::string checkpointFile;
+	//! whether or not to skip combinations completed according to the checkpoint (--resume)
+	bool resume;
+	//! whether or not the output of a previous run is continued
+	bool resumed;
+	//! the query-target combinations completed by a previous run
+	std::set< std::pair< size_t, size_t > > checkpointed;
+	//! the stream to record completed query-target combinations to
+	std::ostream * checkpointStream;
 	//! (optional) file name for input parameter configuration file
 	std::string configFileName;
 
@@ -1022,6 +1229,36 @@ protected:
 					const IndexRangeList & seqSubset,
 					const long idxPos0 );
 
+	/**
+	 * Reads the target sequences from the index file given by the target
+	 * argument and keeps the index for accessibility access.
+	 */
+	void parseTargetIndex();
+
+	/**
+	 * Reads the list of query-target combinations to be predicted from the
+	 * file/stream given by --pairs. The sequence ids are resolved wrt. the
+	 * parsed target and query sequences.
+	 */
+	void parsePairs();
+
+	/**
+	 * Reads the records of the query-target combinations completed by a
+	 * previous run from the checkpoint file (see --resume) and truncates the
+	 * output file to the size recorded for the last completed combination,
+	 * which removes incomplete output of unfinished combinations.
+	 * @param records to be filled with the fields of each record for
+	 *        validation via validateCheckpoint()
+	 */
+	void readCheckpoint( std::vector< std::vector< std::string > > & records );
+
+	/**
+	 * Checks whether the records read via readCheckpoint() match the parsed
+	 * sequences and marks the according combinations as completed.
+	 * @param records the fields of each record of the checkpoint file
+	 */
+	void validateCheckpoint( const std::vector< std::vector< std::string > > & records );
+
 	/**
 	 * Checks whether or not a sequence container holds a specific number of
 	 * sequences.
@@ -1114,6 +1351,24 @@ protected:
 	 */
 	void writeAccessibility( const Accessibility& acc, const std::string & fileOrStream, const bool writeED ) const;
 
+	/**
+	 * Provides a newly allocated tracker for all additional prediction
+	 * output requested via --out prefixes.
+	 * @param energy the interaction energy handler to be used
+	 * @return the newly allocated tracker to be deleted by the calling
+	 * function or NULL if no tracking is needed
+	 */
+	PredictionTracker* getPredictionTracker( const InteractionEnergy & energy ) const;
+
+	/**
+	 * Checks whether or not partition functions of interactions are to be
+	 * computed, i.e. whether or not the requested prediction model or output
+	 * depends on Boltzmann weights of interactions.
+	 *
+	 * @return true if partition functions are needed; false otherwise
+	 */
+	bool needsPartitionFunction() const;
+
 	/**
 	 * Adds a generic file prefix for input/output files for the given query
 	 * and/or target sequence. Empty strings as well as STDOUT/STDERR are
@@ -1405,8 +1660,8 @@ void CommandLineParsing::validate_outputTarget(
 		// start overwriting and catch if needed
 		bool fileCanNotBeOverwritten = false;
 		try {
-			// open dummy file stream to check if writeable
-			std::ofstream file(value);
+			// open dummy file stream to check if writeable (without truncation)
+			std::ofstream file(value, std::ios::app);
 			if (!file) {
 				fileCanNotBeOverwritten = true;
 			}
@@ -1660,6 +1915,66 @@ reportBestPerRegion() const
 
 ////////////////////////////////////////////////////////////////////////////
 
+inline
+bool
+CommandLineParsing::
+isBuildIndex() const
+{
+	return !buildIndexFile.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+CommandLineParsing::
+isServeMode() const
+{
+	return serve;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+size_t
+CommandLineParsing::
+getPValueSamples() const
+{
+	return (size_t)pvalue.val;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+char
+CommandLineParsing::
+getPValueShuffle() const
+{
+	return pvalueShuffle.val;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+unsigned int
+CommandLineParsing::
+getPValueSeed() const
+{
+	return (unsigned int)pvalueSeed.val;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+inline
+bool
+CommandLineParsing::
+isOutFuse() const
+{
+	return outFuse;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 
 
 
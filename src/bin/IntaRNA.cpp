@@ -6,6 +6,7 @@ INITIALIZE_EASYLOGGINGPP
 
 #include <iostream>
 #include <exception>
+#include <algorithm>
 
 #if INTARNA_MULITHREADING
 	#include <omp.h>
@@ -17,120 +18,422 @@ INITIALIZE_EASYLOGGINGPP
 
 #include "IntaRNA/RnaSequence.h"
 #include "IntaRNA/Accessibility.h"
+#include "IntaRNA/DinucleotideShuffler.h"
 #include "IntaRNA/InteractionEnergy.h"
 #include "IntaRNA/Predictor.h"
 #include "IntaRNA/OutputHandler.h"
 #include "IntaRNA/OutputHandlerInteractionList.h"
+#include "IntaRNA/PValueEstimator.h"
+#include "IntaRNA/Profiler.h"
 
 using namespace IntaRNA;
 
 /////////////////////////////////////////////////////////////////////
 /**
- * program main entry
+ * Estimates the null model for the p-values of the interactions of a
+ * query-target combination from the minimal interaction energies of
+ * dinucleotide-shuffled versions of the sequences (see --pvalue).
+ * The accessibility of a sequence that is not shuffled is reused.
+ * Shuffles without favorable interaction contribute an energy of 0.
  *
- * @param argc number of program arguments
- * @param argv array of program arguments of length argc
+ * @param parameters the parsed call arguments
+ * @param targetAcc the accessibility of the target
+ * @param queryAcc the reversed accessibility of the query
+ * @param targetRanges the target ranges used for prediction if the target
+ *        is not shuffled
+ * @param queryRanges the query ranges used for prediction if the query
+ *        is not shuffled
+ * @param parallelize whether or not the shuffles are to be processed in parallel
+ * @return the p-value estimation based on all shuffles
  */
-int main(int argc, char **argv){
+PValueEstimator
+estimatePValues( const CommandLineParsing & parameters
+				, const Accessibility & targetAcc
+				, const ReverseAccessibility & queryAcc
+				, const IndexRangeList & targetRanges
+				, const IndexRangeList & queryRanges
+				, const bool parallelize )
+{
+	const bool shuffleTarget = parameters.getPValueShuffle() != 'Q';
+	const bool shuffleQuery = parameters.getPValueShuffle() != 'T';
 
-	try {
+	const RnaSequence & targetSeq = targetAcc.getSequence();
+	const RnaSequence & querySeq = queryAcc.getAccessibilityOrigin().getSequence();
 
-		// set overall logging style
-		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::Format, std::string("# %level : %msg"));
-		// default log file setup
-		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToFile, std::string("false"));
-		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToStandardOutput, std::string("true"));
-		// set additional logging flags
-		el::Loggers::addFlag(el::LoggingFlag::DisableApplicationAbortOnFatalLog);
-		el::Loggers::addFlag(el::LoggingFlag::LogDetailedCrashReason);
-		el::Loggers::addFlag(el::LoggingFlag::AllowVerboseIfModuleNotSpecified);
-#if INTARNA_LOG_COLORING
-		el::Loggers::addFlag(el::LoggingFlag::ColoredTerminalOutput);
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_logOutput)
 #endif
+	{ VLOG(1) <<"estimating p-values for target "<<targetSeq.getId()<<" and query "<<querySeq.getId()
+			<<" using "<<parameters.getPValueSamples()<<" shuffles ..."; }
 
-		// setup logging with given parameters
-		START_EASYLOGGINGPP(argc, argv);
+	// setup shuffling once
+	const DinucleotideShuffler targetShuffler( targetSeq.asString() );
+	const DinucleotideShuffler queryShuffler( querySeq.asString() );
 
+	// shuffled sequences are considered in full length
+	IndexRangeList tRanges( targetRanges ), qRanges( queryRanges );
+	if (shuffleTarget) {
+		tRanges = IndexRangeList();
+		tRanges.push_back( IndexRange( 0, targetSeq.size()-1 ) );
+	}
+	if (shuffleQuery) {
+		qRanges = IndexRangeList();
+		qRanges.push_back( IndexRange( 0, querySeq.size()-1 ) );
+	}
 
-		// check if log file set and update all loggers before going on
-		if (el::Helpers::commandLineArgs() != NULL && el::Helpers::commandLineArgs()->hasParamWithValue(el::base::consts::kDefaultLogFileParam))
-		{
-			// default all to file
-			el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToStandardOutput, std::string("false"));
-			el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToFile, std::string("true"));
-			// enforec error out to standard output
-			el::Loggers::reconfigureAllLoggers(el::Level::Error, el::ConfigurationType::ToStandardOutput, std::string("true"));
-			el::Loggers::reconfigureAllLoggers(el::Level::Error, el::ConfigurationType::ToFile, std::string("false"));
-		}
+	// minimal interaction energy of each shuffle
+	std::vector< double > samples( parameters.getPValueSamples(), 0.0 );
 
-		// parse command line parameters
-		CommandLineParsing parameters( CommandLineParsing::getPersonality(argc,argv) );
-		{
-			VLOG(1) <<"parsing arguments"<<"...";
-			int retCode = parameters.parse( argc, argv );
-			if (retCode != CommandLineParsing::ReturnCode::KEEP_GOING) {
-				return retCode;
+#if INTARNA_MULITHREADING
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(samples,threadAborted,exceptionPtrDuringOmp) if(parallelize)
+#endif
+	for (size_t s = 0; s < samples.size(); s++) {
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+#endif
+				// seeding per shuffle to be independent of the thread scheduling
+				std::seed_seq seed{ parameters.getPValueSeed(), (unsigned int)s };
+				DinucleotideShuffler::RandomGenerator rng( seed );
+
+				// shuffle target if needed
+				RnaSequence * shuffledTarget = NULL;
+				Accessibility * shuffledTargetAcc = NULL;
+				if (shuffleTarget) {
+					shuffledTarget = new RnaSequence( targetSeq.getId(), targetShuffler.shuffle( rng ) );
+					shuffledTargetAcc = parameters.getShuffledAccessibility( *shuffledTarget, true );
+					INTARNA_CHECK_NOT_NULL(shuffledTargetAcc,"shuffled target initialization failed");
+				}
+				// shuffle query if needed
+				RnaSequence * shuffledQuery = NULL;
+				Accessibility * shuffledQueryAcc = NULL;
+				ReverseAccessibility * shuffledQueryAccRev = NULL;
+				if (shuffleQuery) {
+					shuffledQuery = new RnaSequence( querySeq.getId(), queryShuffler.shuffle( rng ) );
+					shuffledQueryAcc = parameters.getShuffledAccessibility( *shuffledQuery, false );
+					INTARNA_CHECK_NOT_NULL(shuffledQueryAcc,"shuffled query initialization failed");
+					shuffledQueryAccRev = new ReverseAccessibility( *shuffledQueryAcc );
+				}
+				const Accessibility & curTargetAcc = shuffleTarget ? *shuffledTargetAcc : targetAcc;
+				const ReverseAccessibility & curQueryAcc = shuffleQuery ? *shuffledQueryAccRev : queryAcc;
+
+				// get energy computation handler for both sequences
+				InteractionEnergy * energy = parameters.getEnergyHandler( curTargetAcc, curQueryAcc );
+				INTARNA_CHECK_NOT_NULL(energy,"energy initialization failed");
+
+				// only the energy of the best favorable interaction is needed
+				const OutputConstraint outConstraint = parameters.getOutputConstraint( *energy );
+				OutputHandlerInteractionList best( OutputConstraint( 1, OutputConstraint::OVERLAP_BOTH, E_type(0), E_INF
+							, outConstraint.bestSeedOnly, outConstraint.noLP, outConstraint.noGUend
+							, false, false, outConstraint.maxED, false ), 1 );
+
+				// run prediction for all range combinations without additional output
+				for (const IndexRange & tRange : tRanges) {
+				for (const IndexRange & qRange : qRanges) {
+					Predictor * predictor = parameters.getPredictor( *energy, best, false );
+					INTARNA_CHECK_NOT_NULL(predictor,"predictor initialization failed");
+					{
+						Profiler::Timer profileTimer( Profiler::DP_FILL );
+						predictor->predict( tRange, curQueryAcc.getReversedIndexRange(qRange) );
+					}
+					INTARNA_CLEANUP(predictor);
+				}}
+
+				if (!best.empty()) {
+					samples[s] = E_2_Ekcal( (*best.begin())->energy );
+				}
+
+				// garbage collection
+				INTARNA_CLEANUP(energy);
+				INTARNA_CLEANUP(shuffledQueryAccRev);
+				INTARNA_CLEANUP(shuffledQueryAcc);
+				INTARNA_CLEANUP(shuffledQuery);
+				INTARNA_CLEANUP(shuffledTargetAcc);
+				INTARNA_CLEANUP(shuffledTarget);
+
+#if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
 			}
-		}
+		} // if not threadAborted
+#endif
+	}
+
+#if INTARNA_MULITHREADING
+	// forward exception to the calling thread
+	if (threadAborted) {
+		std::rethrow_exception(exceptionPtrDuringOmp);
+	}
+#endif
+
+	return PValueEstimator( samples );
+}
+
+/////////////////////////////////////////////////////////////////////
+/**
+ * Predicts for each reported suboptimal interaction the optimal interaction
+ * that is compatible with it, i.e. the mfe interaction when the sites of the
+ * suboptimal interaction are blocked in both sequences (see --outFuse).
+ * The fusion partner is only stored if it overlaps the overall mfe interaction
+ * in both sequences, since only in that case the suboptimal interaction is an
+ * alternative site that can be combined with the mfe site.
+ * Since the blocked sites are excluded from the ensemble of the constrained
+ * accessibilities, the sum of both interaction energies equals the energy of
+ * the fused interaction.
+ *
+ * @param parameters the parsed call arguments
+ * @param targetAcc the accessibility of the target
+ * @param queryAcc the reversed accessibility of the query
+ * @param interactions the reported interactions, the first being the mfe
+ * @param targetRanges the target ranges used for prediction
+ * @param queryRanges the query ranges used for prediction
+ * @param parallelize whether or not the interactions are to be processed in parallel
+ * @return the fusion partners indexed by the boundaries of the suboptimal
+ *         interactions
+ */
+OutputHandler::FusionMap
+predictFusions( const CommandLineParsing & parameters
+				, const Accessibility & targetAcc
+				, const ReverseAccessibility & queryAcc
+				, const OutputHandlerInteractionList & interactions
+				, const IndexRangeList & targetRanges
+				, const IndexRangeList & queryRanges
+				, const bool parallelize )
+{
+	OutputHandler::FusionMap fusions;
+
+	// the first interaction is the mfe interaction
+	const std::vector< const Interaction * > subopts( interactions.begin(), interactions.end() );
+	if (subopts.size() < 2) {
+		return fusions;
+	}
+	const Interaction & mfe = *(subopts.front());
+
+#if INTARNA_MULITHREADING
+	#pragma omp critical(intarna_omp_logOutput)
+#endif
+	{ VLOG(1) <<"predicting fusions for "<<(subopts.size()-1)<<" suboptimal interactions of"
+			<<" target "<<targetAcc.getSequence().getId()
+			<<" and query "<<queryAcc.getAccessibilityOrigin().getSequence().getId()<<" ..."; }
+
+#if INTARNA_MULITHREADING
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(fusions,threadAborted,exceptionPtrDuringOmp) if(parallelize)
+#endif
+	for (size_t s = 1; s < subopts.size(); s++) {
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+#endif
+				const Interaction & subopt = *(subopts.at(s));
+
+				// block the sites of the suboptimal interaction
+				Accessibility * blockedTargetAcc = parameters.getBlockedAccessibility( targetAcc
+						, IndexRange( subopt.basePairs.begin()->first, subopt.basePairs.rbegin()->first ), true );
+				INTARNA_CHECK_NOT_NULL(blockedTargetAcc,"blocked target initialization failed");
+				Accessibility * blockedQueryAcc = parameters.getBlockedAccessibility( queryAcc.getAccessibilityOrigin()
+						, IndexRange( subopt.basePairs.rbegin()->second, subopt.basePairs.begin()->second ), false );
+				INTARNA_CHECK_NOT_NULL(blockedQueryAcc,"blocked query initialization failed");
+				ReverseAccessibility * blockedQueryAccRev = new ReverseAccessibility( *blockedQueryAcc );
+
+				// get energy computation handler for both sequences
+				InteractionEnergy * energy = parameters.getEnergyHandler( *blockedTargetAcc, *blockedQueryAccRev );
+				INTARNA_CHECK_NOT_NULL(energy,"energy initialization failed");
+
+				// only the best compatible interaction is needed
+				const OutputConstraint outConstraint = parameters.getOutputConstraint( *energy );
+				OutputHandlerInteractionList best( OutputConstraint( 1, OutputConstraint::OVERLAP_BOTH, outConstraint.maxE, E_INF
+							, outConstraint.bestSeedOnly, outConstraint.noLP, outConstraint.noGUend
+							, false, true, outConstraint.maxED, false ), 1 );
+
+				// run prediction for all range combinations without additional output
+				for (const IndexRange & tRange : targetRanges) {
+				for (const IndexRange & qRange : queryRanges) {
+					Predictor * predictor = parameters.getPredictor( *energy, best, false );
+					INTARNA_CHECK_NOT_NULL(predictor,"predictor initialization failed");
+					{
+						Profiler::Timer profileTimer( Profiler::DP_FILL );
+						predictor->predict( tRange, blockedQueryAccRev->getReversedIndexRange(qRange) );
+					}
+					INTARNA_CLEANUP(predictor);
+				}}
+
+				// store fusion partner if it overlaps the mfe site in both sequences
+				if (!best.empty()) {
+					const Interaction & fusion = **(best.begin());
+					if (   fusion.basePairs.begin()->first <= mfe.basePairs.rbegin()->first
+						&& mfe.basePairs.begin()->first <= fusion.basePairs.rbegin()->first
+						&& fusion.basePairs.rbegin()->second <= mfe.basePairs.begin()->second
+						&& mfe.basePairs.rbegin()->second <= fusion.basePairs.begin()->second )
+					{
+#if INTARNA_MULITHREADING
+						#pragma omp critical(intarna_omp_fusionUpdate)
+#endif
+						{ fusions.insert( OutputHandler::FusionMap::value_type( Interaction::Boundary(
+								  subopt.basePairs.begin()->first, subopt.basePairs.rbegin()->first
+								, subopt.basePairs.begin()->second, subopt.basePairs.rbegin()->second )
+								, fusion ) ); }
+					}
+				}
+
+				// garbage collection
+				INTARNA_CLEANUP(energy);
+				INTARNA_CLEANUP(blockedQueryAccRev);
+				INTARNA_CLEANUP(blockedQueryAcc);
+				INTARNA_CLEANUP(blockedTargetAcc);
+
+#if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
+#endif
+	}
 
 #if INTARNA_MULITHREADING
-		// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
-		bool threadAborted = false;
-		std::exception_ptr exceptionPtrDuringOmp = NULL;
-		std::stringstream exceptionInfoDuringOmp;
+	// forward exception to the calling thread
+	if (threadAborted) {
+		std::rethrow_exception(exceptionPtrDuringOmp);
+	}
 #endif
 
+	return fusions;
+}
+
+/////////////////////////////////////////////////////////////////////
+/**
+ * Predicts the interactions for a single query-target combination and
+ * forwards them to the final output.
+ *
+ * @param parameters the parsed call arguments
+ * @param targetNumber the index of the target sequence
+ * @param targetAcc the accessibility of the target
+ * @param queryNumber the index of the query sequence
+ * @param queryAcc the reversed accessibility of the query
+ * @param parallelizeWindowsLoop whether or not the window combinations are
+ *        to be processed in parallel
+ * @return the number of reported interactions
+ */
+size_t
+predictPair( const CommandLineParsing & parameters
+			, const size_t targetNumber
+			, const Accessibility & targetAcc
+			, const size_t queryNumber
+			, const ReverseAccessibility & queryAcc
+			, const bool parallelizeWindowsLoop )
+{
+	// profile at start of this query-target combination
+	// (all threads if windows are processed in parallel)
+	const Profiler::Record profileStart = parallelizeWindowsLoop ? Profiler::getTotal() : Profiler::getThreadRecord();
+
+	// get energy computation handler for both sequences
+	InteractionEnergy* energy = parameters.getEnergyHandler( targetAcc, queryAcc );
+	INTARNA_CHECK_NOT_NULL(energy,"energy initialization failed");
+
+	// get output/storage handler
+	OutputHandler * output = parameters.getOutputHandler( *energy );
+	INTARNA_CHECK_NOT_NULL(output,"output handler initialization failed");
+
+	// setup collecting output handler to ensure
+	// k-best output per query-target combination
+	// and not per region combination if not requested
+	OutputHandlerInteractionList bestInteractions( parameters.getOutputConstraint(*energy),
+			(parameters.reportBestPerRegion() ? std::numeric_limits<size_t>::max() : 1 )
+				* parameters.getOutputConstraint(*energy).reportMax );
+
+#if INTARNA_MULITHREADING
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+#endif
 
-		// number of already reported interactions to enable IntaRNA v1 separator output
-		size_t reportedInteractions = 0;
+	// run prediction for all range combinations
+	for(const IndexRange & tRange : parameters.getTargetRanges(*energy, targetNumber, targetAcc)) {
+	for(const IndexRange & qRange : parameters.getQueryRanges(*energy, queryNumber, queryAcc.getAccessibilityOrigin())) {
 
-		// storage to avoid accessibility recomputation (init NULL)
-		std::vector< ReverseAccessibility * > queryAcc(parameters.getQuerySequences().size(), NULL);
+		// get windows for both ranges
+		std::vector<IndexRange> queryWindows = qRange.overlappingWindows(parameters.getWindowWidth(), parameters.getWindowOverlap());
+		std::vector<IndexRange> targetWindows = tRange.overlappingWindows(parameters.getWindowWidth(), parameters.getWindowOverlap());
 
-		// compute all query accessibilities to enable parallelization
+		// iterate over all window combinations
 #if INTARNA_MULITHREADING
-		// parallelize this loop if possible; if not -> parallelize the query-loop
-		# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp)
+		// this parallelization should only be enabled if no sequence loop is parallelized
+		# pragma omp parallel for schedule(dynamic) collapse(2) num_threads( parameters.getThreads() ) shared(threadAborted,exceptionPtrDuringOmp,queryWindows,targetWindows, bestInteractions, energy) if(parallelizeWindowsLoop)
 #endif
-		for (size_t qi=0; qi<queryAcc.size(); qi++) {
-			// get accessibility handler
+		for (int qNumWindow = 0; qNumWindow < queryWindows.size(); ++qNumWindow) {
+		for (int tNumWindow = 0; tNumWindow < targetWindows.size(); ++tNumWindow) {
 #if INTARNA_MULITHREADING
 			#pragma omp flush (threadAborted)
 			// explicit try-catch-block due to missing OMP exception forwarding
 			if (!threadAborted) {
 				try {
-					// get query accessibility handler
-					#pragma omp critical(intarna_omp_logOutput)
 #endif
-					VLOG(1) <<"computing accessibility for query '"<<parameters.getQuerySequences().at(qi).getId()<<"'...";
-					Accessibility * queryAccOrig = parameters.getQueryAccessibility(qi);
-					INTARNA_CHECK_NOT_NULL(queryAccOrig,"query initialization failed");
-					// reverse indexing of target sequence for the computation
-					queryAcc[qi] = new ReverseAccessibility(*queryAccOrig);
 
-					// check if we have to warn about ambiguity
-					if (queryAccOrig->getSequence().isAmbiguous()) {
+					IndexRange qWindow = queryWindows.at(qNumWindow);
+					IndexRange tWindow = targetWindows.at(tNumWindow);
 #if INTARNA_MULITHREADING
-						#pragma omp critical(intarna_omp_logOutput)
+					#pragma omp critical(intarna_omp_logOutput)
+#endif
+					{ VLOG(1) <<"predicting interactions for"
+							<<" target "<<targetAcc.getSequence().getId()
+							<<" (range " <<(tWindow+1)<<")"
+							<<" and"
+							<<" query "<<queryAcc.getSequence().getId()
+							<<" (range " <<(qWindow+1)<<")"
+#if INTARNA_MULITHREADING
+#if INTARNA_IN_DEBUG_MODE
+
+							<<" in thread "<<omp_get_thread_num()
+#endif
 #endif
-						VLOG(1) <<"Sequence '"<<queryAccOrig->getSequence().getId()
-								<<"' contains ambiguous nucleotide encodings. These positions are ignored for interaction computation.";
+							<<" ..."; }
+
+					// get interaction prediction handler
+					Predictor * predictor = parameters.getPredictor( *energy, bestInteractions );
+					INTARNA_CHECK_NOT_NULL(predictor,"predictor initialization failed");
+
+					// run prediction for this window combination
+					{
+						Profiler::Timer profileTimer( Profiler::DP_FILL );
+						predictor->predict(	  tWindow
+											, queryAcc.getReversedIndexRange(qWindow)
+											);
 					}
+					// garbage collection
+					INTARNA_CLEANUP(predictor);
 #if INTARNA_MULITHREADING
 				////////////////////// exception handling ///////////////////////////
-				} catch (std::exception & e) {
-					// ensure exception handling for first failed thread only
-					#pragma omp critical(intarna_omp_exception)
-					{
-						if (!threadAborted) {
-							// store exception information
-							exceptionPtrDuringOmp = std::make_exception_ptr(e);
-							exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #query "<<qi <<" : "<<e.what();
-							// trigger abortion of all threads
-							threadAborted = true;
-							#pragma omp flush (threadAborted)
-						}
-					} // omp critical(intarna_omp_exception)
 				} catch (...) {
 					// ensure exception handling for first failed thread only
 					#pragma omp critical(intarna_omp_exception)
@@ -138,7 +441,6 @@ int main(int argc, char **argv){
 						if (!threadAborted) {
 							// store exception information
 							exceptionPtrDuringOmp = std::current_exception();
-							exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #query "<<qi;
 							// trigger abortion of all threads
 							threadAborted = true;
 							#pragma omp flush (threadAborted)
@@ -147,277 +449,653 @@ int main(int argc, char **argv){
 				}
 			} // if not threadAborted
 #endif
-		}
+		}} // window combinations
+	} // target ranges
+	} // query ranges
 
-		// check which loop to parallelize
-		const bool parallelizeTargetLoop = parameters.getTargetSequences().size() > 1;
-		const bool parallelizeQueryLoop = !parallelizeTargetLoop && parameters.getQuerySequences().size() > 1;
-		const bool parallelizeWindowsLoop = !parallelizeTargetLoop && !parallelizeQueryLoop;
+#if INTARNA_MULITHREADING
+	// forward exception to the calling thread
+	if (threadAborted) {
+		INTARNA_CLEANUP(output);
+		INTARNA_CLEANUP(energy);
+		std::rethrow_exception(exceptionPtrDuringOmp);
+	}
+#endif
 
+	// estimate p-values of the reported interactions if needed
+	if (parameters.getPValueSamples() > 0 && !bestInteractions.empty()) {
+		output->setPValueEstimator( estimatePValues( parameters
+				, targetAcc
+				, queryAcc
+				, parameters.getTargetRanges(*energy, targetNumber, targetAcc)
+				, parameters.getQueryRanges(*energy, queryNumber, queryAcc.getAccessibilityOrigin())
+				, parallelizeWindowsLoop ) );
+	}
+	// predict fusions of the reported suboptimal interactions if needed
+	if (parameters.isOutFuse() && !bestInteractions.empty()) {
+		output->setFusions( predictFusions( parameters
+				, targetAcc
+				, queryAcc
+				, bestInteractions
+				, parameters.getTargetRanges(*energy, targetNumber, targetAcc)
+				, parameters.getQueryRanges(*energy, queryNumber, queryAcc.getAccessibilityOrigin())
+				, parallelizeWindowsLoop ) );
+	}
 
-		// run prediction for all pairs of sequences
-		// first: iterate over all target sequences
 #if INTARNA_MULITHREADING
-		// parallelize this loop if possible; if not -> parallelize the query-loop
-		# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp) if(parallelizeTargetLoop)
+	#pragma omp critical(intarna_omp_outputHandlerUpdate)
+#endif
+	{// update final output handler
+		Profiler::Timer profileTimer( Profiler::OUTPUT_FORMATTING );
+		// copy partition function information if available
+		output->incrementZ( bestInteractions.getZ() );
+		// forward all reported interactions for all regions to final output handler
+		for( const Interaction * inter : bestInteractions) {
+			output->add(*inter);
+		}
+	}
+
+	const size_t reported = output->reported();
+	Profiler::count( Profiler::INTERACTIONS, reported );
+
+	// garbage collection
+	{
+		Profiler::Timer profileTimer( Profiler::OUTPUT_IO );
+#if INTARNA_MULITHREADING
+		// ensure no other output is written until this combination is recorded
+		#pragma omp critical(intarna_omp_outputHandlerUpdate)
 #endif
-		for ( size_t targetNumber = 0; targetNumber < parameters.getTargetSequences().size(); ++targetNumber )
 		{
+			INTARNA_CLEANUP(output);
+			// record completion of this combination if needed
+			parameters.writeCheckpoint( targetNumber, queryNumber );
+		}
+	}
+	INTARNA_CLEANUP(energy);
+
+	// store profile of this query-target combination
+	if (Profiler::isEnabled()) {
+		Profiler::Record profile = parallelizeWindowsLoop ? Profiler::getTotal() : Profiler::getThreadRecord();
+		profile -= profileStart;
+		Profiler::addPair( parameters.getTargetSequences().at(targetNumber).getId()
+						, parameters.getQuerySequences().at(queryNumber).getId()
+						, profile );
+	}
+
+	return reported;
+}
+
+/////////////////////////////////////////////////////////////////////
+/**
+ * Predicts the interactions for all query-target combinations and forwards
+ * them to the final output.
+ *
+ * @param parameters the parsed call arguments
+ * @param targetAccStore if not empty, one slot per target sequence to keep its
+ *        accessibility for subsequent calls (NULL slots are computed and
+ *        filled); otherwise all target accessibilities are computed and
+ *        deleted within the call
+ * @return the number of reported interactions
+ */
+size_t
+predictInteractions( const CommandLineParsing & parameters
+					, std::vector< Accessibility * > & targetAccStore )
+{
 #if INTARNA_MULITHREADING
-			#pragma omp flush (threadAborted)
-			// explicit try-catch-block due to missing OMP exception forwarding
-			if (!threadAborted) {
-				try {
-					// get target accessibility handler
-					#pragma omp critical(intarna_omp_logOutput)
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	std::stringstream exceptionInfoDuringOmp;
 #endif
-					{ VLOG(1) <<"computing accessibility for target '"<<parameters.getTargetSequences().at(targetNumber).getId()<<"'..."; }
 
-					// VRNA not completely threadsafe ...
-					Accessibility * targetAcc = parameters.getTargetAccessibility(targetNumber);
-					INTARNA_CHECK_NOT_NULL(targetAcc,"target initialization failed");
 
-					// check if we have to warn about ambiguity
-					if (targetAcc->getSequence().isAmbiguous()) {
+	// number of already reported interactions to enable IntaRNA v1 separator output
+	size_t reportedInteractions = 0;
+
+	// storage to avoid accessibility recomputation (init NULL)
+	std::vector< ReverseAccessibility * > queryAcc(parameters.getQuerySequences().size(), NULL);
+
+	// compute all query accessibilities to enable parallelization
 #if INTARNA_MULITHREADING
-						#pragma omp critical(intarna_omp_logOutput)
+	// parallelize this loop if possible; if not -> parallelize the query-loop
+	# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp)
 #endif
-						{ VLOG(1) <<"Sequence '"<<targetAcc->getSequence().getId()
-								<<"' contains ambiguous IUPAC nucleotide encodings. These positions are ignored for interaction computation and are replaced by 'N'.";}
-					}
+	for (size_t qi=0; qi<queryAcc.size(); qi++) {
+		// get accessibility handler
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+				// get query accessibility handler
+				#pragma omp critical(intarna_omp_logOutput)
+#endif
+				VLOG(1) <<"computing accessibility for query '"<<parameters.getQuerySequences().at(qi).getId()<<"'...";
+				Accessibility * queryAccOrig = parameters.getQueryAccessibility(qi);
+				INTARNA_CHECK_NOT_NULL(queryAccOrig,"query initialization failed");
+				// reverse indexing of target sequence for the computation
+				queryAcc[qi] = new ReverseAccessibility(*queryAccOrig);
 
-					// second: iterate over all query sequences
+				// check if we have to warn about ambiguity
+				if (queryAccOrig->getSequence().isAmbiguous()) {
 #if INTARNA_MULITHREADING
-					// this parallelization should only be enabled if the outer target-loop is not parallelized
-					# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp,targetAcc,targetNumber) if(parallelizeQueryLoop)
+					#pragma omp critical(intarna_omp_logOutput)
 #endif
-					for ( size_t queryIdx = 0; queryIdx < parameters.getQueryNumberForTarget(targetNumber); ++queryIdx )
-					{
-						// get index of this query wrt. getQuerySequence() and queryAcc()
-						const size_t queryNumber = parameters.getQueryIndexForTarget(queryIdx, targetNumber);
+					VLOG(1) <<"Sequence '"<<queryAccOrig->getSequence().getId()
+							<<"' contains ambiguous nucleotide encodings. These positions are ignored for interaction computation.";
+				}
 #if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (std::exception & e) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::make_exception_ptr(e);
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #query "<<qi <<" : "<<e.what();
+						// trigger abortion of all threads
+						threadAborted = true;
 						#pragma omp flush (threadAborted)
-						// explicit try-catch-block due to missing OMP exception forwarding
-						if (!threadAborted) {
-							try {
-#endif
-								// sanity check
-								assert( queryAcc.at(queryNumber) != NULL );
-
-								// get energy computation handler for both sequences
-								InteractionEnergy* energy = parameters.getEnergyHandler( *targetAcc, *(queryAcc.at(queryNumber)) );
-								INTARNA_CHECK_NOT_NULL(energy,"energy initialization failed");
-
-								// get output/storage handler
-								OutputHandler * output = parameters.getOutputHandler( *energy );
-								INTARNA_CHECK_NOT_NULL(output,"output handler initialization failed");
-
-								// setup collecting output handler to ensure
-								// k-best output per query-target combination
-								// and not per region combination if not requested
-								OutputHandlerInteractionList bestInteractions( parameters.getOutputConstraint(*energy),
-										(parameters.reportBestPerRegion() ? std::numeric_limits<size_t>::max() : 1 )
-											* parameters.getOutputConstraint(*energy).reportMax );
-
-								// run prediction for all range combinations
-								for(const IndexRange & tRange : parameters.getTargetRanges(*energy, targetNumber, *targetAcc)) {
-								for(const IndexRange & qRange : parameters.getQueryRanges(*energy, queryNumber, queryAcc.at(queryNumber)->getAccessibilityOrigin())) {
-
-									// get windows for both ranges
-									std::vector<IndexRange> queryWindows = qRange.overlappingWindows(parameters.getWindowWidth(), parameters.getWindowOverlap());
-									std::vector<IndexRange> targetWindows = tRange.overlappingWindows(parameters.getWindowWidth(), parameters.getWindowOverlap());
-
-									// iterate over all window combinations
-#if INTARNA_MULITHREADING
-									// this parallelization should only be enabled if neither the outer target-loop nor the inner query-loop are parallelized
-									# pragma omp parallel for schedule(dynamic) collapse(2) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp,targetAcc,targetNumber,queryWindows,targetWindows, bestInteractions, energy) if(parallelizeWindowsLoop)
-#endif									
-									for (int qNumWindow = 0; qNumWindow < queryWindows.size(); ++qNumWindow) {
-									for (int tNumWindow = 0; tNumWindow < targetWindows.size(); ++tNumWindow) {									
-#if INTARNA_MULITHREADING
-										#pragma omp flush (threadAborted)
-										// explicit try-catch-block due to missing OMP exception forwarding
-										if (!threadAborted) {
-											try {
-#endif										
-										
-												IndexRange qWindow = queryWindows.at(qNumWindow);
-												IndexRange tWindow = targetWindows.at(tNumWindow);
-#if INTARNA_MULITHREADING
-												#pragma omp critical(intarna_omp_logOutput)
-#endif
-												{ VLOG(1) <<"predicting interactions for"
-														<<" target "<<targetAcc->getSequence().getId()
-														<<" (range " <<(tWindow+1)<<")"
-														<<" and"
-														<<" query "<<queryAcc.at(queryNumber)->getSequence().getId()
-														<<" (range " <<(qWindow+1)<<")"
+					}
+				} // omp critical(intarna_omp_exception)
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #query "<<qi;
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
+#endif
+	}
+
+	// check which loop to parallelize
+	const bool parallelizeTargetLoop = parameters.getTargetSequences().size() > 1;
+	const bool parallelizeQueryLoop = !parallelizeTargetLoop && parameters.getQuerySequences().size() > 1;
+	const bool parallelizeWindowsLoop = !parallelizeTargetLoop && !parallelizeQueryLoop;
+
+
+	// run prediction for all pairs of sequences
+	// first: iterate over all target sequences
 #if INTARNA_MULITHREADING
-#if INTARNA_IN_DEBUG_MODE
+	// parallelize this loop if possible; if not -> parallelize the query-loop
+	# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp) if(parallelizeTargetLoop)
+#endif
+	for ( size_t targetNumber = 0; targetNumber < parameters.getTargetSequences().size(); ++targetNumber )
+	{
+		// skip targets completed by a previous run
+		if (parameters.isCheckpointed( targetNumber )) {
+			continue;
+		}
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+				// get target accessibility handler
+				#pragma omp critical(intarna_omp_logOutput)
+#endif
+				{ VLOG(1) <<"computing accessibility for target '"<<parameters.getTargetSequences().at(targetNumber).getId()<<"'..."; }
 
-														<<" in thread "<<omp_get_thread_num()
-#endif
-#endif
-														<<" ..."; }
-		
-												// get interaction prediction handler
-												Predictor * predictor = parameters.getPredictor( *energy, bestInteractions );
-												INTARNA_CHECK_NOT_NULL(predictor,"predictor initialization failed");
-		
-												// run prediction for this window combination
-												predictor->predict(	  tWindow
-																	, queryAcc.at(queryNumber)->getReversedIndexRange(qWindow)
-																	);
-												// garbage collection
-												INTARNA_CLEANUP(predictor);
-#if INTARNA_MULITHREADING
-											////////////////////// exception handling ///////////////////////////
-											} catch (std::exception & e) {
-												// ensure exception handling for first failed thread only
-												#pragma omp critical(intarna_omp_exception)
-												{
-													if (!threadAborted) {
-														// store exception information
-														exceptionPtrDuringOmp = std::make_exception_ptr(e);
-														exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber <<" : "<<e.what();
-														// trigger abortion of all threads
-														threadAborted = true;
-														#pragma omp flush (threadAborted)
-													}
-												} // omp critical(intarna_omp_exception)
-											} catch (...) {
-												// ensure exception handling for first failed thread only
-												#pragma omp critical(intarna_omp_exception)
-												{
-													if (!threadAborted) {
-														// store exception information
-														exceptionPtrDuringOmp = std::current_exception();
-														exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber;
-														// trigger abortion of all threads
-														threadAborted = true;
-														#pragma omp flush (threadAborted)
-													}
-												} // omp critical(intarna_omp_exception)
-											}
-										} // if not threadAborted
-#endif		
-									}} // window combinations
-								} // target ranges
-								} // query ranges
-#if INTARNA_MULITHREADING
-								#pragma omp critical(intarna_omp_outputHandlerUpdate)
-#endif
-								{// update final output handler
-									// copy partition function information if available
-									output->incrementZ( bestInteractions.getZ() );
-									// forward all reported interactions for all regions to final output handler
-									for( const Interaction * inter : bestInteractions) {
-										output->add(*inter);
-									}
-								}
+				// reuse stored target accessibility if available
+				Accessibility * targetAcc = targetAccStore.empty() ? NULL : targetAccStore.at(targetNumber);
+				if (targetAcc == NULL) {
+					// VRNA not completely threadsafe ...
+					targetAcc = parameters.getTargetAccessibility(targetNumber);
+				}
+				INTARNA_CHECK_NOT_NULL(targetAcc,"target initialization failed");
+
+				// check if we have to warn about ambiguity
+				if (targetAcc->getSequence().isAmbiguous()) {
+#if INTARNA_MULITHREADING
+					#pragma omp critical(intarna_omp_logOutput)
+#endif
+					{ VLOG(1) <<"Sequence '"<<targetAcc->getSequence().getId()
+							<<"' contains ambiguous IUPAC nucleotide encodings. These positions are ignored for interaction computation and are replaced by 'N'.";}
+				}
+
+				// second: iterate over all query sequences
+#if INTARNA_MULITHREADING
+				// this parallelization should only be enabled if the outer target-loop is not parallelized
+				# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(queryAcc,reportedInteractions,exceptionPtrDuringOmp,exceptionInfoDuringOmp,targetAcc,targetNumber) if(parallelizeQueryLoop)
+#endif
+				for ( size_t queryIdx = 0; queryIdx < parameters.getQueryNumberForTarget(targetNumber); ++queryIdx )
+				{
+					// get index of this query wrt. getQuerySequence() and queryAcc()
+					const size_t queryNumber = parameters.getQueryIndexForTarget(queryIdx, targetNumber);
+					// skip combinations completed by a previous run
+					if (parameters.isCheckpointed( targetNumber, queryNumber )) {
+						continue;
+					}
+#if INTARNA_MULITHREADING
+					#pragma omp flush (threadAborted)
+					// explicit try-catch-block due to missing OMP exception forwarding
+					if (!threadAborted) {
+						try {
+#endif
+							// sanity check
+							assert( queryAcc.at(queryNumber) != NULL );
+
+							// predict and report interactions of this query-target combination
+							const size_t reported = predictPair( parameters
+									, targetNumber, *targetAcc
+									, queryNumber, *(queryAcc.at(queryNumber))
+									, parallelizeWindowsLoop );
+
+#if INTARNA_MULITHREADING
+							#pragma omp atomic update
+#endif
+							reportedInteractions += reported;
 
 #if INTARNA_MULITHREADING
-								#pragma omp atomic update
-#endif
-								reportedInteractions += output->reported();
-
-								// garbage collection
-								 INTARNA_CLEANUP(output);
-								 INTARNA_CLEANUP(energy);
-
-#if INTARNA_MULITHREADING
-							////////////////////// exception handling ///////////////////////////
-							} catch (std::exception & e) {
-								// ensure exception handling for first failed thread only
-								#pragma omp critical(intarna_omp_exception)
-								{
-									if (!threadAborted) {
-										// store exception information
-										exceptionPtrDuringOmp = std::make_exception_ptr(e);
-										exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber <<" : "<<e.what();
-										// trigger abortion of all threads
-										threadAborted = true;
-										#pragma omp flush (threadAborted)
-									}
-								} // omp critical(intarna_omp_exception)
-							} catch (...) {
-								// ensure exception handling for first failed thread only
-								#pragma omp critical(intarna_omp_exception)
-								{
-									if (!threadAborted) {
-										// store exception information
-										exceptionPtrDuringOmp = std::current_exception();
-										exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber;
-										// trigger abortion of all threads
-										threadAborted = true;
-										#pragma omp flush (threadAborted)
-									}
-								} // omp critical(intarna_omp_exception)
-							}
-						} // if not threadAborted
-#endif
-					} // for queries
+						////////////////////// exception handling ///////////////////////////
+						} catch (std::exception & e) {
+							// ensure exception handling for first failed thread only
+							#pragma omp critical(intarna_omp_exception)
+							{
+								if (!threadAborted) {
+									// store exception information
+									exceptionPtrDuringOmp = std::make_exception_ptr(e);
+									exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber <<" : "<<e.what();
+									// trigger abortion of all threads
+									threadAborted = true;
+									#pragma omp flush (threadAborted)
+								}
+							} // omp critical(intarna_omp_exception)
+						} catch (...) {
+							// ensure exception handling for first failed thread only
+							#pragma omp critical(intarna_omp_exception)
+							{
+								if (!threadAborted) {
+									// store exception information
+									exceptionPtrDuringOmp = std::current_exception();
+									exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber;
+									// trigger abortion of all threads
+									threadAborted = true;
+									#pragma omp flush (threadAborted)
+								}
+							} // omp critical(intarna_omp_exception)
+						}
+					} // if not threadAborted
+#endif
+				} // for queries
 
+				if (targetAccStore.empty()) {
 					// write accessibility to file if needed
 					parameters.writeTargetAccessibility( *targetAcc );
-
 					// garbage collection
 					INTARNA_CLEANUP(targetAcc);
+				} else if (targetAccStore.at(targetNumber) == NULL) {
+					// write accessibility to file if needed
+					parameters.writeTargetAccessibility( *targetAcc );
+					// keep for subsequent calls
+					targetAccStore[targetNumber] = targetAcc;
+				}
 
 #if INTARNA_MULITHREADING
-				////////////////////// exception handling ///////////////////////////
-				} catch (std::exception & e) {
-					// ensure exception handling for first failed thread only
-					#pragma omp critical(intarna_omp_exception)
-					{
-						if (!threadAborted) {
-							// store exception information
-							exceptionPtrDuringOmp = std::make_exception_ptr(e);
-							exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" : "<<e.what();
-							// trigger abortion of all threads
-							threadAborted = true;
-							#pragma omp flush (threadAborted)
-						}
-					} // omp critical(intarna_omp_exception)
+			////////////////////// exception handling ///////////////////////////
+			} catch (std::exception & e) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::make_exception_ptr(e);
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" : "<<e.what();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber;
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
+#endif
+	} // for targets
+
+	// garbage collection
+	for (size_t queryNumber=0; queryNumber < queryAcc.size(); queryNumber++) {
+		// this is a hack to cleanup the original accessibility object
+		Accessibility* queryAccOrig = &(const_cast<Accessibility&>(queryAcc[queryNumber]->getAccessibilityOrigin()) );
+		// write accessibility to file if needed
+		parameters.writeQueryAccessibility( *queryAccOrig );
+		INTARNA_CLEANUP( queryAccOrig );
+		// cleanup (now broken) reverse accessibility object
+		INTARNA_CLEANUP(queryAcc[queryNumber]);
+	}
+
+#if INTARNA_MULITHREADING
+	if (threadAborted) {
+		if (!exceptionInfoDuringOmp.str().empty()) {
+			LOG(WARNING) <<"Exception raised for : "<<exceptionInfoDuringOmp.str();
+		}
+		if (exceptionPtrDuringOmp != NULL) {
+			std::rethrow_exception(exceptionPtrDuringOmp);
+		}
+	}
+#endif
+
+	return reportedInteractions;
+}
+
+/////////////////////////////////////////////////////////////////////
+/**
+ * Predicts the interactions for the explicit list of query-target
+ * combinations given by --pairs and forwards them to the final output.
+ *
+ * The combinations are processed largest first (wrt. the product of the
+ * sequence lengths) to balance the load among the threads. Each accessibility
+ * is computed once on first use and released as soon as no remaining
+ * combination needs it, which bounds the memory consumption.
+ *
+ * @param parameters the parsed call arguments
+ * @return the number of reported interactions
+ */
+size_t
+predictPairs( const CommandLineParsing & parameters )
+{
+	const std::vector< std::pair< size_t, size_t > > & pairs = parameters.getPairs();
+	const CommandLineParsing::RnaSequenceVec & targets = parameters.getTargetSequences();
+	const CommandLineParsing::RnaSequenceVec & queries = parameters.getQuerySequences();
+
+	// schedule largest combinations first (skipping combinations completed by a previous run)
+	std::vector< size_t > schedule;
+	for (size_t p=0; p<pairs.size(); p++) {
+		if (!parameters.isCheckpointed( pairs.at(p).first, pairs.at(p).second )) {
+			schedule.push_back( p );
+		}
+	}
+	std::stable_sort( schedule.begin(), schedule.end(), [&]( const size_t a, const size_t b ) {
+		return targets.at(pairs.at(a).first).size() * queries.at(pairs.at(a).second).size()
+				> targets.at(pairs.at(b).first).size() * queries.at(pairs.at(b).second).size();
+	} );
+
+	// number of remaining combinations per sequence to release accessibilities
+	std::vector< size_t > targetPending( targets.size(), 0 ), queryPending( queries.size(), 0 );
+	for (const size_t p : schedule) {
+		targetPending[pairs.at(p).first]++;
+		queryPending[pairs.at(p).second]++;
+	}
+
+	// accessibilities computed on first use (init NULL)
+	std::vector< Accessibility * > targetAcc( targets.size(), NULL );
+	std::vector< ReverseAccessibility * > queryAcc( queries.size(), NULL );
+
+#if INTARNA_MULITHREADING
+	// one lock per sequence to compute each accessibility only once
+	std::vector< omp_lock_t > targetLock( targets.size() ), queryLock( queries.size() );
+	for (auto & lock : targetLock) { omp_init_lock( &lock ); }
+	for (auto & lock : queryLock) { omp_init_lock( &lock ); }
+
+	// OMP shared variables to enable exception forwarding from within OMP parallelized for loop
+	bool threadAborted = false;
+	std::exception_ptr exceptionPtrDuringOmp = NULL;
+	std::stringstream exceptionInfoDuringOmp;
+#endif
+
+	// number of reported interactions
+	size_t reportedInteractions = 0;
+
+	// windows are only processed in parallel for a single combination
+	const bool parallelizeWindowsLoop = schedule.size() == 1;
+
+#if INTARNA_MULITHREADING
+	# pragma omp parallel for schedule(dynamic) num_threads( parameters.getThreads() ) shared(targetAcc,queryAcc,targetPending,queryPending,targetLock,queryLock,reportedInteractions,threadAborted,exceptionPtrDuringOmp,exceptionInfoDuringOmp) if(!parallelizeWindowsLoop)
+#endif
+	for (size_t p = 0; p < schedule.size(); p++) {
+		const size_t targetNumber = pairs.at(schedule.at(p)).first;
+		const size_t queryNumber = pairs.at(schedule.at(p)).second;
+#if INTARNA_MULITHREADING
+		#pragma omp flush (threadAborted)
+		// explicit try-catch-block due to missing OMP exception forwarding
+		if (!threadAborted) {
+			try {
+				omp_set_lock( &(targetLock[targetNumber]) );
+				try {
+#endif
+					// compute target accessibility on first use
+					if (targetAcc.at(targetNumber) == NULL) {
+#if INTARNA_MULITHREADING
+						#pragma omp critical(intarna_omp_logOutput)
+#endif
+						{ VLOG(1) <<"computing accessibility for target '"<<targets.at(targetNumber).getId()<<"'..."; }
+						Accessibility * acc = parameters.getTargetAccessibility(targetNumber);
+						INTARNA_CHECK_NOT_NULL(acc,"target initialization failed");
+						targetAcc[targetNumber] = acc;
+					}
+#if INTARNA_MULITHREADING
 				} catch (...) {
-					// ensure exception handling for first failed thread only
-					#pragma omp critical(intarna_omp_exception)
-					{
-						if (!threadAborted) {
-							// store exception information
-							exceptionPtrDuringOmp = std::current_exception();
-							exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber;
-							// trigger abortion of all threads
-							threadAborted = true;
-							#pragma omp flush (threadAborted)
-						}
-					} // omp critical(intarna_omp_exception)
+					omp_unset_lock( &(targetLock[targetNumber]) );
+					throw;
 				}
-			} // if not threadAborted
+				omp_unset_lock( &(targetLock[targetNumber]) );
+				omp_set_lock( &(queryLock[queryNumber]) );
+				try {
+#endif
+					// compute query accessibility on first use
+					if (queryAcc.at(queryNumber) == NULL) {
+#if INTARNA_MULITHREADING
+						#pragma omp critical(intarna_omp_logOutput)
+#endif
+						{ VLOG(1) <<"computing accessibility for query '"<<queries.at(queryNumber).getId()<<"'..."; }
+						Accessibility * acc = parameters.getQueryAccessibility(queryNumber);
+						INTARNA_CHECK_NOT_NULL(acc,"query initialization failed");
+						// reverse indexing of query sequence for the computation
+						queryAcc[queryNumber] = new ReverseAccessibility(*acc);
+					}
+#if INTARNA_MULITHREADING
+				} catch (...) {
+					omp_unset_lock( &(queryLock[queryNumber]) );
+					throw;
+				}
+				omp_unset_lock( &(queryLock[queryNumber]) );
+#endif
+
+				// predict and report interactions of this query-target combination
+				const size_t reported = predictPair( parameters
+						, targetNumber, *(targetAcc.at(targetNumber))
+						, queryNumber, *(queryAcc.at(queryNumber))
+						, parallelizeWindowsLoop );
+
+				// check which accessibilities are not needed anymore
+				Accessibility * releaseTargetAcc = NULL;
+				ReverseAccessibility * releaseQueryAcc = NULL;
+#if INTARNA_MULITHREADING
+				#pragma omp critical(intarna_omp_pairsUpdate)
+#endif
+				{
+					reportedInteractions += reported;
+					if (--targetPending[targetNumber] == 0) {
+						std::swap( releaseTargetAcc, targetAcc[targetNumber] );
+					}
+					if (--queryPending[queryNumber] == 0) {
+						std::swap( releaseQueryAcc, queryAcc[queryNumber] );
+					}
+				}
+				// release accessibilities
+				if (releaseTargetAcc != NULL) {
+					// write accessibility to file if needed
+					parameters.writeTargetAccessibility( *releaseTargetAcc );
+					INTARNA_CLEANUP( releaseTargetAcc );
+				}
+				if (releaseQueryAcc != NULL) {
+					// this is a hack to cleanup the original accessibility object
+					Accessibility* queryAccOrig = &(const_cast<Accessibility&>(releaseQueryAcc->getAccessibilityOrigin()) );
+					// write accessibility to file if needed
+					parameters.writeQueryAccessibility( *queryAccOrig );
+					INTARNA_CLEANUP( queryAccOrig );
+					INTARNA_CLEANUP( releaseQueryAcc );
+				}
+
+#if INTARNA_MULITHREADING
+			////////////////////// exception handling ///////////////////////////
+			} catch (std::exception & e) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::make_exception_ptr(e);
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber <<" : "<<e.what();
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			} catch (...) {
+				// ensure exception handling for first failed thread only
+				#pragma omp critical(intarna_omp_exception)
+				{
+					if (!threadAborted) {
+						// store exception information
+						exceptionPtrDuringOmp = std::current_exception();
+						exceptionInfoDuringOmp <<" #thread "<<omp_get_thread_num() <<" #target "<<targetNumber <<" #query " <<queryNumber;
+						// trigger abortion of all threads
+						threadAborted = true;
+						#pragma omp flush (threadAborted)
+					}
+				} // omp critical(intarna_omp_exception)
+			}
+		} // if not threadAborted
 #endif
-		} // for targets
+	}
 
-		// garbage collection
-		for (size_t queryNumber=0; queryNumber < queryAcc.size(); queryNumber++) {
+	// garbage collection of accessibilities left after an abortion
+	for (auto acc = targetAcc.begin(); acc != targetAcc.end(); acc++) {
+		INTARNA_CLEANUP( *acc );
+	}
+	for (auto acc = queryAcc.begin(); acc != queryAcc.end(); acc++) {
+		if (*acc != NULL) {
 			// this is a hack to cleanup the original accessibility object
-			Accessibility* queryAccOrig = &(const_cast<Accessibility&>(queryAcc[queryNumber]->getAccessibilityOrigin()) );
-			// write accessibility to file if needed
-			parameters.writeQueryAccessibility( *queryAccOrig );
+			Accessibility* queryAccOrig = &(const_cast<Accessibility&>((*acc)->getAccessibilityOrigin()) );
 			INTARNA_CLEANUP( queryAccOrig );
-			// cleanup (now broken) reverse accessibility object
-			INTARNA_CLEANUP(queryAcc[queryNumber]);
+			INTARNA_CLEANUP( *acc );
 		}
+	}
 
 #if INTARNA_MULITHREADING
-		if (threadAborted) {
-			if (!exceptionInfoDuringOmp.str().empty()) {
-				LOG(WARNING) <<"Exception raised for : "<<exceptionInfoDuringOmp.str();
+	for (auto & lock : targetLock) { omp_destroy_lock( &lock ); }
+	for (auto & lock : queryLock) { omp_destroy_lock( &lock ); }
+
+	if (threadAborted) {
+		if (!exceptionInfoDuringOmp.str().empty()) {
+			LOG(WARNING) <<"Exception raised for : "<<exceptionInfoDuringOmp.str();
+		}
+		if (exceptionPtrDuringOmp != NULL) {
+			std::rethrow_exception(exceptionPtrDuringOmp);
+		}
+	}
+#endif
+
+	return reportedInteractions;
+}
+
+/////////////////////////////////////////////////////////////////////
+/**
+ * program main entry
+ *
+ * @param argc number of program arguments
+ * @param argv array of program arguments of length argc
+ */
+int main(int argc, char **argv){
+
+	try {
+
+		// set overall logging style
+		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::Format, std::string("# %level : %msg"));
+		// default log file setup
+		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToFile, std::string("false"));
+		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToStandardOutput, std::string("true"));
+		// set additional logging flags
+		el::Loggers::addFlag(el::LoggingFlag::DisableApplicationAbortOnFatalLog);
+		el::Loggers::addFlag(el::LoggingFlag::LogDetailedCrashReason);
+		el::Loggers::addFlag(el::LoggingFlag::AllowVerboseIfModuleNotSpecified);
+#if INTARNA_LOG_COLORING
+		el::Loggers::addFlag(el::LoggingFlag::ColoredTerminalOutput);
+#endif
+
+		// setup logging with given parameters
+		START_EASYLOGGINGPP(argc, argv);
+
+
+		// check if log file set and update all loggers before going on
+		if (el::Helpers::commandLineArgs() != NULL && el::Helpers::commandLineArgs()->hasParamWithValue(el::base::consts::kDefaultLogFileParam))
+		{
+			// default all to file
+			el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToStandardOutput, std::string("false"));
+			el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToFile, std::string("true"));
+			// enforec error out to standard output
+			el::Loggers::reconfigureAllLoggers(el::Level::Error, el::ConfigurationType::ToStandardOutput, std::string("true"));
+			el::Loggers::reconfigureAllLoggers(el::Level::Error, el::ConfigurationType::ToFile, std::string("false"));
+		}
+
+		// parse command line parameters
+		CommandLineParsing parameters( CommandLineParsing::getPersonality(argc,argv) );
+		{
+			VLOG(1) <<"parsing arguments"<<"...";
+			int retCode = parameters.parse( argc, argv );
+			if (retCode != CommandLineParsing::ReturnCode::KEEP_GOING) {
+				return retCode;
 			}
-			if (exceptionPtrDuringOmp != NULL) {
-				std::rethrow_exception(exceptionPtrDuringOmp);
+		}
+
+		// only build target index if requested
+		if (parameters.isBuildIndex()) {
+			parameters.writeTargetIndex();
+			parameters.writeProfile();
+			el::Loggers::flushAll();
+			return 0;
+		}
+
+		if (parameters.isServeMode()) {
+			// keep target accessibilities for all requests
+			std::vector< Accessibility * > targetAccStore( parameters.getTargetSequences().size(), NULL );
+			VLOG(1) <<"waiting for requests on STDIN...";
+			// process requests until end of input
+			while( parameters.readServeRequest( std::cin ) ) {
+				try {
+					predictInteractions( parameters, targetAccStore );
+				} catch (std::exception & e) {
+					// keep server running
+					LOG(ERROR) <<"--serve : request failed : "<<e.what();
+				}
+				parameters.writeServeRequestEnd();
+			}
+			// garbage collection
+			for (auto acc = targetAccStore.begin(); acc != targetAccStore.end(); acc++) {
+				INTARNA_CLEANUP( *acc );
 			}
+		} else if (!parameters.getPairs().empty()) {
+			// predict explicitly given query-target combinations only
+			predictPairs( parameters );
+		} else {
+			// no storage of target accessibilities needed
+			std::vector< Accessibility * > targetAccStore;
+			predictInteractions( parameters, targetAccStore );
 		}
-#endif
+
+		// write runtime profile if requested
+		parameters.writeProfile();
 
 	////////////////////// exception handling ///////////////////////////
 	} catch (std::exception & e) {
@@ -0,0 +1,89 @@
+
+#include "IntaRNA/general.h"
+
+// initialize logging for binary
+INITIALIZE_EASYLOGGINGPP
+
+#include <iostream>
+#include <exception>
+
+#include <boost/program_options.hpp>
+
+#include "IntaRNA/OutputHandlerBinaryReader.h"
+
+using namespace IntaRNA;
+
+/////////////////////////////////////////////////////////////////////
+/**
+ * Converts binary IntaRNA output (--outMode=B) into the respective CSV output.
+ *
+ * @param argc number of program arguments
+ * @param argv array of program arguments of length argc
+ */
+int main(int argc, char **argv){
+
+	namespace po = boost::program_options;
+
+	// set overall logging style
+	el::Loggers::reconfigureAllLoggers(el::ConfigurationType::Format, std::string("# %level : %msg"));
+
+	std::string inName = "STDIN";
+	std::string outName = "STDOUT";
+	std::string outSep = ";";
+
+	po::options_description opts("Converts binary IntaRNA output (--outMode=B) into CSV output.\n\nOptions");
+	opts.add_options()
+		("in,i", po::value<std::string>(&inName)->default_value(inName)
+			, "binary IntaRNA output to read; use 'STDIN' to read from standard input stream")
+		("out,o", po::value<std::string>(&outName)->default_value(outName)
+			, "CSV output file; use 'STDOUT' to write to standard output stream."
+			  " If the file name ends with '.gz', gzip compressed output is written.")
+		("outSep", po::value<std::string>(&outSep)->default_value(outSep)
+			, "column separator to be used in CSV output")
+		("version", "print version")
+		("help,h", "print this help")
+		;
+
+	try {
+		po::variables_map vm;
+		po::store( po::parse_command_line(argc, argv, opts), vm );
+		po::notify(vm);
+
+		if (vm.count("help") > 0) {
+			std::cout <<opts <<std::endl;
+			return 0;
+		}
+		if (vm.count("version") > 0) {
+			std::cout <<INTARNA_PACKAGE_STRING <<"\n";
+			return 0;
+		}
+	} catch (std::exception & e) {
+		LOG(ERROR) <<e.what() <<" : run with '--help' for allowed arguments";
+		return -1;
+	}
+
+	std::istream * in = newInputStream( inName );
+	if (in == NULL) {
+		LOG(ERROR) <<"could not open input '"<<inName<<"'";
+		return -1;
+	}
+	std::ostream * out = newOutputStream( outName );
+	if (out == NULL) {
+		deleteInputStream( in );
+		LOG(ERROR) <<"could not open output '"<<outName<<"'";
+		return -1;
+	}
+
+	int retCode = 0;
+	try {
+		OutputHandlerBinaryReader::convertToCsv( *in, *out, outSep );
+	} catch (std::exception & e) {
+		LOG(ERROR) <<e.what();
+		retCode = -1;
+	}
+
+	deleteOutputStream( out );
+	deleteInputStream( in );
+
+	return retCode;
+}
@@ -61,4 +61,51 @@ TEST_CASE("AccessibilityBasePair", "[AccessibilityBasePair]") {
 	REQUIRE( E_equal( acc.getED(0, 1), 0 ) );
 
   }
+
+  SECTION("ED equals memoized Nussinov recursions") {
+
+	const std::string seqs[] = { "gguccacguccaa"
+			, "GGGAUUACGUACGUGGUUCCAAGUAGCUAGCAGCUAGCUUGACGAUCG"
+			, "ACGUGCAUGCUAGCUGAUCGUAGUCGAUGCUAGCUAGUCGUAGGCAUGC" };
+	for (size_t s=0; s<3; s++) {
+		RnaSequence rna("test", seqs[s]);
+		const size_t N = rna.size();
+		for (size_t minLoop = 0; minLoop < 4; minLoop += 3) {
+			AccessibilityBasePair acc(rna, N, NULL, Ekcal_2_E(-1.0), 1, minLoop);
+
+			// reference
+			const Z_type bpWeight = Z_exp(E_2_Z(-Ekcal_2_E(-1.0)) / 1.0);
+			NussinovHandler::Z2dMatrix Q(N, N), Qb(N, N), Pbp(N, N), Pu(N, N);
+			for (size_t i = 0u; i < N; ++i) {
+				for (size_t j = i; j < N; ++j) {
+					Q(i, j) = Qb(i, j) = Pbp(i, j) = Pu(i, j) = -1.0;
+				}
+			}
+			for (size_t i = 0u; i < N; ++i) {
+				for (size_t j = i; j < N; ++j) {
+					const E_type ed = Z_2_E( -1.0 * Z_log(Z_type(NussinovHandler::getPu(i, j, rna, bpWeight, minLoop, Q, Qb, Pbp, Pu))) );
+					REQUIRE( acc.getED(i, j) == ed );
+				}
+			}
+		}
+	}
+  }
+
+  SECTION("ED with restricted base pair span") {
+
+	// no base pair with span > 9 possible
+	RnaSequence rna("test", "GGGAAAACCCAAAAAAAAAAAAAAAA");
+	AccessibilityBasePair accFull(rna, rna.size(), NULL);
+	AccessibilityBasePair accSpan(rna, rna.size(), NULL, Ekcal_2_E(-1.0), 1, 3, 9);
+	for (size_t i = 0u; i < rna.size(); ++i) {
+		for (size_t j = i; j < rna.size(); ++j) {
+			REQUIRE( accSpan.getED(i, j) == accFull.getED(i, j) );
+		}
+	}
+
+	// span restriction reduces the ensemble
+	AccessibilityBasePair accShort(rna, rna.size(), NULL, Ekcal_2_E(-1.0), 1, 3, 7);
+	REQUIRE( accShort.getED(0, 9) < accFull.getED(0, 9) );
+	REQUIRE( accShort.getED(15, 20) == accFull.getED(15, 20) );
+  }
 }
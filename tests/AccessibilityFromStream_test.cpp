@@ -150,4 +150,95 @@ TEST_CASE( "AccessibilityFromStream", "[AccessibilityFromStream]" ) {
 //		REQUIRE( toString(acc.decomposeByMaxED( 8, 5, 5 )) == "25-29");
 	}
 
+	SECTION("test decomposeByMaxSiteED()") {
+		// prepare stream to read from
+		std::istringstream  accStream(accString);
+		RnaSequence rna("tooLong",seq);
+		// read PU values for fake ED values
+		AccessibilityFromStream acc( rna, 9, NULL, accStream, AccessibilityFromStream::ED_RNAplfold_Text, 1.0 );
+
+		const size_t siteLength = 4;
+		for (E_type maxED : { E_type(0), acc.getED(21,24), acc.getED(10,13), acc.getED(0,3) }) {
+			IndexRangeList ranges;
+			ranges.push_back(IndexRange(2,rna.size()-1));
+			const size_t pruned = acc.decomposeByMaxSiteED( ranges, maxED, siteLength );
+			// check coverage position-wise
+			size_t notCovered = 0;
+			for (size_t p=2; p<rna.size(); p++) {
+				bool coveredBySite = false;
+				for (size_t i=(p+1>=siteLength+2 ? p+1-siteLength : 2); i<=p && i+siteLength<=rna.size(); i++) {
+					coveredBySite = coveredBySite || acc.getED(i,i+siteLength-1) <= maxED;
+				}
+				REQUIRE( ranges.covers(p) == coveredBySite );
+				if (!coveredBySite) notCovered++;
+			}
+			REQUIRE( pruned == notCovered );
+			// decomposition has to be stable
+			IndexRangeList ranges2(ranges);
+			REQUIRE( acc.decomposeByMaxSiteED( ranges2, maxED, siteLength ) == 0 );
+			REQUIRE( toString(ranges2) == toString(ranges) );
+		}
+	}
+
+	SECTION("test decomposeByMaxSiteED() at region boundaries") {
+		// prepare stream to read from
+		std::istringstream  accStream(accString);
+		RnaSequence rna("tooLong",seq);
+		// read PU values for fake ED values
+		AccessibilityFromStream acc( rna, 9, NULL, accStream, AccessibilityFromStream::ED_RNAplfold_Text, 1.0 );
+
+		const size_t siteLength = 4;
+		// input regions : too short for a site, a single site, an inner region
+		// and a region ending at the sequence end
+		IndexRangeList input;
+		input.push_back(IndexRange(0,2));
+		input.push_back(IndexRange(4,7));
+		input.push_back(IndexRange(10,17));
+		input.push_back(IndexRange(21,rna.size()-1));
+
+		// thresholds set to the ED of the sites at region boundaries
+		for (E_type maxED : { acc.getED(4,7), acc.getED(10,13), acc.getED(14,17), acc.getED(21,24), acc.getED(rna.size()-siteLength,rna.size()-1) }) {
+			IndexRangeList ranges(input);
+			const size_t pruned = acc.decomposeByMaxSiteED( ranges, maxED, siteLength );
+			// check coverage position-wise, sites must not cross region boundaries
+			size_t notCovered = 0;
+			for (auto r = input.begin(); r != input.end(); r++) {
+				for (size_t p=r->from; p<=r->to; p++) {
+					bool coveredBySite = false;
+					for (size_t i=(p+1>=r->from+siteLength ? p+1-siteLength : r->from); i<=p && i+siteLength-1<=r->to; i++) {
+						coveredBySite = coveredBySite || acc.getED(i,i+siteLength-1) <= maxED;
+					}
+					REQUIRE( ranges.covers(p) == coveredBySite );
+					if (!coveredBySite) notCovered++;
+				}
+			}
+			REQUIRE( pruned == notCovered );
+			// resulting ranges have to be located within a single input region
+			for (auto r = ranges.begin(); r != ranges.end(); r++) {
+				REQUIRE( r->to-r->from+1 >= siteLength );
+				bool withinInput = false;
+				for (auto in = input.begin(); in != input.end(); in++) {
+					withinInput = withinInput || (in->from <= r->from && r->to <= in->to);
+				}
+				REQUIRE( withinInput );
+			}
+			// the region too short for a site is always removed
+			REQUIRE_FALSE( ranges.covers(0) );
+			REQUIRE_FALSE( ranges.covers(2) );
+			// boundary site with ED equal to the threshold is kept
+			if (maxED == acc.getED(rna.size()-siteLength,rna.size()-1)) {
+				REQUIRE( ranges.covers(rna.size()-1) );
+			}
+			if (maxED == acc.getED(4,7)) {
+				REQUIRE( ranges.covers(4) );
+				REQUIRE( ranges.covers(7) );
+			}
+		}
+
+		// no threshold : nothing is pruned
+		IndexRangeList ranges(input);
+		REQUIRE( acc.decomposeByMaxSiteED( ranges, Accessibility::ED_UPPER_BOUND, siteLength ) == 0 );
+		REQUIRE( toString(ranges) == toString(input) );
+	}
+
 }
@@ -0,0 +1,85 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include <cstdio>
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
+#include "IntaRNA/AccessibilityBasePair.h"
+#include "IntaRNA/AccessibilityFromIndex.h"
+#include "IntaRNA/AccessibilityIndex.h"
+
+using namespace IntaRNA;
+
+
+
+TEST_CASE("AccessibilityIndex", "[AccessibilityIndex]") {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	const std::string fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("intarna-%%%%-%%%%.idx")).string();
+
+	RnaSequence rna1("seq1", "gguccacguccaa");
+	RnaSequence rna2("second", "acguuugcaacgggauuccc");
+	AccessibilityBasePair acc1(rna1, 10, NULL);
+	AccessibilityBasePair acc2(rna2, 0, NULL);
+
+	// write index
+	{
+		std::ofstream out( fileName.c_str(), std::ios::out | std::ios::binary );
+		AccessibilityIndex::writeHeader( out );
+		AccessibilityIndex::writeRecord( out, acc1 );
+		AccessibilityIndex::writeRecord( out, acc2 );
+		out.close();
+		REQUIRE( out.good() );
+	}
+
+	SECTION("index detection") {
+		REQUIRE( AccessibilityIndex::isIndexFile( fileName ) );
+		REQUIRE_FALSE( AccessibilityIndex::isIndexFile( fileName+".missing" ) );
+	}
+
+	SECTION("index content") {
+		AccessibilityIndex index( fileName );
+		REQUIRE( index.size() == 2 );
+		REQUIRE( index.getId(0) == rna1.getId() );
+		REQUIRE( index.getId(1) == rna2.getId() );
+		REQUIRE( index.getSequence(0) == rna1.asString() );
+		REQUIRE( index.getSequence(1) == rna2.asString() );
+		REQUIRE( index.getMaxLength(0) == 10 );
+		REQUIRE( index.getMaxLength(1) == rna2.size() );
+	}
+
+	SECTION("accessibility from index") {
+		AccessibilityIndex index( fileName );
+
+		AccessibilityFromIndex idx1( rna1, 0, index, 0 );
+		REQUIRE( idx1.getMaxLength() == acc1.getMaxLength() );
+		for (size_t i=0; i<rna1.size(); i++) {
+			for (size_t j=i; j<rna1.size() && j-i+1 <= idx1.getMaxLength(); j++) {
+				REQUIRE( idx1.getED(i,j) == acc1.getED(i,j) );
+			}
+		}
+
+		// restricted maximal length
+		AccessibilityFromIndex idx2( rna2, 5, index, 1 );
+		REQUIRE( idx2.getMaxLength() == 5 );
+		for (size_t i=0; i<rna2.size(); i++) {
+			for (size_t j=i; j<rna2.size(); j++) {
+				if (j-i+1 <= 5) {
+					REQUIRE( idx2.getED(i,j) == acc2.getED(i,j) );
+				} else {
+					REQUIRE( idx2.getED(i,j) == Accessibility::ED_UPPER_BOUND );
+				}
+			}
+		}
+	}
+
+	// cleanup
+	std::remove( fileName.c_str() );
+
+}
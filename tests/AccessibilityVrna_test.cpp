@@ -28,4 +28,45 @@ TEST_CASE("AccessibilityVrna", "[AccessibilityVrna]") {
 	REQUIRE( E_equal( acc.getED(0, 1), 0 ) );
 
   }
+
+  SECTION("ED mutant") {
+
+	const std::string seq = "GGGAAACCCAGCUGACUGAGCAUCGAUGCGACGUAGCUAGGGAUCGAUUUUCGAUCGAUCGAUGC";
+	RnaSequence rna("test", seq);
+	VrnaHandler vrnaHandler(37,"Turner04",false,false);
+	const size_t W = 10;
+	AccessibilityVrna acc(rna, W, NULL, vrnaHandler, W);
+
+	for (size_t m : {0, 7, 30, 64}) {
+		std::string mutSeq = seq;
+		mutSeq[m] = (seq.at(m) == 'A' ? 'C' : 'A');
+		RnaSequence mutant("test", mutSeq);
+		AccessibilityVrna accMut( mutant, acc, IndexRange(m,m), &(acc.getAccConstraint()), vrnaHandler );
+		AccessibilityVrna accFull( mutant, W, NULL, vrnaHandler, W );
+		REQUIRE( &(accMut.getSequence()) == &mutant );
+		// incremental update equals full recomputation
+		for (size_t i=0; i<seq.size(); i++) {
+		for (size_t j=i; j<seq.size() && j-i<W; j++) {
+			REQUIRE( std::abs( accMut.getED(i,j) - accFull.getED(i,j) ) <= 1 );
+		}
+		}
+	}
+
+	// additional blocked region
+	const AccessibilityConstraint blocked( rna, "b:20-25", 0, "", "", "" );
+	AccessibilityVrna accBlocked( rna, acc, IndexRange(19,24), &blocked, vrnaHandler );
+	AccessibilityVrna accBlockedFull( rna, W, &blocked, vrnaHandler, W );
+	for (size_t i=0; i<seq.size(); i++) {
+	for (size_t j=i; j<seq.size() && j-i<W; j++) {
+		REQUIRE( std::abs( accBlocked.getED(i,j) - accBlockedFull.getED(i,j) ) <= 1 );
+	}
+	}
+	REQUIRE( accBlocked.getED(18,20) == Accessibility::ED_UPPER_BOUND );
+
+	// invalid mutants
+	RnaSequence shorter("test", seq.substr(1));
+	REQUIRE_THROWS( AccessibilityVrna( shorter, acc, IndexRange(0,0), NULL, vrnaHandler ) );
+	REQUIRE_THROWS( AccessibilityVrna( rna, acc, IndexRange(seq.size(),seq.size()), NULL, vrnaHandler ) );
+
+  }
 }
@@ -0,0 +1,132 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/AccessibilityDisabled.h"
+#include "IntaRNA/BatchPredictor.h"
+#include "IntaRNA/InteractionEnergyBasePair.h"
+#include "IntaRNA/OutputHandlerInteractionList.h"
+#include "IntaRNA/PredictorMfe2dHeuristicSeedExtension.h"
+#include "IntaRNA/ReverseAccessibility.h"
+#include "IntaRNA/SeedHandlerNoBulge.h"
+
+#include <map>
+
+using namespace IntaRNA;
+
+TEST_CASE( "BatchPredictor", "[BatchPredictor]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	VrnaHandler vrnaHandler;
+
+	BatchPredictor::Parameters param;
+	param.energy = 'B';
+	param.tAcc = 'N';
+	param.qAcc = 'N';
+	param.seedBP = 3;
+	param.seedMaxE = 99;
+
+	RnaSequence t("t", "CCAACCCACCGGUACCCAACCC");
+	RnaSequence q1("q1", "GGGGUUGGG");
+	RnaSequence q2("q2", "GGGUUGG");
+
+	SECTION("parameter check") {
+		BatchPredictor::Parameters wrong(param);
+		wrong.energy = 'X';
+		REQUIRE_THROWS( BatchPredictor( wrong, vrnaHandler ) );
+		wrong = param;
+		wrong.noSeed = true;
+		REQUIRE_THROWS( BatchPredictor( wrong, vrnaHandler ) );
+		wrong.model = 'S';
+		REQUIRE_NOTHROW( BatchPredictor( wrong, vrnaHandler ) );
+	}
+
+	SECTION("batch prediction") {
+
+		BatchPredictor batch( param, vrnaHandler );
+
+		std::vector< BatchPredictor::Pair > pairs;
+		pairs.push_back( BatchPredictor::Pair( t, q1 ) );
+		pairs.push_back( BatchPredictor::Pair( t, q2 ) );
+
+		std::map< size_t, E_type > mfe;
+		const BatchPredictor::Callback callback = [&]( const size_t pairIndex, const Interaction & i, const InteractionEnergy & energy ) {
+			REQUIRE( pairIndex < pairs.size() );
+			REQUIRE( i.s1->getId() == "t" );
+			REQUIRE( i.s2->getId() == pairs.at(pairIndex).query.getId() );
+			REQUIRE( mfe.find(pairIndex) == mfe.end() );
+			mfe[pairIndex] = i.energy;
+		};
+
+		REQUIRE( batch.predict( pairs, callback ) == 2 );
+		// one target and two queries
+		REQUIRE( batch.getCacheSize() == 3 );
+
+		// compare to explicit prediction
+		for (size_t p=0; p<pairs.size(); p++) {
+			AccessibilityDisabled acc1( pairs[p].target, 0, NULL );
+			AccessibilityDisabled acc2( pairs[p].query, 0, NULL );
+			ReverseAccessibility racc( acc2 );
+			InteractionEnergyBasePair energy( acc1, racc );
+			SeedConstraint sC( 3, 0, 0, 0, Ekcal_2_E(99), AccessibilityDisabled::ED_UPPER_BOUND, Ekcal_2_E(999), IndexRangeList(""), IndexRangeList(""), "", false, false, false );
+			OutputConstraint outC;
+			OutputHandlerInteractionList out( outC, 1 );
+			PredictorMfe2dHeuristicSeedExtension predictor( energy, out, NULL, new SeedHandlerNoBulge( energy, sC ) );
+			predictor.predict( IndexRange(0,acc1.getSequence().size()-1), racc.getReversedIndexRange( IndexRange(0,acc2.getSequence().size()-1) ) );
+			REQUIRE_FALSE( out.empty() );
+			REQUIRE( mfe.at(p) == (*out.begin())->energy );
+		}
+
+		// second batch reuses cached data
+		mfe.clear();
+		pairs.pop_back();
+		REQUIRE( batch.predict( pairs, callback ) == 1 );
+		REQUIRE( batch.getCacheSize() == 3 );
+		batch.clearCache();
+		REQUIRE( batch.getCacheSize() == 0 );
+	}
+
+	SECTION("mutant prediction") {
+
+		param.threads = 2;
+		BatchPredictor batch( param, vrnaHandler );
+		const BatchPredictor::Pair wildtype( t, q1 );
+
+		const std::vector< BatchPredictor::Mutation > mutations = BatchPredictor::getPointMutations( wildtype, true, true );
+		REQUIRE( mutations.size() == 3*(t.size()+q1.size()) );
+		REQUIRE( BatchPredictor::getPointMutations( wildtype, false, true ).size() == 3*q1.size() );
+
+		std::map< size_t, E_type > mfe;
+		const BatchPredictor::Callback callback = [&]( const size_t pairIndex, const Interaction & i, const InteractionEnergy & energy ) {
+			REQUIRE( pairIndex < mutations.size() );
+			const BatchPredictor::Mutation & mutation = mutations.at(pairIndex);
+			const RnaSequence & mutated = mutation.inTarget ? *(i.s1) : *(i.s2);
+			REQUIRE( mutated.asString().at( mutation.position ) == mutation.nucleotide );
+			mfe[pairIndex] = i.energy;
+		};
+		batch.predictMutants( wildtype, mutations, callback );
+		// only wildtype accessibility is cached
+		REQUIRE( batch.getCacheSize() == 2 );
+
+		// compare to batch prediction of explicitly mutated pairs
+		std::vector< BatchPredictor::Pair > pairs;
+		for (const BatchPredictor::Mutation & mutation : mutations) {
+			std::string tString = t.asString(), qString = q1.asString();
+			(mutation.inTarget ? tString : qString)[mutation.position] = mutation.nucleotide;
+			pairs.push_back( BatchPredictor::Pair( RnaSequence(t.getId(),tString), RnaSequence(q1.getId(),qString) ) );
+		}
+		std::map< size_t, E_type > mfeExplicit;
+		batch.predict( pairs, [&]( const size_t pairIndex, const Interaction & i, const InteractionEnergy & energy ) {
+			mfeExplicit[pairIndex] = i.energy;
+		} );
+		REQUIRE( mfe == mfeExplicit );
+
+		// invalid mutations
+		REQUIRE_THROWS( batch.predictMutants( wildtype, std::vector< BatchPredictor::Mutation >( 1, BatchPredictor::Mutation( false, q1.size(), 'A' ) ), callback ) );
+		REQUIRE_THROWS( batch.predictMutants( wildtype, std::vector< BatchPredictor::Mutation >( 1, BatchPredictor::Mutation( true, 0, 'X' ) ), callback ) );
+	}
+
+}
@@ -0,0 +1,62 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/DinucleotideShuffler.h"
+
+#include <map>
+
+using namespace IntaRNA;
+
+//! counts all dinucleotides of a sequence
+std::map< std::string, size_t >
+getDinucleotideCount( const std::string & seq )
+{
+	std::map< std::string, size_t > count;
+	for (size_t i=1; i<seq.size(); i++) {
+		count[seq.substr(i-1,2)]++;
+	}
+	return count;
+}
+
+TEST_CASE( "DinucleotideShuffler", "[DinucleotideShuffler]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	SECTION("dinucleotide composition is preserved") {
+		const std::string seq = "GGAUUACGUNACGUGGUUCCAAGUAGCUAGCAAGCUAGCUUGACGAUCG";
+		DinucleotideShuffler shuffler( seq );
+		REQUIRE( shuffler.getSequence() == seq );
+		DinucleotideShuffler::RandomGenerator rng( 42 );
+		bool differs = false;
+		for (size_t s=0; s<100; s++) {
+			const std::string shuffled = shuffler.shuffle( rng );
+			REQUIRE( shuffled.size() == seq.size() );
+			REQUIRE( shuffled.front() == seq.front() );
+			REQUIRE( shuffled.back() == seq.back() );
+			REQUIRE( getDinucleotideCount( shuffled ) == getDinucleotideCount( seq ) );
+			differs = differs || (shuffled != seq);
+		}
+		REQUIRE( differs );
+	}
+
+	SECTION("same seed gives same shuffle") {
+		DinucleotideShuffler shuffler( "AGGAUGGGGGACCAUUAGC" );
+		DinucleotideShuffler::RandomGenerator rng1( 7 ), rng2( 7 );
+		for (size_t s=0; s<10; s++) {
+			REQUIRE( shuffler.shuffle( rng1 ) == shuffler.shuffle( rng2 ) );
+		}
+	}
+
+	SECTION("trivial sequences") {
+		DinucleotideShuffler::RandomGenerator rng( 0 );
+		REQUIRE( DinucleotideShuffler( "" ).shuffle( rng ).empty() );
+		REQUIRE( DinucleotideShuffler( "AC" ).shuffle( rng ) == "AC" );
+		REQUIRE( DinucleotideShuffler( "AAAAA" ).shuffle( rng ) == "AAAAA" );
+		// only one Eulerian path
+		REQUIRE( DinucleotideShuffler( "ACGU" ).shuffle( rng ) == "ACGU" );
+	}
+
+}
@@ -0,0 +1,91 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/EdBandMatrix.h"
+
+using namespace IntaRNA;
+
+TEST_CASE( "EdBandMatrix", "[EdBandMatrix]" ) {
+
+	SECTION("lazy default values") {
+		for (int narrow = 0; narrow < 2; narrow++) {
+			EdBandMatrix m( 10, 4, narrow==1 );
+			REQUIRE( m.size() == 10 );
+			REQUIRE( m.getWidth() == 4 );
+			REQUIRE( m.isNarrow() == (narrow==1) );
+			REQUIRE( m.get(0,3) == 0 );
+			REQUIRE( m.get(9,9) == 0 );
+			REQUIRE( m.getRow(0) == NULL );
+		}
+		// width truncated to size
+		EdBandMatrix m( 3, 10 );
+		REQUIRE( m.getWidth() == 3 );
+		// non-zero default
+		EdBandMatrix mInf( 3, 2, true, E_INF );
+		REQUIRE( mInf.get(1,2) == E_INF );
+		mInf.set(0,0,5);
+		REQUIRE( mInf.get(0,0) == 5 );
+		REQUIRE( mInf.get(0,1) == E_INF );
+	}
+
+	SECTION("set and get") {
+		for (int narrow = 0; narrow < 2; narrow++) {
+			EdBandMatrix m( 20, 5, narrow==1 );
+			for (size_t i=0; i<m.size(); i++) {
+			for (size_t j=i; j<std::min(m.size(),i+m.getWidth()); j++) {
+				m.set( i, j, E_type(i*100+j) );
+			}
+			}
+			m.set( 3, 4, E_INF+10 );
+			for (size_t i=0; i<m.size(); i++) {
+			for (size_t j=i; j<std::min(m.size(),i+m.getWidth()); j++) {
+				if (i==3 && j==4) {
+					REQUIRE( m.get(i,j) == E_INF );
+				} else {
+					REQUIRE( m.get(i,j) == E_type(i*100+j) );
+				}
+			}
+			}
+			if (narrow==0) {
+				REQUIRE( m.getRow(2) != NULL );
+				REQUIRE( m.getRow(2)[3] == 205 );
+			} else {
+				REQUIRE( m.getRow(2) == NULL );
+			}
+		}
+	}
+
+	SECTION("narrow storage widens for large values") {
+		EdBandMatrix m( 5, 3, true );
+		m.set( 0, 1, -7 );
+		m.set( 2, 2, 32000 );
+		REQUIRE( m.isNarrow() );
+		m.set( 4, 4, 100000 );
+		REQUIRE_FALSE( m.isNarrow() );
+		REQUIRE( m.get(0,1) == -7 );
+		REQUIRE( m.get(2,2) == 32000 );
+		REQUIRE( m.get(4,4) == 100000 );
+		REQUIRE( m.get(1,3) == 0 );
+		REQUIRE( m.getRow(4)[0] == 100000 );
+	}
+
+	SECTION("resize discards values") {
+		EdBandMatrix m( 5, 3 );
+		m.set( 0, 1, 42 );
+		m.resize( 6, 2 );
+		REQUIRE( m.size() == 6 );
+		REQUIRE( m.getWidth() == 2 );
+		REQUIRE( m.get(0,1) == 0 );
+	}
+
+#if INTARNA_IN_DEBUG_MODE
+	SECTION("out of band access") {
+		EdBandMatrix m( 5, 3 );
+		REQUIRE_THROWS( m.get(0,3) );
+		REQUIRE_THROWS( m.get(2,1) );
+		REQUIRE_THROWS( m.get(4,5) );
+	}
+#endif
+}
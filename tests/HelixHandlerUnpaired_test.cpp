@@ -854,4 +854,86 @@ TEST_CASE( "HelixHandlerUnpaired", "[HelixHandlerUnpaired]") {
 		REQUIRE(interaction.basePairs.size() == 0);
 
 	}
+
+	SECTION("HelixRecBuffer: rolling rows", "[HelixHandlerUnpaired]") {
+
+		HelixHandlerUnpaired::HelixRecBuffer buffer;
+		// 3 rows, columns 2..5, 4 base pair counts
+		buffer.reset( 3, 2, 4, 4 );
+
+		REQUIRE_FALSE( buffer.isAvailable(10, 2) );
+		REQUIRE( buffer.getE(10, 2, 1) == E_INF );
+
+		for (size_t i1=10; i1-- > 5;) {
+			buffer.initRow( i1 );
+			for (size_t i2=2; i2<6; i2++) {
+				for (size_t bp=0; bp<4; bp++) {
+					buffer.set( i1, i2, bp, E_type(i1*100+i2*10+bp), i1+i2+bp );
+				}
+			}
+			// only the last 3 rows are available
+			for (size_t r=i1; r<10; r++) {
+				REQUIRE( buffer.isAvailable(r, 3) == (r < i1+3) );
+				if (r < i1+3) {
+					REQUIRE( buffer.getE(r, 3, 2) == E_type(r*100+32) );
+					REQUIRE( buffer.getLength(r, 3, 2) == r+5 );
+				} else {
+					REQUIRE( buffer.getE(r, 3, 2) == E_INF );
+					REQUIRE( buffer.getLength(r, 3, 2) == 0 );
+				}
+			}
+			// columns outside of the covered range
+			REQUIRE_FALSE( buffer.isAvailable(i1, 1) );
+			REQUIRE_FALSE( buffer.isAvailable(i1, 6) );
+		}
+
+		// new rows are initialized with (E_INF,0)
+		buffer.initRow( 4 );
+		REQUIRE( buffer.getE(4, 2, 3) == E_INF );
+		REQUIRE( buffer.getLength(4, 2, 3) == 0 );
+	}
+
+	SECTION("Helix: traceback of helices with bulges and interior loops", "[HelixHandlerUnpaired]") {
+
+		RnaSequence r1("r1", "GGAGGAAGGCGG");
+		RnaSequence r2("r2", "CCGCCACCUCC");
+		AccessibilityDisabled acc1(r1, 0, NULL);
+		AccessibilityDisabled acc2(r2, 0, NULL);
+		ReverseAccessibility racc(acc2);
+		InteractionEnergyBasePair energy(acc1, racc);
+
+		// bpMin / bpMax / maxIL / maxED / maxE / fullE
+		HelixConstraint hC(2, 8, 2, 999, 0, false);
+		HelixHandlerUnpaired hhU(energy, hC);
+
+		REQUIRE(hhU.fillHelix(0, energy.size1() - 1, 0, energy.size2() - 1) > 0);
+
+		// the traceback has to reproduce the energy and lengths of each helix
+		for (size_t i1=0; i1<energy.size1(); i1++) {
+		for (size_t i2=0; i2<energy.size2(); i2++) {
+			if (E_isINF(hhU.getHelixE(i1,i2))) {
+				continue;
+			}
+			const size_t j1 = i1+hhU.getHelixLength1(i1,i2)-1;
+			const size_t j2 = i2+hhU.getHelixLength2(i1,i2)-1;
+			Interaction interaction(r1,r2);
+			interaction.basePairs.push_back( energy.getBasePair(i1,i2) );
+			hhU.traceBackHelix(interaction, i1, i2);
+			interaction.basePairs.push_back( energy.getBasePair(j1,j2) );
+
+			// sum up loop energies along the base pairs
+			E_type E = 0;
+			for (size_t b=1; b<interaction.basePairs.size(); b++) {
+				const size_t k1 = energy.getIndex1(interaction.basePairs.at(b-1));
+				const size_t k2 = energy.getIndex2(interaction.basePairs.at(b-1));
+				const size_t l1 = energy.getIndex1(interaction.basePairs.at(b));
+				const size_t l2 = energy.getIndex2(interaction.basePairs.at(b));
+				REQUIRE( k1 < l1 );
+				REQUIRE( k2 < l2 );
+				E += energy.getE_interLeft(k1, l1, k2, l2);
+			}
+			REQUIRE( E == hhU.getHelixE(i1,i2) );
+		}
+		}
+	}
 }
@@ -80,4 +80,42 @@ TEST_CASE( "InteractionEnergyBasePair", "[InteractionEnergyBasePair]" ) {
     REQUIRE( E_isINF(energy.getES2(1, 2)) );
   }
 
+	SECTION("scaled Boltzmann weights") {
+		// no scaling by default
+		REQUIRE( energy.getEnsembleShift() == 0 );
+		REQUIRE( Z_equal( energy.getBoltzmannWeightScaled(Ekcal_2_E(-2.0)), energy.getBoltzmannWeight(Ekcal_2_E(-2.0)) ) );
+
+		// scaling keeps ratios and energies
+		energy.setEnsembleShift( Ekcal_2_E(-500.0) );
+		const Z_type z1 = energy.getBoltzmannWeightScaled(Ekcal_2_E(-600.0));
+		const Z_type z2 = energy.getBoltzmannWeightScaled(Ekcal_2_E(-601.0));
+		REQUIRE( z1 < std::numeric_limits<double>::max() );
+		REQUIRE( z2 < std::numeric_limits<double>::max() );
+		REQUIRE( std::abs( z2/z1 - energy.getBoltzmannWeight(Ekcal_2_E(-1.0)) ) < 1e-6 );
+		REQUIRE( E_equal( energy.getE_scaled( z1 ), Ekcal_2_E(-600.0) ) );
+		energy.setEnsembleShift( 0 );
+	}
+
+	SECTION("automatic partition function scaling") {
+		// no scaling needed for short sequences
+		REQUIRE( energy.getEnsembleShiftAuto() == 0 );
+
+		RnaSequence rnaG("G","GGGGGGGGGG"), rnaC("C","CCCCCCCCCC");
+		AccessibilityDisabled accG(rnaG,rnaG.size(),NULL), accC(rnaC,rnaC.size(),NULL);
+		ReverseAccessibility rAccC(accC);
+		// weak base pairs : no overflow possible
+		InteractionEnergyBasePair energyWeak( accG, rAccC, 2, 2, false, 1, Ekcal_2_E(-1.0), 3 );
+		REQUIRE( energyWeak.getEnsembleShiftAuto() == 0 );
+		// strong base pairs : shift by minimal hybridization energy of 10 base pairs
+		InteractionEnergyBasePair energyStrong( accG, rAccC, 2, 2, false, 1, Ekcal_2_E(-100.0), 3 );
+		REQUIRE( energyStrong.getEnsembleShiftAuto() == Ekcal_2_E(-1000.0) );
+		energyStrong.setEnsembleShift( energyStrong.getEnsembleShiftAuto() );
+		REQUIRE( Z_isNotINF( energyStrong.getBoltzmannWeightScaled( Ekcal_2_E(-1000.0) ) ) );
+		REQUIRE( energyStrong.getBoltzmannWeightScaled( Ekcal_2_E(-700.0) ) > 0 );
+		// limited interaction length : no overflow possible
+		AccessibilityDisabled accG3(rnaG,3,NULL);
+		InteractionEnergyBasePair energyShort( accG3, rAccC, 2, 2, false, 1, Ekcal_2_E(-100.0), 3 );
+		REQUIRE( energyShort.getEnsembleShiftAuto() == 0 );
+	}
+
 }
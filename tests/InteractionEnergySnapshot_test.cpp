@@ -0,0 +1,80 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/InteractionEnergySnapshot.h"
+#include "IntaRNA/InteractionEnergyBasePair.h"
+#include "IntaRNA/AccessibilityBasePair.h"
+
+using namespace IntaRNA;
+
+TEST_CASE( "InteractionEnergySnapshot", "[InteractionEnergySnapshot]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	RnaSequence r1("r1","GGGAUUACGUACGUGGUUCCAAGUAGCUAGCAGCUAGCUUGACGAUCG");
+	RnaSequence r2("r2","ACGUGCAUGCUAGCUGAUCGUAGUCGAUGCUAGCUAGUCGUAG");
+
+	// restricted maximal length to check forwarding of uncovered regions
+	AccessibilityBasePair acc1(r1, 12, NULL);
+	AccessibilityBasePair acc2(r2, 15, NULL);
+	ReverseAccessibility rAcc2(acc2);
+
+	InteractionEnergyBasePair energyOrig( acc1, rAcc2, 3, 3, false, 1, Ekcal_2_E(-1.0), 3, Ekcal_2_E(0.5), true );
+
+	SECTION("empty snapshot forwards to energy function") {
+		InteractionEnergyIdxOffset energy( energyOrig, 5, 3 );
+		InteractionEnergySnapshot snapshot( energy );
+
+		REQUIRE( snapshot.getED1(0,7) == energy.getED1(0,7) );
+		REQUIRE( snapshot.getED2(2,9) == energy.getED2(2,9) );
+		REQUIRE( snapshot.getE(0,7,2,9,Ekcal_2_E(-3.0)) == energy.getE(0,7,2,9,Ekcal_2_E(-3.0)) );
+	}
+
+	SECTION("windows equal energy function") {
+		const size_t offsets[][2] = { {0,0}, {5,3}, {17,11} };
+		const size_t sizes[][2] = { {r1.size(),r2.size()}, {20,18}, {40,40} };
+		for (size_t o=0; o<3; o++) {
+		for (size_t s=0; s<3; s++) {
+			InteractionEnergyIdxOffset energy( energyOrig, offsets[o][0], offsets[o][1] );
+			InteractionEnergySnapshot snapshot( energy );
+			snapshot.init( sizes[s][0], sizes[s][1] );
+
+			const size_t size1 = std::min( sizes[s][0], energy.size1() );
+			const size_t size2 = std::min( sizes[s][1], energy.size2() );
+
+			for (size_t i1=0; i1<size1; i1++) {
+			for (size_t j1=i1; j1<size1; j1++) {
+				REQUIRE( snapshot.getED1(i1,j1) == energy.getED1(i1,j1) );
+			}
+			}
+			for (size_t i2=0; i2<size2; i2++) {
+			for (size_t j2=i2; j2<size2; j2++) {
+				REQUIRE( snapshot.getED2(i2,j2) == energy.getED2(i2,j2) );
+			}
+			}
+			for (size_t i1=0; i1<size1; i1++) {
+			for (size_t j1=i1; j1<std::min(size1,i1+14); j1+=3) {
+			for (size_t i2=0; i2<size2; i2++) {
+			for (size_t j2=i2; j2<std::min(size2,i2+17); j2+=4) {
+				REQUIRE( snapshot.getPr_danglingLeft(i1,j1,i2,j2) == energy.getPr_danglingLeft(i1,j1,i2,j2) );
+				REQUIRE( snapshot.getPr_danglingRight(i1,j1,i2,j2) == energy.getPr_danglingRight(i1,j1,i2,j2) );
+				if (energy.areComplementary(i1,i2) && energy.areComplementary(j1,j2)) {
+					REQUIRE( snapshot.getE(i1,j1,i2,j2,Ekcal_2_E(-2.0)) == energy.getE(i1,j1,i2,j2,Ekcal_2_E(-2.0)) );
+				}
+			}
+			}
+			}
+			}
+
+			// outside of window
+			if (size1 < energy.size1()) {
+				REQUIRE( snapshot.getED1(0,size1) == energy.getED1(0,size1) );
+			}
+			REQUIRE( snapshot.getE(0,0,0,0,E_INF) == E_INF );
+		}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include <cstdlib>
+#include "IntaRNA/InteractionEnergyVrna.h"
+#include "IntaRNA/AccessibilityDisabled.h"
+
+using namespace IntaRNA;
+
+/**
+ * Provides access to the ES computation of InteractionEnergyVrna
+ */
+class InteractionEnergyVrnaTest : public InteractionEnergyVrna {
+public:
+
+	InteractionEnergyVrnaTest( const Accessibility & accS1
+					, const ReverseAccessibility & accS2
+					, VrnaHandler &vrnaHandler )
+		: InteractionEnergyVrna( accS1, accS2, vrnaHandler, 16, 16, true )
+	{}
+
+	/**
+	 * Computes the ES values of the first sequence from a single window
+	 * covering the whole sequence
+	 * @param esFull the container to fill
+	 */
+	void
+	computeES1full( EdBandMatrix & esFull )
+	{
+		const Accessibility & acc = getAccessibility1();
+		const size_t n = acc.getSequence().size();
+		esFull.resize( n, esValues1->getWidth() );
+		computeES( acc, 0, n, 0, n, esFull );
+	}
+
+};
+
+TEST_CASE( "InteractionEnergyVrna", "[InteractionEnergyVrna]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	// reproducible sequence spanning several ES windows
+	std::string seq1(150,'A');
+	unsigned int state = 7;
+	for (size_t i=0; i<seq1.size(); i++) {
+		state = state*1103515245 + 12345;
+		seq1[i] = "ACGU"[(state>>16)%4];
+	}
+	RnaSequence rna1("r1",seq1);
+	RnaSequence rna2("r2","GGGAAAUCCCAGCUAGCUAG");
+
+	// maximal subsequence length = window length / 4
+	const size_t maxLength = 12;
+	AccessibilityDisabled acc1(rna1,maxLength,NULL);
+	AccessibilityDisabled acc2(rna2,rna2.size(),NULL);
+	ReverseAccessibility rAcc2(acc2);
+	VrnaHandler vrnaHandler(37,"Turner04",false,false);
+
+	InteractionEnergyVrnaTest energy( acc1, rAcc2, vrnaHandler );
+
+	SECTION("ES windowed vs. full sequence") {
+
+		EdBandMatrix esFull;
+		energy.computeES1full( esFull );
+
+		// all subsequences within the band, including those crossing the
+		// boundaries of the folded windows
+		for (size_t i=0; i<rna1.size(); i++) {
+			for (size_t j=i; j<rna1.size() && j-i<maxLength; j++) {
+				const E_type esWin = energy.getES1(i,j);
+				const E_type esSeq = esFull.get(i,j);
+				if (E_isINF(esSeq)) {
+					REQUIRE( E_isINF(esWin) );
+				} else {
+					REQUIRE_FALSE( E_isINF(esWin) );
+					// windows are differently scaled, allow rounding differences
+					REQUIRE( std::abs(esWin-esSeq) <= 1 );
+				}
+			}
+		}
+	}
+
+	SECTION("ES outside of the band") {
+
+		for (size_t i=0; i+maxLength<rna1.size(); i++) {
+			REQUIRE( E_isINF( energy.getES1(i,i+maxLength) ) );
+			REQUIRE( E_isINF( energy.getES1(i,rna1.size()-1) ) );
+		}
+		// too short for any intramolecular base pair
+		REQUIRE( E_isINF( energy.getES1(0,0) ) );
+	}
+
+}
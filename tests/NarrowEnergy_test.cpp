@@ -0,0 +1,64 @@
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/NarrowEnergy.h"
+
+#include <boost/numeric/ublas/matrix.hpp>
+
+using namespace IntaRNA;
+
+TEST_CASE( "NarrowEnergy", "[NarrowEnergy]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	SECTION("check default construction") {
+		NarrowEnergy e;
+		REQUIRE( E_isINF( e ) );
+		REQUIRE( sizeof(NarrowEnergy) == 2 );
+	}
+
+	SECTION("check narrow values") {
+		NarrowEnergy e(-123);
+		REQUIRE( E_type(e) == -123 );
+		e = 0;
+		REQUIRE( E_type(e) == 0 );
+		e = NarrowEnergy::NARROW_MIN;
+		REQUIRE( E_type(e) == E_type(NarrowEnergy::NARROW_MIN) );
+		e = NarrowEnergy::NARROW_INF-1;
+		REQUIRE( E_type(e) == E_type(NarrowEnergy::NARROW_INF)-1 );
+		e = E_INF;
+		REQUIRE( E_isINF( e ) );
+		e = E_INF + 10;
+		REQUIRE( E_type(e) == E_INF );
+	}
+
+	SECTION("check range limits") {
+		NarrowEnergy e(-5);
+		// large finite values are saturated to infinity
+		e = E_MAX;
+		REQUIRE( E_type(e) == E_INF );
+		e = NarrowEnergy::NARROW_INF;
+		REQUIRE( E_type(e) == E_INF );
+		// too small values are not representable
+		e = -5;
+		REQUIRE_THROWS_AS( e = -100000, std::overflow_error );
+		REQUIRE( E_type(e) == -5 );
+		REQUIRE_THROWS_AS( NarrowEnergy(E_type(NarrowEnergy::NARROW_MIN)-1), std::overflow_error );
+	}
+
+	SECTION("check matrix storage") {
+		boost::numeric::ublas::matrix<NarrowEnergy> m(3,4);
+		REQUIRE( E_isINF( m(2,3) ) );
+		m(1,2) = -7000;
+		m(0,0) = -7;
+		REQUIRE( E_type(m(1,2)) == -7000 );
+		REQUIRE( std::min<E_type>( m(0,0), m(1,2) ) == -7000 );
+		// resize with preservation keeps values
+		m.resize(4,4,true);
+		REQUIRE( E_type(m(1,2)) == -7000 );
+		REQUIRE( E_type(m(0,0)) == -7 );
+	}
+
+}
@@ -0,0 +1,124 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include <sstream>
+
+#include "IntaRNA/AccessibilityDisabled.h"
+#include "IntaRNA/InteractionEnergyBasePair.h"
+#include "IntaRNA/OutputHandlerBinary.h"
+#include "IntaRNA/OutputHandlerBinaryReader.h"
+#include "IntaRNA/ReverseAccessibility.h"
+
+using namespace IntaRNA;
+
+TEST_CASE( "OutputHandlerBinary", "[OutputHandlerBinary]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	RnaSequence r1("r1;a", "GGGAAGG");
+	RnaSequence r2("r2", "CCAACCC");
+	AccessibilityDisabled acc1(r1, 0, NULL);
+	AccessibilityDisabled acc2(r2, 0, NULL);
+	ReverseAccessibility racc(acc2);
+	InteractionEnergyBasePair energy(acc1, racc);
+
+	OutputConstraint outC(10,OutputConstraint::OVERLAP_SEQ2,0,100);
+
+	// interactions to report
+	Interaction i1(r1,r2);
+	i1.basePairs.push_back( Interaction::BasePair(0,6) );
+	i1.basePairs.push_back( Interaction::BasePair(1,5) );
+	i1.energy = -200;
+	Interaction i2(i1);
+	i2.basePairs.push_back( Interaction::BasePair(6,0) );
+	i2.energy = -345;
+	i2.setSeedRange( Interaction::BasePair(0,6), Interaction::BasePair(1,5), -123 );
+	REQUIRE( i1.isValid() );
+	REQUIRE( i2.isValid() );
+
+	const OutputHandlerCsv::ColTypeList cols = OutputHandlerCsv::string2list("");
+
+	// generate CSV reference output
+	std::stringstream csv;
+	csv <<OutputHandlerCsv::getHeader( cols, ";" );
+	{
+		OutputHandlerCsv out( outC, csv, energy, cols, ";", false, ":" );
+		out.add( i1 );
+		out.add( i2 );
+		out.add( i1 );
+	}
+
+	SECTION("single row group") {
+		std::stringstream bin;
+		OutputHandlerBinary::writeHeader( bin, cols, outC.bestSeedOnly );
+		{
+			OutputHandlerBinary out( outC, bin, energy, cols );
+			out.add( i1 );
+			out.add( i2 );
+			out.add( i1 );
+			REQUIRE( out.reported() == 3 );
+		}
+
+		// check typed access
+		OutputHandlerBinaryReader reader( bin );
+		REQUIRE( reader.getColumns() == cols );
+		REQUIRE( reader.nextRowGroup() );
+		REQUIRE( reader.size() == 3 );
+		size_t c = 0;
+		for (auto col = cols.begin(); col != cols.end(); col++, c++) {
+			switch( *col ) {
+			case OutputHandlerCsv::id1 :
+				REQUIRE( reader.getString( c, 1 ) == r1.getId() );
+				break;
+			case OutputHandlerCsv::start1 :
+				REQUIRE( reader.getInt( c, 1 ) == 1 );
+				break;
+			case OutputHandlerCsv::end1 :
+				REQUIRE( reader.getInt( c, 1 ) == 7 );
+				break;
+			case OutputHandlerCsv::E :
+				REQUIRE( reader.isAvailable( c, 1 ) );
+				REQUIRE( reader.getFloat( c, 1 ) == E_2_Ekcal(i2.energy) );
+				break;
+			case OutputHandlerCsv::bpList :
+				REQUIRE( reader.getIntList( c, 1 ).size() == 6 );
+				break;
+			case OutputHandlerCsv::seedE :
+				REQUIRE( reader.getFloatList( c, 0 ).empty() );
+				REQUIRE( reader.getFloatList( c, 1 ).size() == 1 );
+				break;
+			case OutputHandlerCsv::Eall :
+				REQUIRE_FALSE( reader.isAvailable( c, 1 ) );
+				break;
+			default : break;
+			}
+		}
+		REQUIRE_FALSE( reader.nextRowGroup() );
+	}
+
+	SECTION("CSV conversion") {
+		for (int compress = 0; compress < 2; compress++) {
+			std::stringstream bin;
+			OutputHandlerBinary::writeHeader( bin, cols, outC.bestSeedOnly );
+			{
+				// one row per row group
+				OutputHandlerBinary out( outC, bin, energy, cols, compress == 1, 1 );
+				out.add( i1 );
+				out.add( i2 );
+				out.add( i1 );
+			}
+			std::stringstream converted;
+			REQUIRE( OutputHandlerBinaryReader::convertToCsv( bin, converted ) == 3 );
+			REQUIRE( converted.str() == csv.str() );
+		}
+	}
+
+	SECTION("no binary input") {
+		std::stringstream bin( csv.str() ), converted;
+		REQUIRE_THROWS( OutputHandlerBinaryReader::convertToCsv( bin, converted ) );
+	}
+
+}
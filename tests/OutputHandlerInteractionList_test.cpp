@@ -88,4 +88,51 @@ TEST_CASE( "OutputHandlerInteractionList", "[OutputHandlerInteractionList]" ) {
 
 	}
 
+	SECTION("bounded k-best") {
+
+		Interaction i(r,r);
+		i.basePairs.push_back( Interaction::BasePair(0,7));
+		i.basePairs.push_back( Interaction::BasePair(1,6));
+		REQUIRE( i.isValid() );
+
+		OutputHandlerInteractionList out(oc,3);
+
+		// add energies in shuffled order including duplicates and empty interactions
+		const int energies[] = { 5, -2, 3, -2, 0, 7, -4, 3, -1 };
+		for (const int e : energies) {
+			i.energy = e;
+			out.add(i);
+			out.add(Interaction(r,r));
+			REQUIRE( out.reportedHits() <= 3 );
+		}
+		REQUIRE( out.reported() == 18 );
+		REQUIRE( out.reportedHits() == 3 );
+
+		// only the 3 best distinct interactions in sorted order
+		auto outIt = out.begin();
+		REQUIRE( (*outIt)->energy == -4 );
+		outIt++;
+		REQUIRE( (*outIt)->energy == -2 );
+		outIt++;
+		REQUIRE( (*outIt)->energy == -1 );
+		outIt++;
+		REQUIRE( outIt == out.end() );
+
+		// further insertion after access to merged list
+		i.energy = -3;
+		out.add(i);
+		i.energy = -4;
+		out.add(i);
+		REQUIRE( out.reported() == 20 );
+		outIt = out.begin();
+		REQUIRE( (*outIt)->energy == -4 );
+		outIt++;
+		REQUIRE( (*outIt)->energy == -3 );
+		outIt++;
+		REQUIRE( (*outIt)->energy == -2 );
+		outIt++;
+		REQUIRE( outIt == out.end() );
+
+	}
+
 }
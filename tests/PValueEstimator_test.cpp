@@ -0,0 +1,52 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/PValueEstimator.h"
+
+#include <cmath>
+
+using namespace IntaRNA;
+
+TEST_CASE( "PValueEstimator", "[PValueEstimator]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	SECTION("empty") {
+		PValueEstimator p;
+		REQUIRE( p.empty() );
+		REQUIRE( p.size() == 0 );
+		REQUIRE( std::isnan( p.getPValueEmpirical( -10.0 ) ) );
+		REQUIRE( std::isnan( p.getPValueGauss( -10.0 ) ) );
+		REQUIRE( std::isnan( p.getPValueGumbel( -10.0 ) ) );
+	}
+
+	SECTION("distribution fits") {
+		// values of the intarnapvalue python module for reference
+		std::vector< double > samples = { -1.235, -1.435645, -6.234234, -12.999, -15.23, -6.98, -6.23, -2.78 };
+		PValueEstimator p( samples );
+		REQUIRE_FALSE( p.empty() );
+		REQUIRE( p.size() == samples.size() );
+		REQUIRE( p.getPValueEmpirical( -10.0 ) == Approx( 0.25 ) );
+		REQUIRE( p.getPValueEmpirical( -15.23 ) == Approx( 0.125 ) );
+		REQUIRE( p.getPValueEmpirical( -20.0 ) == Approx( 0.0 ) );
+		REQUIRE( p.getPValueEmpirical( 0.0 ) == Approx( 1.0 ) );
+		REQUIRE( p.getPValueGauss( -10.0 ) == Approx( 0.2429106747265256 ) );
+		REQUIRE( p.getPValueGumbel( -10.0 ) == Approx( 0.19721934073203196 ).epsilon( 0.001 ) );
+		// monotonicity
+		REQUIRE( p.getPValueGumbel( -12.0 ) < p.getPValueGumbel( -10.0 ) );
+		REQUIRE( p.getPValueGauss( -12.0 ) < p.getPValueGauss( -10.0 ) );
+	}
+
+	SECTION("degenerated sample") {
+		PValueEstimator p( std::vector< double >( 5, -3.0 ) );
+		REQUIRE( p.getGaussSd() == 0.0 );
+		REQUIRE( p.getPValueGauss( -4.0 ) == 0.0 );
+		REQUIRE( p.getPValueGauss( -3.0 ) == 1.0 );
+		REQUIRE( p.getPValueGumbel( -4.0 ) == 0.0 );
+		REQUIRE( p.getPValueEmpirical( -3.0 ) == 1.0 );
+	}
+
+}
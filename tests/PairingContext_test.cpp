@@ -0,0 +1,107 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/PairingContext.h"
+#include "IntaRNA/InteractionEnergyBasePair.h"
+#include "IntaRNA/AccessibilityDisabled.h"
+
+using namespace IntaRNA;
+
+TEST_CASE( "PairingContext", "[PairingContext]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	// sequences longer than 64 nt to test multi-word rows
+	RnaSequence r1("r1","GGGAUUACGUNACGUGGUUCCAAGUAGCUAGCNNAGCUAGCUUGACGAUCGAUGCAUGCUAGCUAGUCGAUGCAUCG");
+	RnaSequence r2("r2","ACGUGCAUGCUAGCUGAUCGUAGUCGAUGCUAGCUAGUCGUAGUCGAUGCUAGUCGAUCGNAUGCAUGCAUGCU");
+
+	// block some positions of r1
+	std::string dotBracket1(r1.size(),'.');
+	dotBracket1.replace(3,4,"bbbb");
+	dotBracket1.replace(66,2,"bb");
+	AccessibilityConstraint accC1( r1, dotBracket1, 0, "", "", "" );
+
+	AccessibilityDisabled acc1(r1,r1.size(),&accC1);
+	AccessibilityDisabled acc2(r2,r2.size(),NULL);
+	ReverseAccessibility rAcc2(acc2);
+
+	SECTION("empty context") {
+		PairingContext pairing;
+		REQUIRE_FALSE( pairing.covers(0,0) );
+	}
+
+	SECTION("full window equals energy function") {
+		for (int loopGU = 0; loopGU < 2; loopGU++) {
+			InteractionEnergyBasePair energy( acc1, rAcc2, 3, 2, false, 1, Ekcal_2_E(-1.0), 3, 0, true, loopGU==1 );
+
+			PairingContext pairing;
+			pairing.init( energy, 0, RnaSequence::lastPos, 0, RnaSequence::lastPos );
+
+			REQUIRE( pairing.covers( energy.size1()-1, energy.size2()-1 ) );
+			REQUIRE_FALSE( pairing.covers( energy.size1(), 0 ) );
+			REQUIRE_FALSE( pairing.covers( 0, energy.size2() ) );
+
+			for (size_t i1=0; i1<energy.size1(); i1++) {
+				REQUIRE( pairing.isAccessible1(i1) == energy.isAccessible1(i1) );
+			}
+			for (size_t i2=0; i2<energy.size2(); i2++) {
+				REQUIRE( pairing.isAccessible2(i2) == energy.isAccessible2(i2) );
+			}
+			for (size_t i1=0; i1<energy.size1(); i1++) {
+			for (size_t i2=0; i2<energy.size2(); i2++) {
+				REQUIRE( pairing.areComplementary(i1,i2) == energy.areComplementary(i1,i2) );
+				if (energy.areComplementary(i1,i2)) {
+					REQUIRE( pairing.isGU(i1,i2) == energy.isGU(i1,i2) );
+				}
+				// check all loops within the maximal loop size and beyond
+				for (size_t j1=i1; j1<std::min(energy.size1(),i1+7); j1++) {
+				for (size_t j2=i2; j2<std::min(energy.size2(),i2+7); j2++) {
+					REQUIRE( pairing.isValidInternalLoop(i1,j1,i2,j2) == energy.isValidInternalLoop(i1,j1,i2,j2) );
+				}
+				}
+			}
+			}
+		}
+	}
+
+	SECTION("sub window") {
+		InteractionEnergyBasePair energy( acc1, rAcc2 );
+
+		PairingContext pairing;
+		pairing.init( energy, 10, 70, 5, 68 );
+
+		REQUIRE_FALSE( pairing.covers( 9, 5 ) );
+		REQUIRE_FALSE( pairing.covers( 10, 4 ) );
+		REQUIRE_FALSE( pairing.covers( 71, 5 ) );
+		REQUIRE_FALSE( pairing.covers( 10, 69 ) );
+
+		for (size_t i1=10; i1<=70; i1++) {
+		for (size_t i2=5; i2<=68; i2++) {
+			REQUIRE( pairing.covers(i1,i2) );
+			REQUIRE( pairing.areComplementary(i1,i2) == energy.areComplementary(i1,i2) );
+		}
+		}
+
+		pairing.clear();
+		REQUIRE_FALSE( pairing.covers( 10, 5 ) );
+	}
+
+	SECTION("complementarity rows") {
+		InteractionEnergyBasePair energy( acc1, rAcc2 );
+
+		PairingContext pairing;
+		pairing.init( energy, 3, 70, 2, 72 );
+
+		REQUIRE( pairing.getRowWords() == 2 );
+		for (size_t i1=3; i1<=70; i1++) {
+			const boost::uint64_t * row = pairing.getComplementaryRow(i1);
+			for (size_t i2=2; i2<=72; i2++) {
+				const size_t c = i2-2;
+				REQUIRE( (((row[c/64] >> (c%64)) & 1) == 1) == energy.areComplementary(i1,i2) );
+			}
+		}
+	}
+}
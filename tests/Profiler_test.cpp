@@ -0,0 +1,62 @@
+
+#include "catch.hpp"
+
+#undef NDEBUG
+
+#include "IntaRNA/Profiler.h"
+
+#include <sstream>
+
+using namespace IntaRNA;
+
+TEST_CASE( "Profiler", "[Profiler]" ) {
+
+	// setup easylogging++ stuff if not already done
+	#include "testEasyLoggingSetup.icc"
+
+	SECTION("disabled") {
+		Profiler::setEnabled( false );
+		{
+			Profiler::Timer timer( Profiler::DP_FILL );
+			Profiler::count( Profiler::DP_CELLS, 10 );
+		}
+		Profiler::Record rec = Profiler::getThreadRecord();
+		REQUIRE( rec.calls[Profiler::DP_FILL] == 0 );
+		REQUIRE( rec.counter[Profiler::DP_CELLS] == 0 );
+	}
+
+	SECTION("nested timers and counters") {
+		Profiler::setEnabled( true );
+		const Profiler::Record start = Profiler::getThreadRecord();
+		{
+			Profiler::Timer timer( Profiler::DP_FILL );
+			Profiler::count( Profiler::DP_CELLS, 10 );
+			{
+				Profiler::Timer timer( Profiler::SEED_FILL );
+				Profiler::count( Profiler::SEEDS );
+			}
+			{
+				Profiler::Timer timer( Profiler::SEED_FILL );
+			}
+		}
+		Profiler::Record rec = Profiler::getThreadRecord();
+		rec -= start;
+		REQUIRE( rec.calls[Profiler::DP_FILL] == 1 );
+		REQUIRE( rec.calls[Profiler::SEED_FILL] == 2 );
+		REQUIRE( rec.calls[Profiler::TRACEBACK] == 0 );
+		REQUIRE( rec.counter[Profiler::DP_CELLS] == 10 );
+		REQUIRE( rec.counter[Profiler::SEEDS] == 1 );
+		REQUIRE( rec.counter[Profiler::INTERACTIONS] == 0 );
+
+		// check output
+		Profiler::addPair( "t", "q", rec );
+		std::stringstream json, csv;
+		Profiler::writeJson( json );
+		Profiler::writeCsv( csv );
+		REQUIRE( json.str().find("\"dpFill\"") != std::string::npos );
+		REQUIRE( json.str().find("\"target\": \"t\"") != std::string::npos );
+		REQUIRE( csv.str().find("pair;t;q;") != std::string::npos );
+
+		Profiler::setEnabled( false );
+	}
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+#
+# Compares the JSON output of runBenchmarks against a baseline file.
+#
+# For each workload present in both files, the ratio of the (minimal) run times
+# and of the peak RSS is reported. The script exits with a non-zero status if
+# any workload is slower (or needs more memory) than the baseline by more than
+# the given tolerance, which enables performance gating of upgrades.
+#
+# usage: compareBenchmarks.py [--tolerance=0.1] [--minTime=0.01] BASELINE.json CURRENT.json
+#
+
+import json
+import sys
+import argparse
+
+
+def load(fileName):
+    with open(fileName) as f:
+        data = json.load(f)
+    return {r["id"]: r for r in data["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare IntaRNA benchmark results against a baseline.")
+    parser.add_argument("baseline", help="JSON benchmark file used as reference")
+    parser.add_argument("current", help="JSON benchmark file to check")
+    parser.add_argument("--tolerance", type=float, default=0.1,
+                        help="allowed relative slowdown/memory increase (default 0.1 = 10%%)")
+    parser.add_argument("--minTime", type=float, default=0.01,
+                        help="workloads faster than this (in seconds) are not gated (default 0.01)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    print("%-70s %12s %12s %8s %8s" % ("workload", "base_ns/cell", "cur_ns/cell", "time", "rss"))
+    for wid in sorted(set(baseline) & set(current)):
+        b = baseline[wid]
+        c = current[wid]
+        timeRatio = c["time_s_min"] / max(1e-12, b["time_s_min"])
+        rssRatio = c["peak_rss_kb"] / max(1, b["peak_rss_kb"])
+        status = ""
+        if max(b["time_s_min"], c["time_s_min"]) >= args.minTime and timeRatio > 1 + args.tolerance:
+            status += " SLOWER"
+        if rssRatio > 1 + args.tolerance:
+            status += " MEMORY"
+        if status:
+            regressions += 1
+        print("%-70s %12.1f %12.1f %8.3f %8.3f%s"
+              % (wid, b["ns_per_cell"], c["ns_per_cell"], timeRatio, rssRatio, status))
+
+    for wid in sorted(set(baseline) - set(current)):
+        print("%-70s missing in %s" % (wid, args.current))
+    for wid in sorted(set(current) - set(baseline)):
+        print("%-70s missing in %s" % (wid, args.baseline))
+
+    if regressions > 0:
+        print("\n%d workload(s) exceed the tolerance of %.0f%%" % (regressions, 100 * args.tolerance))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,635 @@
+
+#ifdef HAVE_CONFIG_H
+	#include <config.h>
+#endif
+
+#include "IntaRNA/general.h"
+
+////////////////  CENTRAL LOGGING LIB  //////////////////
+
+#include "easylogging++.h"
+
+// initialize logging for binary
+INITIALIZE_EASYLOGGINGPP
+
+////////////////  BENCHMARK TARGETS  /////////////////////
+
+#include "IntaRNA/RnaSequence.h"
+#include "IntaRNA/AccessibilityDisabled.h"
+#include "IntaRNA/AccessibilityBasePair.h"
+#include "IntaRNA/AccessibilityVrna.h"
+#include "IntaRNA/ReverseAccessibility.h"
+#include "IntaRNA/InteractionEnergyBasePair.h"
+#include "IntaRNA/SeedConstraint.h"
+#include "IntaRNA/SeedHandlerMfe.h"
+#include "IntaRNA/HelixConstraint.h"
+#include "IntaRNA/HelixHandler.h"
+#include "IntaRNA/OutputConstraint.h"
+#include "IntaRNA/OutputHandlerInteractionList.h"
+#include "IntaRNA/OutputHandlerCsv.h"
+#include "IntaRNA/PredictorMfe2d.h"
+#include "IntaRNA/PredictorMfe2dSeed.h"
+#include "IntaRNA/PredictorMfe2dHeuristic.h"
+#include "IntaRNA/PredictorMfe2dHeuristicSeed.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace IntaRNA;
+
+/**
+ * Microbenchmark suite for the central IntaRNA components.
+ *
+ * All workloads are run on reproducible synthetic sequences of varying
+ * lengths. Optionally, the IntaRNA binary is run for all parameter files of
+ * the test data directory and for all personalities.
+ *
+ * The results are written in JSON format, reporting for each workload
+ * the run time, the time per DP cell (ns/cell), the throughput (cells/s) and
+ * the peak resident set size (RSS) in KB.
+ *
+ * Call with --help for available arguments.
+ *
+ * @author Martin Mann
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+//! a single benchmark result
+struct BenchResult {
+	//! the component group
+	std::string group;
+	//! the benchmarked workload
+	std::string name;
+	//! the workload parameters
+	std::string param;
+	//! the sequence length used
+	size_t length;
+	//! the number of cells computed per run
+	size_t cells;
+	//! the number of repeated runs
+	size_t repeat;
+	//! minimal run time in seconds
+	double timeMin;
+	//! mean run time in seconds
+	double timeMean;
+	//! peak resident set size in KB
+	long peakRss;
+};
+
+//! the benchmark settings
+struct BenchSettings {
+	//! sequence lengths to test
+	std::vector<size_t> lengths;
+	//! number of repeats per workload
+	size_t repeat;
+	//! maximal interaction length per sequence
+	size_t maxLength;
+	//! maximal sequence length for the benchmark of exact predictors
+	size_t maxLengthExact;
+	//! random seed for the sequence generation
+	unsigned long randomSeed;
+	//! IntaRNA binary to be used for end-to-end benchmarks or empty
+	std::string binary;
+	//! test data directory with parameter files or empty
+	std::string dataDir;
+	//! output file or empty for stdout
+	std::string outFile;
+	//! only workloads with this group name or empty for all
+	std::string group;
+
+	BenchSettings()
+		: lengths({50,100,200,400})
+		, repeat(3)
+		, maxLength(60)
+		, maxLengthExact(100)
+		, randomSeed(42)
+		, binary("")
+		, dataDir("")
+		, outFile("")
+		, group("")
+	{}
+};
+
+//! the collected results
+std::vector<BenchResult> results;
+
+//! the used settings
+BenchSettings settings;
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Generates a reproducible random RNA sequence
+ * @param length the length of the sequence
+ * @param id the sequence identifier to be used
+ * @return the sequence
+ */
+RnaSequence
+getRandomSequence( const size_t length, const std::string & id )
+{
+	std::mt19937 rng( settings.randomSeed + length + std::hash<std::string>()(id) );
+	std::uniform_int_distribution<int> nt(0,3);
+	std::string seq(length,'A');
+	for (size_t i=0; i<length; i++) {
+		seq[i] = "ACGU"[nt(rng)];
+	}
+	return RnaSequence( id, seq );
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs a given workload repeatedly and stores the measured performance.
+ *
+ * The repeats are run within a forked child process such that the reported
+ * peak resident set size covers only the current workload (plus the constant
+ * footprint of the benchmark driver) and is not inherited from previously
+ * run workloads.
+ *
+ * @param group the component group
+ * @param name the workload name
+ * @param param the parameter description
+ * @param length the sequence length
+ * @param cells the number of cells processed per run
+ * @param run the workload to run
+ *
+ * @throws std::runtime_error if the workload could not be run or failed
+ */
+template< typename Workload >
+void
+bench( const std::string & group
+		, const std::string & name
+		, const std::string & param
+		, const size_t length
+		, const size_t cells
+		, Workload run )
+{
+	if (!settings.group.empty() && settings.group != group) {
+		return;
+	}
+	std::cerr <<"# bench "<<group<<" "<<name<<" "<<param<<" length="<<length<<std::endl;
+	// pipe to report the timings of the child to the parent
+	int timePipe[2];
+	if (pipe(timePipe) != 0) {
+		throw std::runtime_error("bench() : could not create pipe for "+name);
+	}
+	pid_t pid = fork();
+	if (pid == 0) {
+		close(timePipe[0]);
+		double times[2] = { std::numeric_limits<double>::max(), 0 };
+		try {
+			for (size_t r=0; r<settings.repeat; r++) {
+				const auto start = std::chrono::steady_clock::now();
+				run();
+				const double time = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+				times[0] = std::min(times[0], time);
+				times[1] += time;
+			}
+		} catch (std::exception & e) {
+			std::cerr <<"# ERROR: "<<name<<" "<<param<<" : "<<e.what()<<std::endl;
+			_exit(1);
+		}
+		const bool written = write(timePipe[1], times, sizeof(times)) == (ssize_t)sizeof(times);
+		close(timePipe[1]);
+		_exit( written ? 0 : 1 );
+	}
+	close(timePipe[1]);
+	if (pid < 0) {
+		close(timePipe[0]);
+		throw std::runtime_error("bench() : could not fork for "+name);
+	}
+	double times[2] = { 0, 0 };
+	const bool timesRead = read(timePipe[0], times, sizeof(times)) == (ssize_t)sizeof(times);
+	close(timePipe[0]);
+	int status = 0;
+	struct rusage usage;
+	if (wait4(pid, &status, 0, &usage) < 0
+		|| !WIFEXITED(status) || WEXITSTATUS(status) != 0 || !timesRead)
+	{
+		throw std::runtime_error("bench() : workload "+group+" "+name+" "+param+" failed");
+	}
+	BenchResult res = { group, name, param, length, cells, settings.repeat
+						, times[0], times[1]/double(settings.repeat), (long)usage.ru_maxrss };
+	results.push_back(res);
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Benchmarks the accessibility computations
+ * @param length the sequence length to be used
+ */
+void
+benchAccessibility( const size_t length )
+{
+	const RnaSequence seq = getRandomSequence(length, "target");
+	const size_t maxLength = std::min(length, settings.maxLength);
+	const size_t cells = length*maxLength;
+
+	bench( "accessibility", "AccessibilityBasePair", "", length, cells
+			, [&](){ AccessibilityBasePair acc(seq, maxLength, NULL); } );
+
+	VrnaHandler vrnaHandler;
+	bench( "accessibility", "AccessibilityVrna", "plFoldW=0", length, cells
+			, [&](){ AccessibilityVrna acc(seq, maxLength, NULL, vrnaHandler); } );
+	bench( "accessibility", "AccessibilityVrna", "plFoldW=150", length, cells
+			, [&](){ AccessibilityVrna acc(seq, maxLength, NULL, vrnaHandler, 150); } );
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Provides the seed constraint used for benchmarking
+ * @param bp the number of seed base pairs
+ * @param maxUP the maximal number of unpaired bases in the seed
+ * @param noLP whether or not lonely base pairs are forbidden
+ * @return the seed constraint
+ */
+SeedConstraint
+getSeedConstraint( const size_t bp, const size_t maxUP, const bool noLP )
+{
+	return SeedConstraint( bp, maxUP, maxUP, maxUP, 0
+				, Accessibility::ED_UPPER_BOUND
+				, 0
+				, IndexRangeList("")
+				, IndexRangeList("")
+				, ""
+				, false, false, noLP );
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Benchmarks the seed and helix handlers
+ * @param length the sequence length to be used
+ */
+void
+benchSeedHelix( const size_t length )
+{
+	const RnaSequence s1 = getRandomSequence(length, "target");
+	const RnaSequence s2 = getRandomSequence(length, "query");
+	AccessibilityDisabled acc1(s1, settings.maxLength, NULL);
+	AccessibilityDisabled acc2(s2, settings.maxLength, NULL);
+	ReverseAccessibility racc(acc2);
+	InteractionEnergyBasePair energy(acc1, racc);
+	const size_t cells = length*length;
+
+	for (size_t maxUP = 0; maxUP < 3; maxUP += 2) {
+		const SeedConstraint seedConstr = getSeedConstraint(7, maxUP, false);
+		bench( "seed", "SeedHandlerMfe", "seedBP=7,seedMaxUP="+toString(maxUP), length, cells
+				, [&](){
+					SeedHandlerMfe seedHandler(energy, seedConstr);
+					seedHandler.fillSeed(0,energy.size1()-1, 0,energy.size2()-1);
+				} );
+	}
+
+	for (size_t maxIL = 0; maxIL < 3; maxIL += 2) {
+		const HelixConstraint helixConstr(2, 10, maxIL, Accessibility::ED_UPPER_BOUND, 0, false);
+		bench( "helix", (maxIL==0?"HelixHandlerNoBulgeMax":"HelixHandlerUnpaired"), "helixMaxIL="+toString(maxIL), length, cells
+				, [&](){
+					HelixHandler * helixHandler = HelixHandler::getHelixHandler(energy, helixConstr);
+					helixHandler->fillHelix(0,energy.size1()-1, 0,energy.size2()-1);
+					delete helixHandler;
+				} );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Benchmarks the mfe predictors with and without seed, lonely base pairs
+ * and GU base pairs at interaction ends
+ * @param length the sequence length to be used
+ */
+void
+benchPredictors( const size_t length )
+{
+	const RnaSequence s1 = getRandomSequence(length, "target");
+	const RnaSequence s2 = getRandomSequence(length, "query");
+	AccessibilityDisabled acc1(s1, settings.maxLength, NULL);
+	AccessibilityDisabled acc2(s2, settings.maxLength, NULL);
+	ReverseAccessibility racc(acc2);
+	InteractionEnergyBasePair energy(acc1, racc);
+	const size_t cells = length*length;
+	const IndexRange r1(0,s1.lastPos), r2(0,s2.lastPos);
+
+	for (int noLP = 0; noLP < 2; noLP++) {
+	for (int noGUend = 0; noGUend < 2; noGUend++) {
+		const std::string param = "noLP="+toString(noLP)+",noGUend="+toString(noGUend);
+		const OutputConstraint outConstr(1, OutputConstraint::OVERLAP_BOTH, 0, E_INF, false, noLP!=0, noGUend!=0);
+		const SeedConstraint seedConstr = getSeedConstraint(7, 0, noLP!=0);
+
+		bench( "predictor", "PredictorMfe2dHeuristic", param, length, cells
+				, [&](){
+					OutputHandlerInteractionList out(outConstr, 1);
+					PredictorMfe2dHeuristic predictor(energy, out, NULL);
+					predictor.predict(r1,r2);
+				} );
+		bench( "predictor", "PredictorMfe2dHeuristicSeed", param+",seedBP=7", length, cells
+				, [&](){
+					OutputHandlerInteractionList out(outConstr, 1);
+					PredictorMfe2dHeuristicSeed predictor(energy, out, NULL, new SeedHandlerMfe(energy, seedConstr));
+					predictor.predict(r1,r2);
+				} );
+		// skip the exact predictors for long sequences
+		if (length > settings.maxLengthExact) {
+			continue;
+		}
+		bench( "predictor", "PredictorMfe2d", param, length, cells
+				, [&](){
+					OutputHandlerInteractionList out(outConstr, 1);
+					PredictorMfe2d predictor(energy, out, NULL);
+					predictor.predict(r1,r2);
+				} );
+		bench( "predictor", "PredictorMfe2dSeed", param+",seedBP=7", length, cells
+				, [&](){
+					OutputHandlerInteractionList out(outConstr, 1);
+					PredictorMfe2dSeed predictor(energy, out, NULL, new SeedHandlerMfe(energy, seedConstr));
+					predictor.predict(r1,r2);
+				} );
+	} // noGUend
+	} // noLP
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Benchmarks the CSV output of predicted interactions
+ * @param length the sequence length to be used
+ */
+void
+benchOutput( const size_t length )
+{
+	const RnaSequence s1 = getRandomSequence(length, "target");
+	const RnaSequence s2 = getRandomSequence(length, "query");
+	AccessibilityDisabled acc1(s1, settings.maxLength, NULL);
+	AccessibilityDisabled acc2(s2, settings.maxLength, NULL);
+	ReverseAccessibility racc(acc2);
+	InteractionEnergyBasePair energy(acc1, racc);
+
+	// predict interactions to be reported
+	const size_t outNumber = 100;
+	const OutputConstraint outConstr(outNumber, OutputConstraint::OVERLAP_BOTH, 0, E_INF);
+	OutputHandlerInteractionList interactions(outConstr, outNumber);
+	{
+		PredictorMfe2dHeuristic predictor(energy, interactions, NULL);
+		predictor.predict(IndexRange(0,s1.lastPos), IndexRange(0,s2.lastPos));
+	}
+	if (interactions.empty()) {
+		return;
+	}
+
+	// write each interaction this often
+	const size_t rounds = 1000;
+	const OutputHandlerCsv::ColTypeList cols = OutputHandlerCsv::string2list("");
+	bench( "output", "OutputHandlerCsv", "outCsvCols=*", length, rounds*interactions.reported()
+			, [&](){
+				std::stringstream out;
+				OutputHandlerCsv csv(outConstr, out, energy, cols);
+				for (size_t r=0; r<rounds; r++) {
+					for (auto i = interactions.begin(); i != interactions.end(); i++) {
+						csv.add(**i);
+					}
+					out.str("");
+				}
+			} );
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs the IntaRNA binary with the given arguments and measures run time and
+ * peak RSS of the child process. Standard output and error are discarded.
+ *
+ * @param name the workload name
+ * @param param the parameter description
+ * @param length the sequence length used
+ * @param cells the number of cells processed
+ * @param args the arguments of the call
+ */
+void
+benchBinary( const std::string & name
+		, const std::string & param
+		, const size_t length
+		, const size_t cells
+		, const std::vector<std::string> & args )
+{
+	if (!settings.group.empty() && settings.group != "binary") {
+		return;
+	}
+	std::cerr <<"# bench binary "<<name<<" "<<param<<" length="<<length<<std::endl;
+	double timeMin = std::numeric_limits<double>::max(), timeSum = 0;
+	long peakRss = 0;
+	for (size_t r=0; r<settings.repeat; r++) {
+		const auto start = std::chrono::steady_clock::now();
+		pid_t pid = fork();
+		if (pid == 0) {
+			// redirect output to /dev/null
+			int devNull = open("/dev/null", O_WRONLY);
+			dup2(devNull, STDOUT_FILENO);
+			dup2(devNull, STDERR_FILENO);
+			std::vector<char*> argv;
+			argv.push_back(const_cast<char*>(settings.binary.c_str()));
+			for (const std::string & a : args) {
+				argv.push_back(const_cast<char*>(a.c_str()));
+			}
+			argv.push_back(NULL);
+			execv( settings.binary.c_str(), argv.data() );
+			_exit(127);
+		}
+		int status = 0;
+		struct rusage usage;
+		if (pid < 0 || wait4(pid, &status, 0, &usage) < 0) {
+			throw std::runtime_error("benchBinary() : could not run "+settings.binary);
+		}
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			std::cerr <<"# WARNING: "<<name<<" "<<param<<" exited with status "<<WEXITSTATUS(status)<<std::endl;
+		}
+		const double time = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+		timeMin = std::min(timeMin, time);
+		timeSum += time;
+		peakRss = std::max(peakRss, (long)usage.ru_maxrss);
+	}
+	BenchResult res = { "binary", name, param, length, cells, settings.repeat
+						, timeMin, timeSum/double(settings.repeat), peakRss };
+	results.push_back(res);
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Benchmarks end-to-end calls of the IntaRNA binary for all test data
+ * parameter files and for all personalities on synthetic sequences
+ */
+void
+benchBinaries()
+{
+	// test data based workloads
+	if (!settings.dataDir.empty()) {
+		std::vector<std::string> paramFiles;
+		for (boost::filesystem::directory_iterator f(settings.dataDir), end; f != end; ++f) {
+			if (f->path().extension() == ".parameter") {
+				paramFiles.push_back(f->path().string());
+			}
+		}
+		std::sort(paramFiles.begin(), paramFiles.end());
+		for (const std::string & paramFile : paramFiles) {
+			benchBinary( boost::filesystem::path(paramFile).stem().string(), "testdata", 0, 1
+					, { "--parameterFile="+paramFile, "--default-log-file=/dev/null" } );
+		}
+	}
+
+	// personality based workloads
+	const std::vector<std::string> personalities = { "IntaRNA", "IntaRNAexact", "IntaRNAsTar"
+			, "IntaRNAseed", "IntaRNAhelix", "IntaRNAduplex", "IntaRNAens" };
+	for (const size_t length : settings.lengths) {
+		const std::string target = getRandomSequence(length, "target").asString();
+		const std::string query = getRandomSequence(length, "query").asString();
+		for (const std::string & personality : personalities) {
+			// skip exact predictions for long sequences
+			if (personality == "IntaRNAexact" && length > settings.maxLengthExact) {
+				continue;
+			}
+			benchBinary( personality, "personality", length, length*length
+					, { "--personality="+personality, "-t", target, "-q", query
+						, "--default-log-file=/dev/null" } );
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * Writes the collected results in JSON format
+ * @param out the stream to write to
+ */
+void
+writeJson( std::ostream & out )
+{
+	out <<"{\n"
+		<<"  \"version\": \""<<INTARNA_PACKAGE_VERSION<<"\",\n"
+		<<"  \"repeat\": "<<settings.repeat<<",\n"
+		<<"  \"maxLength\": "<<settings.maxLength<<",\n"
+		<<"  \"results\": [";
+	for (size_t i=0; i<results.size(); i++) {
+		const BenchResult & r = results.at(i);
+		out <<(i==0?"\n":",\n")
+			<<"    {"
+			<<" \"id\": \""<<r.group<<"/"<<r.name<<"/"<<r.param<<"/"<<r.length<<"\""
+			<<", \"group\": \""<<r.group<<"\""
+			<<", \"name\": \""<<r.name<<"\""
+			<<", \"param\": \""<<r.param<<"\""
+			<<", \"length\": "<<r.length
+			<<", \"cells\": "<<r.cells
+			<<", \"time_s_min\": "<<r.timeMin
+			<<", \"time_s_mean\": "<<r.timeMean
+			<<", \"ns_per_cell\": "<<(r.timeMin*1e9/double(std::max<size_t>(1,r.cells)))
+			<<", \"cells_per_s\": "<<(double(r.cells)/std::max(1e-9,r.timeMin))
+			<<", \"peak_rss_kb\": "<<r.peakRss
+			<<" }";
+	}
+	out <<"\n  ]\n}\n";
+}
+
+/////////////////////////////////////////////////////////////////////
+
+/**
+ * program main entry
+ *
+ * @param argc number of program arguments
+ * @param argv array of program arguments of length argc
+ */
+int main(int argc, char **argv){
+
+	try {
+
+		// suppress all logging output
+		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToFile, std::string("false"));
+		el::Loggers::reconfigureAllLoggers(el::ConfigurationType::ToStandardOutput, std::string("false"));
+
+		// parse arguments
+		for (int a=1; a<argc; a++) {
+			const std::string arg(argv[a]);
+			const size_t eq = arg.find('=');
+			const std::string key = arg.substr(0,eq);
+			const std::string val = (eq == std::string::npos ? "" : arg.substr(eq+1));
+			if (key == "--lengths") {
+				std::vector<std::string> l;
+				boost::split( l, val, boost::is_any_of(",") );
+				settings.lengths.clear();
+				for (const std::string & s : l) {
+					settings.lengths.push_back( boost::lexical_cast<size_t>(s) );
+				}
+			} else if (key == "--repeat") {
+				settings.repeat = std::max<size_t>(1,boost::lexical_cast<size_t>(val));
+			} else if (key == "--maxLength") {
+				settings.maxLength = boost::lexical_cast<size_t>(val);
+			} else if (key == "--maxLengthExact") {
+				settings.maxLengthExact = boost::lexical_cast<size_t>(val);
+			} else if (key == "--seed") {
+				settings.randomSeed = boost::lexical_cast<unsigned long>(val);
+			} else if (key == "--bin") {
+				settings.binary = val;
+			} else if (key == "--dataDir") {
+				settings.dataDir = val;
+			} else if (key == "--group") {
+				settings.group = val;
+			} else if (key == "--out") {
+				settings.outFile = val;
+			} else {
+				std::cout <<"\nusage: runBenchmarks [options]\n\n"
+					<<"  --lengths=L1,L2,..   sequence lengths to benchmark (default 50,100,200,400)\n"
+					<<"  --repeat=N           runs per workload, the minimal time is reported (default 3)\n"
+					<<"  --maxLength=N        maximal interaction length per sequence (default 60)\n"
+					<<"  --maxLengthExact=N   maximal length for exact predictions (default 100)\n"
+					<<"  --seed=N             random seed for the sequence generation (default 42)\n"
+					<<"  --group=G            run only one group of: accessibility, seed, helix,\n"
+					<<"                       predictor, output, binary\n"
+					<<"  --bin=FILE           IntaRNA binary for end-to-end benchmarks\n"
+					<<"  --dataDir=DIR        directory of test parameter files (needs --bin)\n"
+					<<"  --out=FILE           JSON output file (default STDOUT)\n"
+					<<std::endl;
+				return (key == "--help" ? 0 : -1);
+			}
+		}
+
+		// run all benchmarks
+		for (const size_t length : settings.lengths) {
+			benchAccessibility( length );
+			benchSeedHelix( length );
+			benchPredictors( length );
+			benchOutput( length );
+		}
+		if (!settings.binary.empty()) {
+			benchBinaries();
+		}
+
+		// report results
+		if (settings.outFile.empty()) {
+			writeJson( std::cout );
+		} else {
+			std::ofstream out( settings.outFile.c_str() );
+			writeJson( out );
+		}
+
+	} catch (std::exception & e) {
+		std::cerr <<"\n EXCEPTION : "<<e.what()<<"\n\n";
+		return -1;
+	}
+
+	return 0;
+}
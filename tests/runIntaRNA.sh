@@ -36,11 +36,17 @@ function calltest {
     
     testCall="$INTARNABINPATH/src/bin/IntaRNA --parameterFile=$datadir/$name.parameter --default-log-file=/dev/null"
 
+    # optional input provided via STDIN
+    stdinfile=$datadir/$name.stdin
+    if [ ! -e "$stdinfile" ] ; then
+        stdinfile=/dev/null
+    fi
+
     echo " IntaRNA TEST $name"
 	#	echo CALL $testCall
     #echo
     
-    $testCall 2>&1 | grep -v INFO > $resultfile
+    $testCall < $stdinfile 2>&1 | grep -v INFO > $resultfile
 
 	if [ -e "$reference_resultsfile" ] ; then
 	    if ! diff "$reference_resultsfile" "$resultfile" "${diffopts}" > $difftmp; then